@@ -0,0 +1,241 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "ContentScheduler.h"
+
+#define EVENT_SHOWN 0
+#define EVENT_SKIPPED 1
+#define EVENT_EXPIRED 2
+#define EVENT_PREEMPTED 3
+
+static const char* const EVENT_NAMES[] = { "shown", "skipped", "expired", "preempted" };
+
+// Returns the item's number for the other calls, -1 when there is no room
+int ContentScheduler::add(const char* name, uint8_t priority, unsigned long minIntervalSeconds, unsigned long ttlSeconds, unsigned long dwellSeconds) {
+  if (count >= SCHEDULE_ITEMS) {
+    return -1;
+  }
+  Item &item = items[count];
+  memset(&item, 0, sizeof(item));
+  item.name = name;
+  item.priority = min((int)priority, SCHEDULE_PRIORITY_PREEMPT);
+  item.minInterval = minIntervalSeconds * 1000;
+  item.ttl = ttlSeconds * 1000;
+  item.dwell = dwellSeconds * 1000;
+  return count++;
+}
+
+void ContentScheduler::setInterval(int item, unsigned long minIntervalSeconds) {
+  if (item >= 0 && item < count) {
+    items[item].minInterval = minIntervalSeconds * 1000;
+  }
+}
+
+// Standing content: shown (at its interval) for as long as it is ready
+void ContentScheduler::setReady(int item, boolean ready) {
+  if (item >= 0 && item < count) {
+    items[item].ready = ready;
+  }
+}
+
+// A one-off event: shown once, unless its TTL runs out first
+void ContentScheduler::post(int item) {
+  if (item >= 0 && item < count) {
+    items[item].posted = true;
+    items[item].postedAt = millis();
+  }
+}
+
+// Its interval has passed -- whether or not there is anything to show
+boolean ContentScheduler::isDue(int item) {
+  if (item < 0 || item >= count) {
+    return false;
+  }
+  return !items[item].everShown || millis() - items[item].lastShown + SCHEDULE_SLACK_MS >= items[item].minInterval;
+}
+
+// Shown at the next chance, its interval notwithstanding
+void ContentScheduler::makeDue(int item) {
+  if (item >= 0 && item < count) {
+    items[item].everShown = false;
+  }
+}
+
+boolean ContentScheduler::isEligible(int item, unsigned long now) {
+  return (items[item].ready || items[item].posted)
+         && (!items[item].everShown || now - items[item].lastShown + SCHEDULE_SLACK_MS >= items[item].minInterval);
+}
+
+// Passed over items move up a level per scroll, but never far enough to preempt
+int ContentScheduler::getScore(int item) {
+  if (items[item].priority >= SCHEDULE_PRIORITY_PREEMPT) {
+    return items[item].priority;
+  }
+  return min(items[item].priority + items[item].skipped, SCHEDULE_PRIORITY_PREEMPT - 1);
+}
+
+void ContentScheduler::expire() {
+  unsigned long now = millis();
+  for (int inx = 0; inx < count; inx++) {
+    if (items[inx].posted && items[inx].ttl > 0 && now - items[inx].postedAt > items[inx].ttl) {
+      items[inx].posted = false;
+      record(inx, EVENT_EXPIRED);
+    }
+  }
+}
+
+// Fills chosen with the items for the next scroll, in the order they were added
+// (preempting ones first). Returns how many; the scroll is running until finished().
+int ContentScheduler::select(int* chosen, int size, boolean preemptingOnly) {
+  expire();
+  unsigned long now = millis();
+  size = min(size, SCHEDULE_MAX_PER_SCROLL);
+  int picked = 0;
+  boolean taken[SCHEDULE_ITEMS] = { false };
+  while (picked < size) {
+    int best = -1;
+    for (int inx = 0; inx < count; inx++) {
+      if (taken[inx] || !isEligible(inx, now) || (preemptingOnly && items[inx].priority < SCHEDULE_PRIORITY_PREEMPT)) {
+        continue;
+      }
+      if (best < 0 || getScore(inx) > getScore(best)
+          || (getScore(inx) == getScore(best) && (!items[inx].everShown || (items[best].everShown && items[inx].lastShown < items[best].lastShown)))) {
+        best = inx; // ties go to the one waiting longest
+      }
+    }
+    if (best < 0) {
+      break;
+    }
+    taken[best] = true;
+    picked++;
+  }
+  int position = 0;
+  runningPriority = -1;
+  for (int pass = 0; pass < 2; pass++) {
+    for (int inx = 0; inx < count; inx++) {
+      boolean preempting = items[inx].priority >= SCHEDULE_PRIORITY_PREEMPT;
+      if (!taken[inx] || preempting != (pass == 0)) {
+        continue;
+      }
+      runningPosted[position] = items[inx].posted;
+      chosen[position++] = inx;
+      items[inx].lastShown = now;
+      items[inx].everShown = true;
+      items[inx].posted = false;
+      items[inx].skipped = 0;
+      items[inx].shownCount++;
+      runningPriority = max(runningPriority, (int)items[inx].priority);
+      record(inx, EVENT_SHOWN);
+    }
+  }
+  for (int inx = 0; inx < count; inx++) {
+    if (!taken[inx] && isEligible(inx, now) && !preemptingOnly) {
+      items[inx].skipped = min(items[inx].skipped + 1, 255);
+      record(inx, EVENT_SKIPPED);
+    }
+  }
+  runningCount = picked;
+  memcpy(running, chosen, picked * sizeof(int));
+  return picked;
+}
+
+// The scroll is over -- the longest dwell of its items starts now. One that was
+// cut short didn't show its items, so they are put back to come next.
+void ContentScheduler::finished(boolean preempted) {
+  unsigned long dwell = 0;
+  for (int inx = 0; inx < runningCount; inx++) {
+    Item &item = items[running[inx]];
+    dwell = max(dwell, item.dwell);
+    if (preempted) {
+      item.everShown = false;
+      item.posted |= runningPosted[inx];
+      item.shownCount--;
+      record(running[inx], EVENT_PREEMPTED);
+    }
+  }
+  holding = !preempted && dwell > 0;
+  holdUntil = millis() + dwell;
+  runningCount = 0;
+  runningPriority = -1;
+}
+
+boolean ContentScheduler::hasPreempting() {
+  unsigned long now = millis();
+  for (int inx = 0; inx < count; inx++) {
+    if (items[inx].priority >= SCHEDULE_PRIORITY_PREEMPT && isEligible(inx, now)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Checked every frame: something more important than what is scrolling is waiting
+boolean ContentScheduler::shouldPreempt() {
+  return runningPriority < SCHEDULE_PRIORITY_PREEMPT && hasPreempting();
+}
+
+boolean ContentScheduler::isHolding() {
+  if (holding && (long)(millis() - holdUntil) >= 0) {
+    holding = false;
+  }
+  return holding;
+}
+
+// Nothing to hold the display for after all
+void ContentScheduler::release() {
+  holding = false;
+}
+
+void ContentScheduler::record(int item, uint8_t event) {
+  decisions[decisionNext].at = millis();
+  decisions[decisionNext].item = item;
+  decisions[decisionNext].event = event;
+  decisionNext = (decisionNext + 1) % SCHEDULE_LOG_SIZE;
+  decisionCount = min(decisionCount + 1, SCHEDULE_LOG_SIZE);
+  if (event != EVENT_SKIPPED) {
+    Serial.println("Scheduler: " + String(items[item].name) + " " + EVENT_NAMES[event]);
+  }
+}
+
+// Plain text for /debug/scheduler: every item, then the latest decisions newest first
+String ContentScheduler::getReport() {
+  unsigned long now = millis();
+  String report = "item        priority  score  ready  due  shown  last shown  interval  ttl  dwell\n";
+  for (int inx = 0; inx < count; inx++) {
+    Item &item = items[inx];
+    char line[120];
+    snprintf(line, sizeof(line), "%-11s %8d  %5d  %5s  %3s  %5lu  %8s  %7lus  %3lus  %4lus\n",
+             item.name, item.priority, getScore(inx), item.posted ? "event" : (item.ready ? "yes" : "no"), isDue(inx) ? "yes" : "no",
+             item.shownCount, item.everShown ? (String((now - item.lastShown) / 1000) + "s ago").c_str() : "never",
+             item.minInterval / 1000, item.ttl / 1000, item.dwell / 1000);
+    report += line;
+  }
+  report += "\nscrolling: " + String(runningCount) + " items" + (runningPriority >= 0 ? " at priority " + String(runningPriority) : "")
+            + (isHolding() ? ", holding " + String((holdUntil - now) / 1000) + "s" : "") + "\n\nlatest decisions:\n";
+  for (int inx = 1; inx <= decisionCount; inx++) {
+    Decision &decision = decisions[(decisionNext - inx + SCHEDULE_LOG_SIZE) % SCHEDULE_LOG_SIZE];
+    report += String((now - decision.at) / 1000) + "s ago  " + items[decision.item].name + " " + EVENT_NAMES[decision.event] + "\n";
+  }
+  return report;
+}
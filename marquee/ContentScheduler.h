@@ -0,0 +1,103 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <Arduino.h>
+
+#define SCHEDULE_ITEMS 8
+#define SCHEDULE_LOG_SIZE 24
+#define SCHEDULE_PRIORITY_PREEMPT 3   // ready items at this priority cut into a running scroll
+#define SCHEDULE_MAX_PER_SCROLL 4     // the rest wait their turn for the next one
+#define SCHEDULE_SLACK_MS 5000        // a minimum interval counts as passed this much early
+
+/* Decides what goes into each scroll. Every kind of content (weather,
+   news, printers ...) is an item with
+     priority      0-3, higher scrolls first; 3 cuts into a running scroll
+     min interval  it isn't shown again sooner
+     TTL           how long a posted event waits to be shown before it's dropped
+     dwell         how long the display is held after the scroll (e.g. for a graph)
+   Content that is there for as long as its source says so is set ready;
+   one-off events are posted. A scroll takes at most SCHEDULE_MAX_PER_SCROLL
+   items, best first. An item passed over ages one priority level per
+   scroll (never up to preempting), and the longest waiting item wins a tie,
+   so nothing starves. A scroll that is cut short gives its items back: they
+   are due again and posted events are posted again, so they come back in
+   the next scroll. Decisions are kept in a small log for the debug page.
+*/
+class ContentScheduler {
+
+public:
+  int add(const char* name, uint8_t priority, unsigned long minIntervalSeconds, unsigned long ttlSeconds, unsigned long dwellSeconds);
+  void setInterval(int item, unsigned long minIntervalSeconds);
+  void setReady(int item, boolean ready);
+  void post(int item);
+  boolean isDue(int item);
+  void makeDue(int item);
+  int select(int* chosen, int size, boolean preemptingOnly);
+  void finished(boolean preempted);
+  boolean hasPreempting();
+  boolean shouldPreempt();
+  boolean isHolding();
+  void release();
+  String getReport();
+
+private:
+  typedef struct {
+    const char* name;
+    uint8_t priority;
+    uint8_t skipped;             // scrolls passed over since last shown -- ages it up
+    boolean ready;               // standing content
+    boolean posted;              // an event waiting to be shown
+    boolean everShown;
+    unsigned long minInterval;   // ms
+    unsigned long ttl;           // ms, for posted events; 0 = no limit
+    unsigned long dwell;         // ms
+    unsigned long postedAt;
+    unsigned long lastShown;
+    unsigned long shownCount;
+  } Item;
+
+  typedef struct {
+    unsigned long at;
+    uint8_t item;
+    uint8_t event;
+  } Decision;
+
+  Item items[SCHEDULE_ITEMS];
+  int count = 0;
+  int running[SCHEDULE_MAX_PER_SCROLL];
+  boolean runningPosted[SCHEDULE_MAX_PER_SCROLL]; // was a posted event -- posted again if preempted
+  int runningCount = 0;
+  int runningPriority = -1;      // none
+  unsigned long holdUntil = 0;
+  boolean holding = false;
+  Decision decisions[SCHEDULE_LOG_SIZE];
+  int decisionNext = 0;
+  int decisionCount = 0;
+
+  void expire();
+  boolean isEligible(int item, unsigned long now);
+  int getScore(int item);
+  void record(int item, uint8_t event);
+};
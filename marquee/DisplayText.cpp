@@ -0,0 +1,247 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "DisplayText.h"
+
+typedef struct {
+  uint16_t first;
+  uint16_t last;
+  char text[4];
+} Transliteration;
+
+// For the display font: most of Latin-1 and Latin Extended, typographic
+// punctuation and spaces. Sorted, so a code point is found by binary search.
+// A replacement is never longer than the UTF-8 sequence it stands for.
+static const Transliteration TRANSLITERATIONS[] PROGMEM = {
+  {0x00A0, 0x00A0, " "}, {0x00A1, 0x00A1, "!"}, {0x00A2, 0x00A2, "c"}, {0x00A3, 0x00A3, "L"},
+  {0x00A5, 0x00A5, "Y"}, {0x00A6, 0x00A6, "|"}, {0x00A7, 0x00A7, "S"}, {0x00A9, 0x00A9, "c"},
+  {0x00AB, 0x00AB, "'"}, {0x00AD, 0x00AD, ""}, {0x00AE, 0x00AE, "R"}, {0x00B0, 0x00B0, "o"},
+  {0x00B1, 0x00B1, "+-"}, {0x00B2, 0x00B2, "2"}, {0x00B3, 0x00B3, "3"}, {0x00B4, 0x00B4, "'"},
+  {0x00B5, 0x00B5, "u"}, {0x00B7, 0x00B7, "."}, {0x00B9, 0x00B9, "1"}, {0x00BB, 0x00BB, "'"},
+  {0x00BF, 0x00BF, "?"}, {0x00C0, 0x00C3, "A"}, {0x00C4, 0x00C4, "Ae"}, {0x00C5, 0x00C5, "A"},
+  {0x00C6, 0x00C6, "AE"}, {0x00C7, 0x00C7, "C"}, {0x00C8, 0x00CB, "E"}, {0x00CC, 0x00CF, "I"},
+  {0x00D0, 0x00D0, "D"}, {0x00D1, 0x00D1, "N"}, {0x00D2, 0x00D5, "O"}, {0x00D6, 0x00D6, "Oe"},
+  {0x00D7, 0x00D7, "x"}, {0x00D8, 0x00D8, "O"}, {0x00D9, 0x00DB, "U"}, {0x00DC, 0x00DC, "Ue"},
+  {0x00DD, 0x00DD, "Y"}, {0x00DE, 0x00DE, "Th"}, {0x00DF, 0x00DF, "ss"}, {0x00E0, 0x00E3, "a"},
+  {0x00E4, 0x00E4, "ae"}, {0x00E5, 0x00E5, "a"}, {0x00E6, 0x00E6, "ae"}, {0x00E7, 0x00E7, "c"},
+  {0x00E8, 0x00EB, "e"}, {0x00EC, 0x00EF, "i"}, {0x00F0, 0x00F0, "d"}, {0x00F1, 0x00F1, "n"},
+  {0x00F2, 0x00F5, "o"}, {0x00F6, 0x00F6, "oe"}, {0x00F7, 0x00F7, "/"}, {0x00F8, 0x00F8, "o"},
+  {0x00F9, 0x00FB, "u"}, {0x00FC, 0x00FC, "ue"}, {0x00FD, 0x00FD, "y"}, {0x00FE, 0x00FE, "th"},
+  {0x00FF, 0x00FF, "y"}, {0x0100, 0x0100, "A"}, {0x0101, 0x0101, "a"}, {0x0102, 0x0102, "A"},
+  {0x0103, 0x0103, "a"}, {0x0104, 0x0104, "A"}, {0x0105, 0x0105, "a"}, {0x0106, 0x0106, "C"},
+  {0x0107, 0x0107, "c"}, {0x0108, 0x0108, "C"}, {0x0109, 0x0109, "c"}, {0x010A, 0x010A, "C"},
+  {0x010B, 0x010B, "c"}, {0x010C, 0x010C, "C"}, {0x010D, 0x010D, "c"}, {0x010E, 0x010E, "D"},
+  {0x010F, 0x010F, "d"}, {0x0110, 0x0110, "D"}, {0x0111, 0x0111, "d"}, {0x0112, 0x0112, "E"},
+  {0x0113, 0x0113, "e"}, {0x0114, 0x0114, "E"}, {0x0115, 0x0115, "e"}, {0x0116, 0x0116, "E"},
+  {0x0117, 0x0117, "e"}, {0x0118, 0x0118, "E"}, {0x0119, 0x0119, "e"}, {0x011A, 0x011A, "E"},
+  {0x011B, 0x011B, "e"}, {0x011C, 0x011C, "G"}, {0x011D, 0x011D, "g"}, {0x011E, 0x011E, "G"},
+  {0x011F, 0x011F, "g"}, {0x0120, 0x0120, "G"}, {0x0121, 0x0121, "g"}, {0x0122, 0x0122, "G"},
+  {0x0123, 0x0123, "g"}, {0x0124, 0x0124, "H"}, {0x0125, 0x0125, "h"}, {0x0126, 0x0126, "H"},
+  {0x0127, 0x0127, "h"}, {0x0128, 0x0128, "I"}, {0x0129, 0x0129, "i"}, {0x012A, 0x012A, "I"},
+  {0x012B, 0x012B, "i"}, {0x012C, 0x012C, "I"}, {0x012D, 0x012D, "i"}, {0x012E, 0x012E, "I"},
+  {0x012F, 0x012F, "i"}, {0x0130, 0x0130, "I"}, {0x0131, 0x0131, "i"}, {0x0132, 0x0132, "IJ"},
+  {0x0133, 0x0133, "ij"}, {0x0134, 0x0134, "J"}, {0x0135, 0x0135, "j"}, {0x0136, 0x0136, "K"},
+  {0x0137, 0x0138, "k"}, {0x0139, 0x0139, "L"}, {0x013A, 0x013A, "l"}, {0x013B, 0x013B, "L"},
+  {0x013C, 0x013C, "l"}, {0x013D, 0x013D, "L"}, {0x013E, 0x013E, "l"}, {0x013F, 0x013F, "L"},
+  {0x0140, 0x0140, "l"}, {0x0141, 0x0141, "L"}, {0x0142, 0x0142, "l"}, {0x0143, 0x0143, "N"},
+  {0x0144, 0x0144, "n"}, {0x0145, 0x0145, "N"}, {0x0146, 0x0146, "n"}, {0x0147, 0x0147, "N"},
+  {0x0148, 0x0149, "n"}, {0x014C, 0x014C, "O"}, {0x014D, 0x014D, "o"}, {0x014E, 0x014E, "O"},
+  {0x014F, 0x014F, "o"}, {0x0150, 0x0150, "O"}, {0x0151, 0x0151, "o"}, {0x0152, 0x0152, "OE"},
+  {0x0153, 0x0153, "oe"}, {0x0154, 0x0154, "R"}, {0x0155, 0x0155, "r"}, {0x0156, 0x0156, "R"},
+  {0x0157, 0x0157, "r"}, {0x0158, 0x0158, "R"}, {0x0159, 0x0159, "r"}, {0x015A, 0x015A, "S"},
+  {0x015B, 0x015B, "s"}, {0x015C, 0x015C, "S"}, {0x015D, 0x015D, "s"}, {0x015E, 0x015E, "S"},
+  {0x015F, 0x015F, "s"}, {0x0160, 0x0160, "S"}, {0x0161, 0x0161, "s"}, {0x0162, 0x0162, "T"},
+  {0x0163, 0x0163, "t"}, {0x0164, 0x0164, "T"}, {0x0165, 0x0165, "t"}, {0x0166, 0x0166, "T"},
+  {0x0167, 0x0167, "t"}, {0x0168, 0x0168, "U"}, {0x0169, 0x0169, "u"}, {0x016A, 0x016A, "U"},
+  {0x016B, 0x016B, "u"}, {0x016C, 0x016C, "U"}, {0x016D, 0x016D, "u"}, {0x016E, 0x016E, "U"},
+  {0x016F, 0x016F, "u"}, {0x0170, 0x0170, "U"}, {0x0171, 0x0171, "u"}, {0x0172, 0x0172, "U"},
+  {0x0173, 0x0173, "u"}, {0x0174, 0x0174, "W"}, {0x0175, 0x0175, "w"}, {0x0176, 0x0176, "Y"},
+  {0x0177, 0x0177, "y"}, {0x0178, 0x0178, "Y"}, {0x0179, 0x0179, "Z"}, {0x017A, 0x017A, "z"},
+  {0x017B, 0x017B, "Z"}, {0x017C, 0x017C, "z"}, {0x017D, 0x017D, "Z"}, {0x017E, 0x017E, "z"},
+  {0x017F, 0x017F, "s"}, {0x0192, 0x0192, "f"}, {0x01A0, 0x01A0, "O"}, {0x01A1, 0x01A1, "o"},
+  {0x01AF, 0x01AF, "U"}, {0x01B0, 0x01B0, "u"}, {0x01C4, 0x01C4, "DZ"}, {0x01C5, 0x01C5, "Dz"},
+  {0x01C6, 0x01C6, "dz"}, {0x01C7, 0x01C7, "LJ"}, {0x01C8, 0x01C8, "Lj"}, {0x01C9, 0x01C9, "lj"},
+  {0x01CA, 0x01CA, "NJ"}, {0x01CB, 0x01CB, "Nj"}, {0x01CC, 0x01CC, "nj"}, {0x01CD, 0x01CD, "A"},
+  {0x01CE, 0x01CE, "a"}, {0x01CF, 0x01CF, "I"}, {0x01D0, 0x01D0, "i"}, {0x01D1, 0x01D1, "O"},
+  {0x01D2, 0x01D2, "o"}, {0x01D3, 0x01D3, "U"}, {0x01D4, 0x01D4, "u"}, {0x01D5, 0x01D5, "U"},
+  {0x01D6, 0x01D6, "u"}, {0x01D7, 0x01D7, "U"}, {0x01D8, 0x01D8, "u"}, {0x01D9, 0x01D9, "U"},
+  {0x01DA, 0x01DA, "u"}, {0x01DB, 0x01DB, "U"}, {0x01DC, 0x01DC, "u"}, {0x01DE, 0x01DE, "A"},
+  {0x01DF, 0x01DF, "a"}, {0x01E0, 0x01E0, "A"}, {0x01E1, 0x01E1, "a"}, {0x01E6, 0x01E6, "G"},
+  {0x01E7, 0x01E7, "g"}, {0x01E8, 0x01E8, "K"}, {0x01E9, 0x01E9, "k"}, {0x01EA, 0x01EA, "O"},
+  {0x01EB, 0x01EB, "o"}, {0x01EC, 0x01EC, "O"}, {0x01ED, 0x01ED, "o"}, {0x01F0, 0x01F0, "j"},
+  {0x01F1, 0x01F1, "DZ"}, {0x01F2, 0x01F2, "Dz"}, {0x01F3, 0x01F3, "dz"}, {0x01F4, 0x01F4, "G"},
+  {0x01F5, 0x01F5, "g"}, {0x01F8, 0x01F8, "N"}, {0x01F9, 0x01F9, "n"}, {0x01FA, 0x01FA, "A"},
+  {0x01FB, 0x01FB, "a"}, {0x0200, 0x0200, "A"}, {0x0201, 0x0201, "a"}, {0x0202, 0x0202, "A"},
+  {0x0203, 0x0203, "a"}, {0x0204, 0x0204, "E"}, {0x0205, 0x0205, "e"}, {0x0206, 0x0206, "E"},
+  {0x0207, 0x0207, "e"}, {0x0208, 0x0208, "I"}, {0x0209, 0x0209, "i"}, {0x020A, 0x020A, "I"},
+  {0x020B, 0x020B, "i"}, {0x020C, 0x020C, "O"}, {0x020D, 0x020D, "o"}, {0x020E, 0x020E, "O"},
+  {0x020F, 0x020F, "o"}, {0x0210, 0x0210, "R"}, {0x0211, 0x0211, "r"}, {0x0212, 0x0212, "R"},
+  {0x0213, 0x0213, "r"}, {0x0214, 0x0214, "U"}, {0x0215, 0x0215, "u"}, {0x0216, 0x0216, "U"},
+  {0x0217, 0x0217, "u"}, {0x0218, 0x0218, "S"}, {0x0219, 0x0219, "s"}, {0x021A, 0x021A, "T"},
+  {0x021B, 0x021B, "t"}, {0x021E, 0x021E, "H"}, {0x021F, 0x021F, "h"}, {0x0226, 0x0226, "A"},
+  {0x0227, 0x0227, "a"}, {0x0228, 0x0228, "E"}, {0x0229, 0x0229, "e"}, {0x022A, 0x022A, "O"},
+  {0x022B, 0x022B, "o"}, {0x022C, 0x022C, "O"}, {0x022D, 0x022D, "o"}, {0x022E, 0x022E, "O"},
+  {0x022F, 0x022F, "o"}, {0x0230, 0x0230, "O"}, {0x0231, 0x0231, "o"}, {0x0232, 0x0232, "Y"},
+  {0x0233, 0x0233, "y"}, {0x0300, 0x036F, ""}, {0x2000, 0x200A, " "}, {0x200B, 0x200F, ""},
+  {0x2010, 0x2015, "-"}, {0x2018, 0x201B, "'"}, {0x201C, 0x201D, "\""}, {0x201E, 0x201E, "'"},
+  {0x201F, 0x201F, "\""}, {0x2022, 0x2022, "-"}, {0x2026, 0x2026, "..."}, {0x202F, 0x202F, " "},
+  {0x2032, 0x2032, "'"}, {0x2033, 0x2033, "\""}, {0x2039, 0x203A, "'"}, {0x2044, 0x2044, "/"},
+  {0x205F, 0x205F, " "}, {0x2060, 0x2060, ""}, {0x20A4, 0x20A4, "L"}, {0x20AC, 0x20AC, "EUR"},
+  {0x20B9, 0x20B9, "Rs"}, {0x2122, 0x2122, "TM"}, {0x2190, 0x2190, "<-"}, {0x2192, 0x2192, "->"},
+  {0x2212, 0x2212, "-"}, {0x3000, 0x3000, " "}, {0xFE00, 0xFE0F, ""}, {0xFEFF, 0xFEFF, ""}
+};
+
+// What Windows-1252 puts in 0x80-0x9F, for feeds that aren't UTF-8 after all
+static const uint16_t WINDOWS_1252[32] PROGMEM = {
+  0x20AC, 0x003F, 0x201A, 0x0192, 0x201E, 0x2026, 0x0000, 0x0000, 0x005E, 0x0000, 0x0160, 0x2039, 0x0152, 0x003F, 0x017D, 0x003F,
+  0x003F, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x007E, 0x2122, 0x0161, 0x203A, 0x0153, 0x003F, 0x017E, 0x0178
+};
+
+// UTF-8 to the display charset, in place. Returns the new length.
+size_t DisplayText::clean(char* text) {
+  return transliterate(text, false);
+}
+
+// %XX and '+' decoded, then as clean(). Returns the new length.
+size_t DisplayText::decodeForm(char* text) {
+  return transliterate(text, true);
+}
+
+// Finds name in "a=1&b=2" and copies its value, decoded and cleaned, to value
+boolean DisplayText::getFormArg(const char* form, const char* name, char* value, size_t size) {
+  size_t nameLength = strlen(name);
+  const char* pair = form;
+  while (*pair != '\0') {
+    const char* end = strchr(pair, '&');
+    if (end == nullptr) {
+      end = pair + strlen(pair);
+    }
+    if ((size_t)(end - pair) > nameLength && strncmp(pair, name, nameLength) == 0 && pair[nameLength] == '=') {
+      size_t length = min((size_t)(end - pair - nameLength - 1), size - 1);
+      memcpy(value, pair + nameLength + 1, length);
+      value[length] = '\0';
+      decodeForm(value);
+      return true;
+    }
+    pair = *end == '&' ? end + 1 : end;
+  }
+  return false;
+}
+
+static uint8_t hexValue(char c) {
+  return c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+}
+
+// The next byte of the text, %XX and '+' decoded when it is form encoded; 0 at the end
+static uint8_t readByte(const char* &in, boolean formEncoded) {
+  uint8_t c = *in;
+  if (c == '\0') {
+    return 0;
+  }
+  in++;
+  if (formEncoded) {
+    if (c == '+') {
+      return ' ';
+    }
+    if (c == '%' && isxdigit((unsigned char)in[0]) && isxdigit((unsigned char)in[1])) {
+      c = (hexValue(in[0]) << 4) | hexValue(in[1]);
+      in += 2;
+      if (c == '\0') {
+        c = ' '; // %00 doesn't end the text
+      }
+    }
+  }
+  return c;
+}
+
+// Characters the table doesn't know become '?', emoji and zero width ones are
+// dropped. A byte that isn't valid UTF-8 is read as Windows-1252.
+size_t DisplayText::transliterate(char* text, boolean formEncoded) {
+  char* out = text;
+  const char* in = text;
+  uint8_t c;
+  while ((c = readByte(in, formEncoded)) != 0) {
+    if (c < 0x80) {
+      if (c == '\\' && !formEncoded && *in == '"') {
+        in++;
+        c = '\'';
+      } else if (c == '`') {
+        c = '\'';
+      } else if (c < ' ') {
+        c = ' ';
+      }
+      *out++ = c;
+      continue;
+    }
+    int length = c >= 0xF8 ? 0 : c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 0;
+    uint32_t codePoint = c & (0x7F >> length);
+    const char* sequence = in;
+    for (int inx = 1; inx < length; inx++) {
+      uint8_t next = readByte(in, formEncoded);
+      if ((next & 0xC0) != 0x80) {
+        length = 0;
+        break;
+      }
+      codePoint = (codePoint << 6) | (next & 0x3F);
+    }
+    if (length == 0) {
+      in = sequence;
+      length = 1;
+      codePoint = c < 0xA0 ? pgm_read_word(&WINDOWS_1252[c - 0x80]) : c;
+    }
+    if (codePoint < 0x80) {
+      if (codePoint != 0) {
+        *out++ = codePoint;
+      }
+      continue;
+    }
+    if (codePoint > 0xFFFF) {
+      continue; // emoji and the like
+    }
+    int low = 0;
+    int high = sizeof(TRANSLITERATIONS) / sizeof(TRANSLITERATIONS[0]);
+    while (low < high) {
+      int middle = (low + high) / 2;
+      if (pgm_read_word(&TRANSLITERATIONS[middle].last) < codePoint) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    if (low < (int)(sizeof(TRANSLITERATIONS) / sizeof(TRANSLITERATIONS[0])) && pgm_read_word(&TRANSLITERATIONS[low].first) <= codePoint) {
+      // never more than the bytes the character took, so out can't pass in
+      for (int inx = 0; inx < length; inx++) {
+        char replacement = pgm_read_byte(&TRANSLITERATIONS[low].text[inx]);
+        if (replacement == '\0') {
+          break;
+        }
+        *out++ = replacement;
+      }
+    } else {
+      *out++ = '?';
+    }
+  }
+  *out = '\0';
+  return out - text;
+}
@@ -0,0 +1,48 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <Arduino.h>
+
+/* Text on its way to the display. Input is UTF-8, from the news feeds, the
+   web forms and pushed messages. The display font is ASCII, so each
+   character is looked up in a transliteration table (e, ss, ", ...) while
+   the text is decoded, in a single pass and in place: no replacement is
+   longer than what it replaces.
+
+   Form text (application/x-www-form-urlencoded) has its %XX escapes and
+   '+' decoded in the same pass, so a browser's %C3%A9 becomes an e. That is
+   for raw form bodies such as the UDP messages; ESP8266WebServer::arg()
+   values are decoded already and only need clean().
+*/
+class DisplayText {
+
+public:
+  static size_t clean(char* text);
+  static size_t decodeForm(char* text);
+  static boolean getFormArg(const char* form, const char* name, char* value, size_t size);
+
+private:
+  static size_t transliterate(char* text, boolean formEncoded);
+};
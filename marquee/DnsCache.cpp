@@ -0,0 +1,205 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "DnsCache.h"
+
+DnsCache dnsCache;
+
+DnsCache::DnsCache(unsigned long ttlMs) {
+  ttl = ttlMs;
+  clear();
+}
+
+void DnsCache::clear() {
+  for (int inx = 0; inx < DNS_CACHE_SIZE; inx++) {
+    entries[inx].host[0] = '\0';
+    entries[inx].valid = false;
+  }
+}
+
+boolean DnsCache::resolve(const char* host, IPAddress &ip) {
+  if (host == nullptr || host[0] == '\0') {
+    return false;
+  }
+  // Literal addresses (the usual case for Pi-hole and OctoPrint) need no lookup
+  IPAddress literal;
+  if (literal.fromString(host)) {
+    ip = literal;
+    return true;
+  }
+  // A name too long to store would never match its own entry -- look it up each time
+  if (strlen(host) >= DNS_CACHE_HOST_LEN) {
+    misses++;
+    if (!lookup(host, ip)) {
+      Serial.println("DNS lookup failed for " + String(host));
+      return false;
+    }
+    return true;
+  }
+
+  DnsEntry *entry = find(host);
+  if (entry != nullptr) {
+    entry->lastUsed = millis();
+    if ((millis() - entry->resolvedAt) < ttl) {
+      hits++;
+      ip = entry->ip;
+      return true;
+    }
+    // expired -- try to revalidate, fall back to the old address
+    misses++;
+    IPAddress fresh;
+    if (lookup(host, fresh)) {
+      entry->ip = fresh;
+      entry->resolvedAt = millis();
+    } else {
+      staleServed++;
+      Serial.println("DNS lookup failed for " + String(host) + ", using cached " + entry->ip.toString());
+    }
+    ip = entry->ip;
+    return true;
+  }
+
+  misses++;
+  if (!lookup(host, ip)) {
+    Serial.println("DNS lookup failed for " + String(host));
+    return false;
+  }
+  entry = allocate(host);
+  entry->ip = ip;
+  entry->resolvedAt = millis();
+  entry->lastUsed = millis();
+  entry->valid = true;
+  return true;
+}
+
+// Re-resolve at most one entry per call that is in the last quarter of its
+// TTL and still in use, so requests keep hitting a fresh entry
+void DnsCache::refresh() {
+  if (WiFi.status() != WL_CONNECTED) {
+    return;
+  }
+  for (int inx = 0; inx < DNS_CACHE_SIZE; inx++) {
+    DnsEntry *entry = &entries[inx];
+    if (!entry->valid) {
+      continue;
+    }
+    unsigned long age = millis() - entry->resolvedAt;
+    if (age < (ttl / 4) * 3 || (millis() - entry->lastUsed) > ttl * 2) {
+      continue;
+    }
+    IPAddress fresh;
+    if (lookup(entry->host, fresh)) {
+      entry->ip = fresh;
+      entry->resolvedAt = millis();
+    } else {
+      // try again once it has expired; resolve() will serve it stale meanwhile
+      entry->resolvedAt = millis() - ttl;
+    }
+    return;
+  }
+}
+
+boolean DnsCache::lookup(const char* host, IPAddress &ip) {
+  unsigned long start = millis();
+  int result = WiFi.hostByName(host, ip);
+  unsigned long elapsed = millis() - start;
+  lookups++;
+  totalLookupMs += elapsed;
+  if (elapsed > maxLookupMs) {
+    maxLookupMs = elapsed;
+  }
+  if (result != 1 || !ip.isSet()) {
+    failures++;
+    return false;
+  }
+  return true;
+}
+
+DnsCache::DnsEntry *DnsCache::find(const char* host) {
+  for (int inx = 0; inx < DNS_CACHE_SIZE; inx++) {
+    if (entries[inx].valid && strcmp(entries[inx].host, host) == 0) {
+      return &entries[inx];
+    }
+  }
+  return nullptr;
+}
+
+// Take a free slot, or evict the least recently used one
+DnsCache::DnsEntry *DnsCache::allocate(const char* host) {
+  DnsEntry *slot = &entries[0];
+  for (int inx = 0; inx < DNS_CACHE_SIZE; inx++) {
+    if (!entries[inx].valid) {
+      slot = &entries[inx];
+      break;
+    }
+    if ((millis() - entries[inx].lastUsed) > (millis() - slot->lastUsed)) {
+      slot = &entries[inx];
+    }
+  }
+  strcpy(slot->host, host); // resolve() only caches names that fit
+  return slot;
+}
+
+unsigned long DnsCache::getHits() {
+  return hits;
+}
+
+unsigned long DnsCache::getMisses() {
+  return misses;
+}
+
+unsigned long DnsCache::getStaleServed() {
+  return staleServed;
+}
+
+unsigned long DnsCache::getFailures() {
+  return failures;
+}
+
+int DnsCache::getHitRate() {
+  if (hits + misses == 0) {
+    return 0;
+  }
+  return (hits * 100) / (hits + misses);
+}
+
+unsigned long DnsCache::getAverageLookupMs() {
+  if (lookups == 0) {
+    return 0;
+  }
+  return totalLookupMs / lookups;
+}
+
+unsigned long DnsCache::getMaxLookupMs() {
+  return maxLookupMs;
+}
+
+int DnsCache::getEntryCount() {
+  int count = 0;
+  for (int inx = 0; inx < DNS_CACHE_SIZE; inx++) {
+    if (entries[inx].valid) {
+      count++;
+    }
+  }
+  return count;
+}
@@ -0,0 +1,78 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <ESP8266WiFi.h>
+
+#define DNS_CACHE_SIZE 8
+#define DNS_CACHE_HOST_LEN 64   // longer names are resolved every time, not cached
+
+/* Small resolver cache shared by all the data clients.
+   Entries are kept for a fixed TTL (the ESP8266 resolver doesn't report the
+   record TTL). refresh() is called from loop() and re-resolves entries that
+   are close to expiry, so a data request rarely waits on DNS. When a lookup
+   fails the last known address is served (stale-while-revalidate).
+*/
+class DnsCache {
+
+public:
+  DnsCache(unsigned long ttlMs = 30 * 60 * 1000UL);
+  boolean resolve(const char* host, IPAddress &ip);
+  void refresh();
+  void clear();
+
+  unsigned long getHits();
+  unsigned long getMisses();
+  unsigned long getStaleServed();
+  unsigned long getFailures();
+  int getHitRate();
+  unsigned long getAverageLookupMs();
+  unsigned long getMaxLookupMs();
+  int getEntryCount();
+
+private:
+  typedef struct {
+    char host[DNS_CACHE_HOST_LEN];
+    IPAddress ip;
+    unsigned long resolvedAt;
+    unsigned long lastUsed;
+    boolean valid;
+  } DnsEntry;
+
+  DnsEntry entries[DNS_CACHE_SIZE];
+  unsigned long ttl;
+
+  unsigned long hits = 0;
+  unsigned long misses = 0;
+  unsigned long staleServed = 0;
+  unsigned long failures = 0;
+  unsigned long lookups = 0;
+  unsigned long totalLookupMs = 0;
+  unsigned long maxLookupMs = 0;
+
+  DnsEntry *find(const char* host);
+  DnsEntry *allocate(const char* host);
+  boolean lookup(const char* host, IPAddress &ip);
+};
+
+extern DnsCache dnsCache;
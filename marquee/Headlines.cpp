@@ -0,0 +1,442 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "Headlines.h"
+#include "DisplayText.h"
+
+Headlines headlines;
+
+static const char MONTH_NAMES[] PROGMEM = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+#define DICTIONARY_CODES 127
+#define DICTIONARY_ESCAPE 0xFF
+
+// Code 0x80 + n stands for entry n. Sorted by first character (longest first
+// within one) so the coder only looks at the entries that can match.
+static const char DICTIONARY[DICTIONARY_CODES][14] PROGMEM = {
+  " about ", " after ", " could ", " govern", " people", " report", " their ", " would ", " from ", " have ",
+  " into ", " more ", " over ", " said ", " says ", " state", " than ", " that ", " this ", " will ",
+  " with ", " and ", " are ", " but ", " for ", " has ", " his ", " its ", " new ", " not ", " the ",
+  " was ", " year", " as ", " at ", " be ", " by ", " in ", " is ", " of ", " on ", " to ", "'s ", ", ",
+  "-and-", "-for-", "-the-", "-in-", "-of-", "-to-", ".co.uk/", ".com/", ".html", ".org/", ". ",
+  "/technology/", "/business/", "/politics/", "/article", "/sport/", "/world/", "/news/", "/202", "?utm_",
+  "The ", "all", "ate", "al", "an", "ar", "as", "at", "con", "co", "d ", "de", "ed ", "ent", "er ", "ers",
+  "es ", "est", "e ", "ed", "en", "er", "es", "https://", "http://", "ha", "he", "hi", "ing ", "ing", "ion",
+  "in", "io", "is", "it", "le", "ment", "me", "nd", "ng", "nt", "of", "on", "or", "ou", "pro", "res", "re",
+  "ri", "s ", "se", "st", "tion", "ter", "t ", "te", "th", "ti", "to", "ver", "ve", "www.", "y "
+};
+
+// Empties the store for a new update -- which headlines were scrolled is kept
+void Headlines::clear() {
+  count = 0;
+  used = 0;
+  cursor = 0;
+}
+
+// Cleaned up for the display and packed into the arena, newest first. Older
+// headlines are trimmed to their title, then pushed out, to make room for a
+// newer one. False for duplicates and when it doesn't make the cut.
+boolean Headlines::add(const char* title, const char* url, const char* description, time_t published) {
+  String cleanTitle = cleanText(title);
+  uint32_t hash = hashTitle(cleanTitle.c_str());
+  if (hash == 0) {
+    return false;
+  }
+  for (int inx = 0; inx < count; inx++) {
+    if (items[inx].hash == hash) {
+      duplicates++;
+      return false;
+    }
+  }
+  if (count >= HEADLINE_COUNT) {
+    if (published <= (time_t)items[count - 1].published) {
+      return false;
+    }
+    remove(count - 1);
+  }
+  String cleanDescription = cleanText(description);
+  int titleSize = encode(cleanTitle.c_str(), HEADLINE_TITLE_LEN - 1, nullptr, 255);
+  int urlSize = encode(url, HEADLINE_URL_LEN - 1, nullptr, 255);
+  int descriptionSize = encode(cleanDescription.c_str(), HEADLINE_DESCRIPTION_LEN - 1, nullptr, 255);
+  while (used + 3 + titleSize + urlSize + descriptionSize > HEADLINE_ARENA_BYTES) {
+    if (stripOlder(published)) {
+      continue;
+    }
+    if (urlSize + descriptionSize > 0) {
+      urlSize = 0; // this one is the oldest -- it can have its title
+      descriptionSize = 0;
+    } else if (count > 0 && published > (time_t)items[count - 1].published) {
+      remove(count - 1);
+    } else {
+      return false;
+    }
+  }
+
+  // behind every headline at least as new, so equal times keep the order they came in
+  int position = count;
+  while (position > 0 && (time_t)items[position - 1].published < published) {
+    items[position] = items[position - 1];
+    position--;
+  }
+  Headline &item = items[position];
+  item.hash = hash;
+  item.published = published;
+  item.offset = used;
+  uint8_t* record = arena + used;
+  record[0] = titleSize;
+  record[1] = urlSize;
+  record[2] = descriptionSize;
+  record += 3;
+  record += encode(cleanTitle.c_str(), HEADLINE_TITLE_LEN - 1, record, titleSize);
+  record += encode(url, HEADLINE_URL_LEN - 1, record, urlSize);
+  encode(cleanDescription.c_str(), HEADLINE_DESCRIPTION_LEN - 1, record, descriptionSize);
+  used += 3 + titleSize + urlSize + descriptionSize;
+  count++;
+  return true;
+}
+
+int Headlines::recordSize(int index) {
+  const uint8_t* record = arena + items[index].offset;
+  return 3 + record[0] + record[1] + record[2];
+}
+
+// Gives the arena bytes of a record past its first keep back, closing the gap
+void Headlines::release(int index, int keep) {
+  int start = items[index].offset + keep;
+  int end = items[index].offset + recordSize(index);
+  memmove(arena + start, arena + end, used - end);
+  used -= end - start;
+  for (int inx = 0; inx < count; inx++) {
+    if (items[inx].offset > items[index].offset) {
+      items[inx].offset -= end - start;
+    }
+  }
+}
+
+void Headlines::remove(int index) {
+  release(index, 0);
+  count--;
+  for (int inx = index; inx < count; inx++) {
+    items[inx] = items[inx + 1];
+  }
+}
+
+// Drops the URL and description of the oldest headline still having them, of those older than published
+boolean Headlines::stripOlder(uint32_t published) {
+  for (int inx = count - 1; inx >= 0 && items[inx].published < published; inx--) {
+    uint8_t* record = arena + items[inx].offset;
+    if (record[1] + record[2] > 0) {
+      release(inx, 3 + record[0]);
+      record[1] = 0;
+      record[2] = 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+boolean Headlines::isFull() {
+  return count >= HEADLINE_COUNT;
+}
+
+int Headlines::getCount() {
+  return count;
+}
+
+// The newest headline not scrolled yet; once all have been, they take turns again
+int Headlines::next() {
+  if (count == 0) {
+    return -1;
+  }
+  for (int inx = 0; inx < count; inx++) {
+    uint32_t hash = items[inx].hash;
+    if (!isSeen(hash)) {
+      markSeen(hash);
+      cursor = inx + 1;
+      return inx;
+    }
+  }
+  int index = cursor % count;
+  cursor = index + 1;
+  return index;
+}
+
+// Hands a headline from next() back when it didn't make it onto the display
+void Headlines::unshow(int index) {
+  if (index < 0 || index >= count) {
+    return;
+  }
+  for (int inx = 0; inx < HEADLINE_SEEN_COUNT; inx++) {
+    if (seen[inx] == items[index].hash) {
+      seen[inx] = 0; // 0 is never a title's hash
+    }
+  }
+  cursor = index;
+}
+
+boolean Headlines::isSeen(uint32_t hash) {
+  for (int inx = 0; inx < HEADLINE_SEEN_COUNT; inx++) {
+    if (seen[inx] == hash) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Headlines::markSeen(uint32_t hash) {
+  seen[seenNext] = hash;
+  seenNext = (seenNext + 1) % HEADLINE_SEEN_COUNT;
+}
+
+// field 0 = title, 1 = url, 2 = description; decoded into buffer, "" for no such headline
+size_t Headlines::readText(int index, int field, char* buffer, size_t size) {
+  if (index < 0 || index >= count) {
+    buffer[0] = '\0';
+    return 0;
+  }
+  const uint8_t* record = arena + items[index].offset;
+  const uint8_t* text = record + 3;
+  for (int inx = 0; inx < field; inx++) {
+    text += record[inx];
+  }
+  return decode(text, record[field], buffer, size);
+}
+
+String Headlines::readText(int index, int field) {
+  char text[HEADLINE_DESCRIPTION_LEN];
+  readText(index, field, text, sizeof(text));
+  return String(text);
+}
+
+String Headlines::getTitle(int index) {
+  return readText(index, 0);
+}
+
+size_t Headlines::getTitle(int index, char* buffer, size_t size) {
+  return readText(index, 0, buffer, size);
+}
+
+// Empty once the headline has been trimmed to make room
+String Headlines::getUrl(int index) {
+  return readText(index, 1);
+}
+
+String Headlines::getDescription(int index) {
+  return readText(index, 2);
+}
+
+time_t Headlines::getPublished(int index) {
+  return index >= 0 && index < count ? items[index].published : 0;
+}
+
+unsigned long Headlines::getDuplicates() {
+  return duplicates;
+}
+
+int Headlines::getBytesUsed() {
+  return used;
+}
+
+int Headlines::getTitlesOnly() {
+  int titlesOnly = 0;
+  for (int inx = 0; inx < count; inx++) {
+    const uint8_t* record = arena + items[inx].offset;
+    if (record[1] + record[2] == 0) {
+      titlesOnly++;
+    }
+  }
+  return titlesOnly;
+}
+
+// Greedy: the longest dictionary entry that matches, else the byte itself. At most
+// maxText characters are read and outSize bytes written; out may be nullptr to
+// just count. Returns the bytes written (or that would be).
+int Headlines::encode(const char* text, int maxText, uint8_t* out, int outSize) {
+  int written = 0;
+  for (int inx = 0; inx < maxText && text[inx] != '\0';) {
+    uint8_t c = text[inx];
+    int code = -1;
+    int matched = 1;
+    if (HEADLINE_COMPRESSION) {
+      // first entry starting with c
+      int low = 0;
+      int high = DICTIONARY_CODES;
+      while (low < high) {
+        int middle = (low + high) / 2;
+        if ((uint8_t)pgm_read_byte(&DICTIONARY[middle][0]) < c) {
+          low = middle + 1;
+        } else {
+          high = middle;
+        }
+      }
+      for (int entry = low; entry < DICTIONARY_CODES && (uint8_t)pgm_read_byte(&DICTIONARY[entry][0]) == c; entry++) {
+        int length = strlen_P(DICTIONARY[entry]);
+        if (inx + length <= maxText && strncmp_P(text + inx, DICTIONARY[entry], length) == 0) {
+          code = 0x80 + entry;
+          matched = length;
+          break;
+        }
+      }
+    }
+    int size = (code < 0 && c >= 0x80 && HEADLINE_COMPRESSION) ? 2 : 1;
+    if (written + size > outSize) {
+      break;
+    }
+    if (out != nullptr) {
+      if (code >= 0) {
+        out[written] = code;
+      } else if (size == 2) {
+        out[written] = DICTIONARY_ESCAPE;
+        out[written + 1] = c;
+      } else {
+        out[written] = c;
+      }
+    }
+    written += size;
+    inx += matched;
+  }
+  return written;
+}
+
+// Into buffer, cut short if it doesn't fit. Returns the length.
+size_t Headlines::decode(const uint8_t* data, int length, char* buffer, size_t size) {
+  size_t written = 0;
+  for (int inx = 0; inx < length && written + 1 < size; inx++) {
+    uint8_t c = data[inx];
+    if (!HEADLINE_COMPRESSION || c < 0x80) {
+      buffer[written++] = c;
+    } else if (c == DICTIONARY_ESCAPE) {
+      if (++inx < length) {
+        buffer[written++] = data[inx];
+      }
+    } else {
+      const char* entry = DICTIONARY[c - 0x80];
+      for (char letter = pgm_read_byte(entry); letter != '\0' && written + 1 < size; letter = pgm_read_byte(++entry)) {
+        buffer[written++] = letter;
+      }
+    }
+  }
+  buffer[written] = '\0';
+  return written;
+}
+
+// FNV-1a over the letters and digits in lower case. A short " - Reuters" / " | BBC" style
+// suffix is left off so the same wire story from two outlets hashes the same. 0 = no text.
+uint32_t Headlines::hashTitle(const char* title) {
+  size_t length = strlen(title);
+  for (size_t inx = length; inx > 20 && length - inx < 32; inx--) {
+    char c = title[inx - 1];
+    if ((c == '-' || c == '|') && inx >= 2 && title[inx - 2] == ' ' && title[inx] == ' ') {
+      length = inx - 2;
+      break;
+    }
+  }
+  uint32_t hash = 2166136261UL;
+  boolean any = false;
+  for (size_t inx = 0; inx < length; inx++) {
+    unsigned char c = title[inx];
+    if (isalnum(c)) {
+      hash ^= (uint8_t)tolower(c);
+      hash *= 16777619UL;
+      any = true;
+    }
+  }
+  return any ? hash : 0;
+}
+
+// "2024-05-01T12:34:56Z" or "+02:00" (NewsAPI, Atom), "Wed, 01 May 2024 12:34:56 GMT" or "+0200" (RSS).
+// UTC, or 0 when the text can't be read.
+time_t Headlines::parseTime(const char* text) {
+  int year = 0, month = 0, dayOfMonth = 0, hours = 0, minutes = 0, seconds = 0;
+  char zone[8] = {0};
+  while (*text == ' ') {
+    text++;
+  }
+  if (isdigit((unsigned char)text[0]) && text[4] == '-') {
+    if (sscanf(text, "%4d-%2d-%2dT%2d:%2d:%2d", &year, &month, &dayOfMonth, &hours, &minutes, &seconds) < 3) {
+      return 0;
+    }
+    const char* rest = strlen(text) > 19 ? text + 19 : "";
+    while (*rest == '.' || isdigit((unsigned char)*rest)) {
+      rest++; // fractions of a second
+    }
+    strlcpy(zone, rest, sizeof(zone));
+  } else {
+    const char* comma = strchr(text, ',');
+    char monthName[4] = {0};
+    if (sscanf(comma != nullptr ? comma + 1 : text, " %d %3s %d %d:%d:%d %7s", &dayOfMonth, monthName, &year, &hours, &minutes, &seconds, zone) < 5) {
+      return 0;
+    }
+    char months[sizeof(MONTH_NAMES)];
+    strcpy_P(months, MONTH_NAMES);
+    const char* found = strstr(months, monthName);
+    if (strlen(monthName) != 3 || found == nullptr || (found - months) % 3 != 0) {
+      return 0;
+    }
+    month = (found - months) / 3 + 1;
+    if (year < 100) {
+      year += 2000;
+    }
+  }
+  if (year < 1970 || month < 1 || month > 12 || dayOfMonth < 1 || dayOfMonth > 31) {
+    return 0;
+  }
+  tmElements_t tm;
+  tm.Year = CalendarYrToTm(year);
+  tm.Month = month;
+  tm.Day = dayOfMonth;
+  tm.Hour = hours;
+  tm.Minute = minutes;
+  tm.Second = seconds;
+  return makeTime(tm) - parseZone(zone);
+}
+
+// Seconds east of UTC for "Z", "+02:00", "-0500", "GMT", "EST" ...
+long Headlines::parseZone(const char* zone) {
+  if (zone[0] == '+' || zone[0] == '-') {
+    int digits[4] = {0};
+    int found = 0;
+    for (const char* c = zone + 1; *c != '\0' && found < 4; c++) {
+      if (isdigit((unsigned char)*c)) {
+        digits[found++] = *c - '0';
+      }
+    }
+    long offset = (digits[0] * 10 + digits[1]) * 3600L + (digits[2] * 10 + digits[3]) * 60L;
+    return zone[0] == '-' ? -offset : offset;
+  }
+  static const struct { const char* name; int8_t hours; } names[] = {
+    {"EST", -5}, {"EDT", -4}, {"CST", -6}, {"CDT", -5}, {"MST", -7}, {"MDT", -6}, {"PST", -8}, {"PDT", -7}
+  };
+  for (const auto &name : names) {
+    if (strncmp(zone, name.name, 3) == 0) {
+      return name.hours * 3600L;
+    }
+  }
+  return 0; // Z, GMT, UT, UTC or nothing
+}
+
+String Headlines::cleanText(String text) {
+  text.remove(DisplayText::clean(text.begin()));
+  return text;
+}
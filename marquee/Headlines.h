@@ -0,0 +1,108 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <Arduino.h>
+#include <TimeLib.h>
+
+#define HEADLINE_ARENA_BYTES 4096 // text of every headline shares this budget
+#define HEADLINE_COUNT 64         // most headlines kept, whatever the budget still has room for
+#define HEADLINE_COMPRESSION true // store text with the short-string dictionary coder
+#define HEADLINE_TITLE_LEN 128
+#define HEADLINE_URL_LEN 160
+#define HEADLINE_DESCRIPTION_LEN 200
+#define HEADLINE_SEEN_COUNT 64   // title hashes of headlines already scrolled
+
+/* Fixed-size headline storage shared by the news sources and read by
+   the ticker and the web page. The text lives in one byte arena and the
+   index only keeps offsets, so a full store costs the same however the
+   headlines were fetched, and the budget is set in bytes, not articles.
+
+   Text is packed with a static dictionary: common words and URL pieces
+   become one byte codes 0x80-0xFE, 0xFF escapes a literal byte with the
+   top bit set. Headlines and feed URLs shrink by about a third.
+
+   Several sources can add to one update. Titles are compared by a hash of
+   their letters and digits (any trailing " - Source" left off), so a story
+   carried by overlapping feeds is kept once and the copy is never stored.
+   Headlines are read back newest first. When the arena runs short the
+   oldest headlines give up their URL and description before any is
+   pushed out, so the ticker keeps its titles the longest.
+*/
+class Headlines {
+
+public:
+  void clear();
+  boolean add(const char* title, const char* url, const char* description, time_t published);
+  boolean isFull();
+  int getCount();
+  int next();
+  void unshow(int index);
+
+  String getTitle(int index);
+  size_t getTitle(int index, char* buffer, size_t size);
+  String getUrl(int index);
+  String getDescription(int index);
+  time_t getPublished(int index);
+  unsigned long getDuplicates();
+  int getBytesUsed();
+  int getTitlesOnly();
+
+  static String cleanText(String text);
+  static uint32_t hashTitle(const char* title);
+  static time_t parseTime(const char* text);
+
+private:
+  // A record in the arena is three length bytes (title, url, description as
+  // stored) followed by the three texts
+  typedef struct {
+    uint32_t hash;
+    uint32_t published;  // UTC, 0 when the source didn't say
+    uint16_t offset;     // of the record in the arena
+  } Headline;
+
+  Headline items[HEADLINE_COUNT];   // newest first
+  uint8_t arena[HEADLINE_ARENA_BYTES];
+  int used = 0;
+  int count = 0;
+  unsigned long duplicates = 0;
+
+  uint32_t seen[HEADLINE_SEEN_COUNT] = {0};
+  int seenNext = 0;
+  int cursor = 0;   // round robin once every headline has been scrolled
+
+  int recordSize(int index);
+  void release(int index, int keep);
+  void remove(int index);
+  boolean stripOlder(uint32_t published);
+  size_t readText(int index, int field, char* buffer, size_t size);
+  String readText(int index, int field);
+  boolean isSeen(uint32_t hash);
+  void markSeen(uint32_t hash);
+  static long parseZone(const char* zone);
+  static int encode(const char* text, int maxText, uint8_t* out, int outSize);
+  static size_t decode(const uint8_t* data, int length, char* buffer, size_t size);
+};
+
+extern Headlines headlines;
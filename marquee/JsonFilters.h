@@ -0,0 +1,62 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <Arduino.h>
+
+/* The fields each client reads from its replies, as ArduinoJson filter
+   documents in PROGMEM. deserializeJson() drops everything else while it
+   reads, so the documents stay small whatever upstream sends. They live here
+   so the host benchmark (test/bench_json_budget.cpp) parses with the very
+   same filters as the clients.
+*/
+
+// OpenWeatherMap: each entry of the group response
+static const char WEATHER_FILTER[] PROGMEM = "{\"message\":true,\"list\":[{"
+    "\"coord\":{\"lon\":true,\"lat\":true},\"dt\":true,\"name\":true,\"sys\":{\"country\":true,\"timezone\":true},"
+    "\"main\":{\"temp\":true,\"humidity\":true,\"pressure\":true,\"temp_max\":true,\"temp_min\":true},"
+    "\"weather\":[{\"main\":true,\"id\":true,\"description\":true,\"icon\":true}],\"wind\":{\"speed\":true,\"deg\":true}}]}";
+
+// OctoPrint: /api/job
+static const char JOB_FILTER[] PROGMEM = "{\"job\":{\"averagePrintTime\":true,\"estimatedPrintTime\":true,\"lastPrintTime\":true,"
+    "\"file\":{\"name\":true,\"size\":true}},"
+    "\"progress\":{\"completion\":true,\"filepos\":true,\"printTime\":true,\"printTimeLeft\":true},\"state\":true}";
+
+// OctoPrint: push messages -- "current" and "history" have the same layout
+#define PUSH_MESSAGE_FILTER_FIELDS "{\"state\":{\"text\":true},\"job\":{\"file\":{\"name\":true,\"size\":true}," \
+    "\"estimatedPrintTime\":true,\"averagePrintTime\":true,\"lastPrintTime\":true},\"progress\":true}"
+static const char PUSH_FILTER[] PROGMEM = "{\"current\":" PUSH_MESSAGE_FILTER_FIELDS ",\"history\":" PUSH_MESSAGE_FILTER_FIELDS ",\"reauthRequired\":true}";
+
+// Pi-hole: one per API reply
+static const char LOGIN_FILTER[] PROGMEM = "{\"dns\":true}";
+static const char SUMMARY_FILTER[] PROGMEM = "{\"queries\":{\"total\":true,\"blocked\":true,\"percent_blocked\":true,"
+    "\"unique_domains\":true,\"forwarded\":true,\"cached\":true},\"gravity\":{\"domains_being_blocked\":true},"
+    "\"types\":true,\"clients\":{\"total\":true,\"active\":true},"
+    "\"replies\":{\"NODATA\":true,\"NXDOMAIN\":true,\"CNAME\":true,\"IP\":true},\"privacy_level\":true}";
+static const char TOP_CLIENTS_FILTER[] PROGMEM = "{\"top_sources_blocked\":true}";
+static const char AUTH_FILTER[] PROGMEM = "{\"session\":{\"sid\":true}}";
+static const char HISTORY_FILTER[] PROGMEM = "{\"history\":[{\"blocked\":true}]}";
+
+// TimeZoneDB: get-time-zone
+static const char TIME_FILTER[] PROGMEM = "{\"status\":true,\"message\":true,\"timestamp\":true,\"gmtOffset\":true,\"dst\":true,\"zoneEnd\":true}";
@@ -0,0 +1,202 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "JsonLimits.h"
+
+JsonArena jsonArena;
+
+// Round up so every payload stays 8 byte aligned
+static size_t alignSize(size_t size) {
+  return (size + 7) & ~((size_t)7);
+}
+
+uint8_t* JsonArena::header(void* ptr) {
+  return (uint8_t*)ptr - HEADER_SIZE;
+}
+
+void* JsonArena::allocate(size_t size) {
+  size_t needed = HEADER_SIZE + alignSize(size);
+  if (top + needed > JSON_ARENA_SIZE) {
+    failures++;
+    Serial.println("JSON arena full: " + String(top + needed) + " > " + String(JSON_ARENA_SIZE) + " bytes");
+    return nullptr;
+  }
+  uint8_t* block = buffer + top;
+  *(size_t*)block = size;
+  lastBlock = top;
+  top += needed;
+  liveBlocks++;
+  if (top > highWater) {
+    highWater = top;
+  }
+  return block + HEADER_SIZE;
+}
+
+void JsonArena::deallocate(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  liveBlocks--;
+  if (liveBlocks <= 0) {
+    // nothing alive any more -- start again from the bottom
+    liveBlocks = 0;
+    top = 0;
+    lastBlock = 0;
+    resets++;
+  } else if (header(ptr) == buffer + lastBlock) {
+    // freeing the top block; the one below it is unknown, so just drop the top
+    top = lastBlock;
+  }
+}
+
+void* JsonArena::reallocate(void* ptr, size_t newSize) {
+  if (ptr == nullptr) {
+    return allocate(newSize);
+  }
+  uint8_t* block = header(ptr);
+  size_t oldSize = *(size_t*)block;
+  if (block == buffer + lastBlock) {
+    // the top block can grow or shrink in place
+    size_t newTop = lastBlock + HEADER_SIZE + alignSize(newSize);
+    if (newTop > JSON_ARENA_SIZE) {
+      failures++;
+      return nullptr;
+    }
+    *(size_t*)block = newSize;
+    top = newTop;
+    if (top > highWater) {
+      highWater = top;
+    }
+    return ptr;
+  }
+  if (newSize <= oldSize) {
+    *(size_t*)block = newSize;
+    return ptr;
+  }
+  // somewhere below the top -- move it up; the old space comes back at the next reset
+  void* moved = allocate(newSize);
+  if (moved == nullptr) {
+    return nullptr;
+  }
+  memcpy(moved, ptr, oldSize);
+  liveBlocks--;
+  return moved;
+}
+
+size_t JsonArena::sizeOf(void* ptr) {
+  return *(size_t*)header(ptr);
+}
+
+size_t JsonArena::getCapacity() {
+  return JSON_ARENA_SIZE;
+}
+
+size_t JsonArena::getHighWater() {
+  return highWater;
+}
+
+unsigned long JsonArena::getResets() {
+  return resets;
+}
+
+unsigned long JsonArena::getFailures() {
+  return failures;
+}
+
+JsonBudget::JsonBudget(const char* name, size_t ceiling) {
+  this->name = name;
+  this->ceiling = ceiling;
+}
+
+boolean JsonBudget::reserve(size_t size) {
+  if (used + size > ceiling) {
+    overruns++;
+    Serial.println(String(name) + " JSON over budget: " + String(used + size) + " > " + String(ceiling) + " bytes");
+    return false;
+  }
+  used += size;
+  if (used > peak) {
+    peak = used;
+  }
+  return true;
+}
+
+void* JsonBudget::allocate(size_t size) {
+  if (!reserve(size)) {
+    return nullptr;
+  }
+  void* ptr = jsonArena.allocate(size);
+  if (ptr == nullptr) {
+    used -= size;
+  }
+  return ptr;
+}
+
+void JsonBudget::deallocate(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  used -= jsonArena.sizeOf(ptr);
+  jsonArena.deallocate(ptr);
+}
+
+void* JsonBudget::reallocate(void* ptr, size_t newSize) {
+  if (ptr == nullptr) {
+    return allocate(newSize);
+  }
+  size_t oldSize = jsonArena.sizeOf(ptr);
+  if (newSize > oldSize && !reserve(newSize - oldSize)) {
+    return nullptr;
+  }
+  void* resized = jsonArena.reallocate(ptr, newSize);
+  if (resized == nullptr) {
+    if (newSize > oldSize) {
+      used -= newSize - oldSize;
+    }
+    return nullptr;
+  }
+  if (newSize < oldSize) {
+    used -= oldSize - newSize;
+  }
+  return resized;
+}
+
+const char* JsonBudget::getName() {
+  return name;
+}
+
+size_t JsonBudget::getCeiling() {
+  return ceiling;
+}
+
+size_t JsonBudget::getUsed() {
+  return used;
+}
+
+size_t JsonBudget::getPeak() {
+  return peak;
+}
+
+unsigned long JsonBudget::getOverruns() {
+  return overruns;
+}
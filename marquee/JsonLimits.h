@@ -0,0 +1,114 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// ArduinoJson 7 takes its slots in pools of 128, one allocation each: 16 bytes
+// a slot (2 KB a pool) up to 7.2, 8 bytes (1 KB) from 7.3 on. Even a one-field
+// document needs a whole pool, so the ceilings are counted in 7.2-sized pools
+// plus room for the strings. test/bench_json_budget.cpp measures the peaks
+// against recorded replies.
+#define JSON_POOL_SIZE 2048
+
+// Memory ceilings (bytes) for a single parse, per client. The filters keep the
+// documents below these; hitting one means the upstream sent something odd.
+#define JSON_BUDGET_WEATHER   (2 * JSON_POOL_SIZE + 2048)   // five cities, ~120 fields
+#define JSON_BUDGET_OCTOPRINT (1 * JSON_POOL_SIZE + 2048)   // a long file name
+#define JSON_BUDGET_PIHOLE    (3 * JSON_POOL_SIZE + 2048)   // the history: 145 entries of two slots
+#define JSON_BUDGET_TIMEDB    (1 * JSON_POOL_SIZE + 1024)
+
+// The filter document is alive next to the one being parsed, on the arena itself
+#define JSON_FILTER_SIZE      (1 * JSON_POOL_SIZE + 1024)
+
+// One arena for every JSON parse -- allocated once, never from the heap.
+// It holds the biggest budget and a filter together.
+#define JSON_ARENA_SIZE (JSON_BUDGET_PIHOLE + JSON_FILTER_SIZE)
+
+/* Bump allocator over a static buffer, shared by all the data clients.
+   Parses run one after another from loop(), so there is never more than a
+   handful of documents alive at once. Blocks are carved off the top; freeing
+   the top block gives its space back, and once the last live block is freed
+   the arena starts over from the bottom. The heap never sees a JSON document,
+   so it can't be fragmented by them.
+*/
+class JsonArena : public ArduinoJson::Allocator {
+
+public:
+  void* allocate(size_t size) override;
+  void deallocate(void* ptr) override;
+  void* reallocate(void* ptr, size_t newSize) override;
+
+  size_t sizeOf(void* ptr);
+  size_t getCapacity();
+  size_t getHighWater();
+  unsigned long getResets();
+  unsigned long getFailures();
+
+private:
+  // every block carries its size (8 bytes to keep the payload aligned for doubles)
+  static const size_t HEADER_SIZE = 8;
+
+  uint8_t buffer[JSON_ARENA_SIZE] __attribute__((aligned(8)));
+  size_t top = 0;
+  size_t lastBlock = 0;   // offset of the header of the block at the top
+  int liveBlocks = 0;
+  size_t highWater = 0;
+  unsigned long resets = 0;
+  unsigned long failures = 0;
+
+  uint8_t* header(void* ptr);
+};
+
+extern JsonArena jsonArena;
+
+/* ArduinoJson allocator with a hard ceiling, drawing from the shared arena.
+   Give it to a JsonDocument and deserializeJson() fails with NoMemory instead
+   of taking more than the client's share. The live and peak usage are
+   tracked so the status page can show how close each client gets.
+*/
+class JsonBudget : public ArduinoJson::Allocator {
+
+public:
+  JsonBudget(const char* name, size_t ceiling);
+
+  void* allocate(size_t size) override;
+  void deallocate(void* ptr) override;
+  void* reallocate(void* ptr, size_t newSize) override;
+
+  const char* getName();
+  size_t getCeiling();
+  size_t getUsed();
+  size_t getPeak();
+  unsigned long getOverruns();
+
+private:
+  const char* name;
+  size_t ceiling;
+  size_t used = 0;
+  size_t peak = 0;
+  unsigned long overruns = 0;
+
+  boolean reserve(size_t size);
+};
@@ -0,0 +1,344 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "JsonPathSource.h"
+#include "DnsCache.h"
+
+JsonPathSource::JsonPathSource() : health(name) {
+  memset(paths, 0, sizeof(paths));
+  memset(values, 0, sizeof(values));
+  memset(found, 0, sizeof(found));
+}
+
+// url is http://host[:port]/path, paths are separated by ';'
+void JsonPathSource::configure(String name, String url, String header, String paths, String format, int refreshMinutes) {
+  name.trim();
+  strlcpy(this->name, name == "" ? "JSON" : name.c_str(), sizeof(this->name));
+  this->header = header;
+  this->header.trim();
+  this->format = format;
+  refreshMs = (unsigned long)max(refreshMinutes, 1) * 60 * 1000;
+  errorMessage = "";
+
+  url.trim();
+  host = "";
+  if (url.startsWith("https://")) {
+    errorMessage = "Only http:// is supported for local sources";
+  } else if (url != "") {
+    if (url.startsWith("http://")) {
+      url = url.substring(7);
+    }
+    int slash = url.indexOf('/');
+    urlPath = slash >= 0 ? url.substring(slash) : "/";
+    host = slash >= 0 ? url.substring(0, slash) : url;
+    port = 80;
+    int colon = host.indexOf(':');
+    if (colon > 0) {
+      port = host.substring(colon + 1).toInt();
+      host = host.substring(0, colon);
+    }
+  }
+
+  pathCount = 0;
+  memset(this->paths, 0, sizeof(this->paths));
+  memset(values, 0, sizeof(values));
+  memset(found, 0, sizeof(found));
+  while (paths.length() > 0 && pathCount < JSON_SOURCE_MAX_PATHS) {
+    int split = paths.indexOf(';');
+    String path = split >= 0 ? paths.substring(0, split) : paths;
+    paths = split >= 0 ? paths.substring(split + 1) : "";
+    path.trim();
+    if (path != "") {
+      strlcpy(this->paths[pathCount++], path.c_str(), JSON_SOURCE_PATH_LEN);
+    }
+  }
+  lastUpdate = 0;
+  health.reset();
+}
+
+boolean JsonPathSource::isConfigured() {
+  return host != "" && pathCount > 0;
+}
+
+boolean JsonPathSource::isDue() {
+  return isConfigured() && (lastUpdate == 0 || (millis() - lastUpdate) >= refreshMs);
+}
+
+boolean JsonPathSource::update() {
+  lastUpdate = millis() | 1;
+  if (!isConfigured() || !health.allowRequest()) {
+    return false;
+  }
+  errorMessage = "";
+  WiFiClient client;
+  client.setTimeout(5000);
+  IPAddress serverIp;
+  String request = "GET " + urlPath + " HTTP/1.0";
+  Serial.println("Getting " + String(name) + " from " + host + ":" + String(port));
+  Serial.println(request);
+  if (!dnsCache.resolve(host.c_str(), serverIp) || !client.connect(serverIp, port)) {
+    errorMessage = "Connection failed: " + host + ":" + String(port);
+    Serial.println(errorMessage);
+    health.recordFailure();
+    return false;
+  }
+  client.println(request);
+  client.println("Host: " + host);
+  if (header != "") {
+    client.println(header);
+  }
+  client.println("User-Agent: ArduinoWiFi/1.1");
+  client.println("Connection: close");
+  client.println();
+
+  unsigned long start = millis();
+  while (client.connected() && !client.available() && (millis() - start) < JSON_SOURCE_TIMEOUT_MS) delay(1); //waits for data
+  if (!client.available()) {
+    errorMessage = "No reply from " + host + ":" + String(port);
+    Serial.println(errorMessage);
+    client.stop();
+    health.recordFailure();
+    return false;
+  }
+
+  char status[32] = {0};
+  client.readBytesUntil('\r', status, sizeof(status));
+  char endOfHeaders[] = "\r\n\r\n";
+  if (strstr(status, " 200 ") == nullptr || !client.find(endOfHeaders)) {
+    errorMessage = "Unexpected response: " + String(status);
+    Serial.println(errorMessage);
+    client.stop();
+    health.recordFailure();
+    return false;
+  }
+
+  JsonStreamingParser parser;
+  parser.setListener(this);
+  startDocument();
+  lastBytes = 0;
+  lastParseMicros = 0;
+  char buff[128];
+  boolean timedOut = false;
+  while ((client.connected() || client.available()) && foundCount < pathCount) {
+    if ((millis() - start) >= JSON_SOURCE_TIMEOUT_MS) {
+      timedOut = true;
+      break;
+    }
+    size_t size = client.available();
+    if (size) {
+      int count = client.readBytes(buff, ((size > sizeof(buff)) ? sizeof(buff) : size));
+      unsigned long parseStart = micros();
+      for (int inx = 0; inx < count && foundCount < pathCount; inx++) {
+        parser.parse(buff[inx]);
+      }
+      lastParseMicros += micros() - parseStart;
+      lastBytes += count;
+    }
+    delay(1);
+  }
+  client.stop(); // we have everything we asked for -- the rest of the reply is never read
+
+  Serial.println(String(name) + ": " + String(foundCount) + "/" + String(pathCount) + " paths from " + String(lastBytes)
+                 + " bytes, parsed in " + String(lastParseMicros) + " us");
+  if (timedOut && foundCount < pathCount) {
+    // a stalled endpoint is a failing one, whatever it sent before it stalled
+    errorMessage = "Reply timed out after " + String(lastBytes) + " bytes";
+    Serial.println(errorMessage);
+    health.recordFailure();
+    return false;
+  }
+  if (foundCount == 0) {
+    errorMessage = "None of the paths were found";
+    health.recordFailure();
+    return false;
+  }
+  health.recordSuccess();
+  return true;
+}
+
+// The format with {n} replaced by the value of path n; no format lists the values
+String JsonPathSource::getText() {
+  String text = "";
+  if (format == "") {
+    for (int inx = 0; inx < pathCount; inx++) {
+      text += (inx > 0 ? " " : "") + String(shownValue(inx));
+    }
+    return text;
+  }
+  for (unsigned int inx = 0; inx < format.length(); inx++) {
+    char c = format.charAt(inx);
+    if (c == '{' && inx + 2 < format.length() && format.charAt(inx + 2) == '}' && isdigit(format.charAt(inx + 1))) {
+      int index = format.charAt(inx + 1) - '0';
+      if (index < pathCount) {
+        text += shownValue(index);
+      }
+      inx += 2;
+    } else {
+      text += c;
+    }
+  }
+  return text;
+}
+
+String JsonPathSource::getName() {
+  return String(name);
+}
+
+String JsonPathSource::getValue(int index) {
+  return String(shownValue(index));
+}
+
+const char* JsonPathSource::shownValue(int index) {
+  return found[index] ? values[index] : JSON_SOURCE_MISSING;
+}
+
+int JsonPathSource::getPathCount() {
+  return pathCount;
+}
+
+int JsonPathSource::getFoundCount() {
+  return foundCount;
+}
+
+unsigned long JsonPathSource::getLastParseMicros() {
+  return lastParseMicros;
+}
+
+unsigned long JsonPathSource::getLastBytes() {
+  return lastBytes;
+}
+
+String JsonPathSource::getError() {
+  return errorMessage;
+}
+
+SourceHealth &JsonPathSource::getHealth() {
+  return health;
+}
+
+// Path tracking: current holds the path of the value being parsed,
+// e.g. "data.result[0].value[1]"; every container remembers where its part starts
+
+void JsonPathSource::setPathLength(uint8_t length) {
+  currentLength = length;
+  current[currentLength] = '\0';
+}
+
+void JsonPathSource::appendPath(const char* segment, boolean separator) {
+  if (separator && currentLength > 0 && currentLength < sizeof(current) - 1) {
+    current[currentLength++] = '.';
+  }
+  while (*segment != '\0' && currentLength < sizeof(current) - 1) {
+    current[currentLength++] = *segment++;
+  }
+  current[currentLength] = '\0';
+}
+
+// A new value, object or array starts -- inside an array that is the next element
+void JsonPathSource::beginValue() {
+  if (depth == 0 || depth > JSON_SOURCE_MAX_DEPTH) {
+    return;
+  }
+  Level &level = stack[depth - 1];
+  if (level.array) {
+    level.index++;
+    setPathLength(level.pathLength);
+    char segment[8];
+    snprintf(segment, sizeof(segment), "[%d]", level.index);
+    appendPath(segment, false);
+  }
+}
+
+void JsonPathSource::push(boolean array) {
+  if (depth < JSON_SOURCE_MAX_DEPTH) {
+    stack[depth].array = array;
+    stack[depth].index = -1;
+    stack[depth].pathLength = currentLength;
+  }
+  depth++; // deeper levels are counted but not tracked -- nothing configured can match there
+}
+
+void JsonPathSource::pop() {
+  if (depth == 0) {
+    return;
+  }
+  depth--;
+  if (depth < JSON_SOURCE_MAX_DEPTH) {
+    setPathLength(stack[depth].pathLength);
+  }
+}
+
+void JsonPathSource::whitespace(char c) {
+}
+
+void JsonPathSource::startDocument() {
+  depth = 0;
+  foundCount = 0;
+  memset(found, 0, sizeof(found));
+  memset(values, 0, sizeof(values)); // nothing from the last reply may be shown as this one's
+  setPathLength(0);
+}
+
+void JsonPathSource::key(String key) {
+  if (depth == 0 || depth > JSON_SOURCE_MAX_DEPTH) {
+    return;
+  }
+  setPathLength(stack[depth - 1].pathLength);
+  appendPath(key.c_str(), true);
+}
+
+void JsonPathSource::value(String value) {
+  beginValue();
+  if (depth > JSON_SOURCE_MAX_DEPTH) {
+    return;
+  }
+  for (int inx = 0; inx < pathCount; inx++) {
+    if (!found[inx] && strcmp(current, paths[inx]) == 0) {
+      strlcpy(values[inx], value.c_str(), JSON_SOURCE_VALUE_LEN);
+      found[inx] = true;
+      foundCount++;
+    }
+  }
+}
+
+void JsonPathSource::startObject() {
+  beginValue();
+  push(false);
+}
+
+void JsonPathSource::startArray() {
+  beginValue();
+  push(true);
+}
+
+void JsonPathSource::endObject() {
+  pop();
+}
+
+void JsonPathSource::endArray() {
+  pop();
+}
+
+void JsonPathSource::endDocument() {
+}
@@ -0,0 +1,116 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <ESP8266WiFi.h>
+#include <JsonListener.h>
+#include <JsonStreamingParser.h> // --> https://github.com/squix78/json-streaming-parser
+#include "SourceHealth.h"
+
+#define MAX_JSON_SOURCES 3
+#define JSON_SOURCE_MAX_PATHS 4
+#define JSON_SOURCE_PATH_LEN 48   // longest configured path, e.g. "data.result[0].value[1]"
+#define JSON_SOURCE_VALUE_LEN 32  // values are cut to this
+#define JSON_SOURCE_MISSING "--"  // shown for a path the last reply didn't have
+#define JSON_SOURCE_TIMEOUT_MS 10000 // for the whole reply -- a local endpoint that stalls longer counts as down
+#define JSON_SOURCE_MAX_DEPTH 12
+#define JSON_SOURCE_NAME_LEN 16
+
+/* Data source for any local HTTP endpoint that returns JSON (Home Assistant,
+   Prometheus, a CI server ...). Values are picked out by path, e.g.
+     "state;attributes.unit_of_measurement"
+     "data.result[0].value[1]"
+   and put into a format template as {0}..{3}. The reply is run through a
+   streaming matcher: only the current path is tracked (never the document),
+   each value is compared against the wanted paths as it goes by, and the
+   connection is dropped as soon as every path has been found.
+*/
+class JsonPathSource: public JsonListener {
+
+public:
+  JsonPathSource();
+  void configure(String name, String url, String header, String paths, String format, int refreshMinutes);
+  boolean isConfigured();
+  boolean isDue();
+  boolean update();
+
+  String getText();
+  String getName();
+  String getValue(int index);
+  int getPathCount();
+  int getFoundCount();
+  unsigned long getLastParseMicros();
+  unsigned long getLastBytes();
+  String getError();
+  SourceHealth &getHealth();
+
+  virtual void whitespace(char c);
+  virtual void startDocument();
+  virtual void key(String key);
+  virtual void value(String value);
+  virtual void endArray();
+  virtual void endObject();
+  virtual void endDocument();
+  virtual void startArray();
+  virtual void startObject();
+
+private:
+  typedef struct {
+    boolean array;
+    int index;          // current element, arrays only
+    uint8_t pathLength; // length of the path up to this container
+  } Level;
+
+  char name[JSON_SOURCE_NAME_LEN] = "JSON";
+  SourceHealth health;
+  String host = "";
+  int port = 80;
+  String urlPath = "/";
+  String header = "";
+  String format = "";
+  unsigned long refreshMs = 5 * 60 * 1000UL;
+  unsigned long lastUpdate = 0;
+  String errorMessage = "";
+
+  char paths[JSON_SOURCE_MAX_PATHS][JSON_SOURCE_PATH_LEN];
+  char values[JSON_SOURCE_MAX_PATHS][JSON_SOURCE_VALUE_LEN];
+  boolean found[JSON_SOURCE_MAX_PATHS];
+  int pathCount = 0;
+  int foundCount = 0;
+  unsigned long lastParseMicros = 0;
+  unsigned long lastBytes = 0;
+
+  // streaming matcher state
+  char current[JSON_SOURCE_PATH_LEN * 2];
+  uint8_t currentLength = 0;
+  Level stack[JSON_SOURCE_MAX_DEPTH];
+  int depth = 0;
+
+  const char* shownValue(int index);
+  void beginValue();
+  void push(boolean array);
+  void pop();
+  void setPathLength(uint8_t length);
+  void appendPath(const char* segment, boolean separator);
+};
@@ -0,0 +1,128 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "MarqueeText.h"
+
+// Formatted segments of whichever text is scrolling -- two, so the segment
+// going off screen and the one coming on are both at hand
+typedef struct {
+  const void *owner;
+  int segment;
+  uint16_t length;
+  char text[MARQUEE_SEGMENT_LEN];
+} FormattedSegment;
+
+static FormattedSegment formatted[2];
+static int formattedNext = 0;
+
+MarqueeText::~MarqueeText() {
+  forget();
+}
+
+void MarqueeText::clear() {
+  forget();
+  count = 0;
+  total = 0;
+}
+
+boolean MarqueeText::add(const char *text) {
+  if (count >= MARQUEE_SEGMENTS) {
+    return false;
+  }
+  Segment &segment = segments[count];
+  segment.text = text;
+  segment.formatter = nullptr;
+  segment.arg = 0;
+  segment.length = strlen(text);
+  total += segment.length;
+  count++;
+  return true;
+}
+
+// Formatted once now to measure it, and again whenever it scrolls into view
+boolean MarqueeText::add(SegmentFormatter formatter, int arg) {
+  if (count >= MARQUEE_SEGMENTS) {
+    return false;
+  }
+  Segment &segment = segments[count];
+  segment.text = nullptr;
+  segment.formatter = formatter;
+  segment.arg = arg;
+  segment.length = 0;
+  count++;
+  format(count - 1, segment.length);
+  total += segment.length;
+  return true;
+}
+
+size_t MarqueeText::length() {
+  return total;
+}
+
+int MarqueeText::getSegmentCount() {
+  return count;
+}
+
+char MarqueeText::charAt(size_t position) {
+  for (int inx = 0; inx < count; inx++) {
+    Segment &segment = segments[inx];
+    if (position >= segment.length) {
+      position -= segment.length;
+      continue;
+    }
+    if (segment.formatter == nullptr) {
+      return segment.text[position];
+    }
+    uint16_t length;
+    const char *text = format(inx, length);
+    return position < length ? text[position] : ' ';
+  }
+  return ' ';
+}
+
+const char *MarqueeText::format(int segment, uint16_t &length) {
+  for (int inx = 0; inx < 2; inx++) {
+    if (formatted[inx].owner == this && formatted[inx].segment == segment) {
+      length = formatted[inx].length;
+      return formatted[inx].text;
+    }
+  }
+  FormattedSegment &slot = formatted[formattedNext];
+  formattedNext = (formattedNext + 1) % 2;
+  slot.text[0] = '\0';
+  segments[segment].formatter(segments[segment].arg, slot.text, sizeof(slot.text));
+  slot.owner = this;
+  slot.segment = segment;
+  slot.length = strnlen(slot.text, sizeof(slot.text) - 1);
+  length = slot.length;
+  return slot.text;
+}
+
+void MarqueeText::forget() {
+  for (int inx = 0; inx < 2; inx++) {
+    if (formatted[inx].owner == this) {
+      formatted[inx].owner = nullptr;
+    }
+  }
+}
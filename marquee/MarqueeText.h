@@ -0,0 +1,69 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <Arduino.h>
+
+#define MARQUEE_SEGMENTS 20
+#define MARQUEE_SEGMENT_LEN 200   // longest text a formatter can produce
+
+// Writes one segment's text into buffer -- arg is whatever was passed to add()
+typedef void (*SegmentFormatter)(int arg, char *buffer, size_t size);
+
+/* The text of one scroll, as a list of segments: fixed strings, or a
+   formatter that writes its part (weather, a headline, a printer ...) when
+   the display gets to it. The whole message is never put together --
+   the renderer asks for one character at a time, and only the segments
+   on screen are formatted, into one of two shared buffers.
+
+   The length is measured as segments are added, so the scroll knows its
+   width up front. A segment whose text changes while scrolling is cut or
+   padded with spaces to the length it was measured at.
+*/
+class MarqueeText {
+
+public:
+  ~MarqueeText();
+  void clear();
+  boolean add(const char *text);   // must stay put until the scroll is done
+  boolean add(SegmentFormatter formatter, int arg = 0);
+  size_t length();
+  char charAt(size_t position);
+  int getSegmentCount();
+
+private:
+  typedef struct {
+    const char *text;
+    SegmentFormatter formatter;
+    int16_t arg;
+    uint16_t length;
+  } Segment;
+
+  Segment segments[MARQUEE_SEGMENTS];
+  int count = 0;
+  size_t total = 0;
+
+  const char *format(int segment, uint16_t &length);
+  void forget();
+};
@@ -0,0 +1,178 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "MessageQueue.h"
+
+MessageQueue messageQueue;
+
+// Returns the message id, 0 when the queue is full of more important messages
+uint32_t MessageQueue::push(const char* text, int priority, unsigned long ttlSeconds, int repeat) {
+  received++;
+  prune();
+  priority = constrain(priority, 0, MESSAGE_PRIORITY_MAX);
+  Message* slot = nullptr;
+  for (int inx = 0; inx < MESSAGE_QUEUE_SIZE && slot == nullptr; inx++) {
+    if (slots[inx].id == 0) {
+      slot = &slots[inx];
+    }
+  }
+  if (slot == nullptr) {
+    // full -- replace the oldest of the lowest priority
+    for (int inx = 0; inx < MESSAGE_QUEUE_SIZE; inx++) {
+      Message &candidate = slots[inx];
+      if (slot == nullptr || candidate.priority < slot->priority || (candidate.priority == slot->priority && candidate.id < slot->id)) {
+        slot = &candidate;
+      }
+    }
+    if (slot->priority > priority) {
+      dropped++;
+      return 0;
+    }
+    dropped++;
+  }
+  slot->id = ++lastId;
+  slot->priority = priority;
+  slot->repeat = constrain(repeat, 1, 255);
+  slot->shown = false;
+  slot->queuedAt = millis();
+  slot->ttl = (ttlSeconds == 0 ? MESSAGE_DEFAULT_TTL : min(ttlSeconds, (unsigned long) MESSAGE_MAX_TTL)) * 1000;
+  strlcpy(slot->text, text, sizeof(slot->text));
+  return slot->id;
+}
+
+// Messages that ran out of time before they were shown all the times asked for
+void MessageQueue::prune() {
+  for (int inx = 0; inx < MESSAGE_QUEUE_SIZE; inx++) {
+    if (slots[inx].id != 0 && (millis() - slots[inx].queuedAt) >= slots[inx].ttl) {
+      slots[inx].id = 0;
+      expired++;
+    }
+  }
+}
+
+MessageQueue::Message* MessageQueue::find(uint32_t id) {
+  for (int inx = 0; inx < MESSAGE_QUEUE_SIZE; inx++) {
+    if (id != 0 && slots[inx].id == id) {
+      return &slots[inx];
+    }
+  }
+  return nullptr;
+}
+
+MessageQueue::Message* MessageQueue::best() {
+  Message* found = nullptr;
+  for (int inx = 0; inx < MESSAGE_QUEUE_SIZE; inx++) {
+    Message &candidate = slots[inx];
+    if (candidate.id != 0 && (found == nullptr || candidate.priority > found->priority
+        || (candidate.priority == found->priority && candidate.id < found->id))) {
+      found = &candidate;
+    }
+  }
+  return found;
+}
+
+// Cheap enough to call on every loop() pass
+boolean MessageQueue::hasMessage() {
+  for (int inx = 0; inx < MESSAGE_QUEUE_SIZE; inx++) {
+    if (slots[inx].id != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+boolean MessageQueue::hasUrgent() {
+  for (int inx = 0; inx < MESSAGE_QUEUE_SIZE; inx++) {
+    if (slots[inx].id != 0 && slots[inx].priority >= MESSAGE_PRIORITY_URGENT && !slots[inx].shown) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Copies out the message to show next; it stays queued until displayed() is called
+boolean MessageQueue::next(char* text, size_t size, uint32_t &id) {
+  prune();
+  Message* message = best();
+  if (message == nullptr) {
+    return false;
+  }
+  strlcpy(text, message->text, size);
+  id = message->id;
+  return true;
+}
+
+// The first frame of the message has been written to the display
+void MessageQueue::firstPixel(uint32_t id) {
+  Message* message = find(id);
+  if (message == nullptr || message->shown) {
+    return;
+  }
+  message->shown = true;
+  lastLatencyMs = millis() - message->queuedAt;
+  maxLatencyMs = max(maxLatencyMs, lastLatencyMs);
+  totalLatencyMs += lastLatencyMs;
+  latencies++;
+}
+
+void MessageQueue::displayed(uint32_t id) {
+  Message* message = find(id);
+  if (message != nullptr && --message->repeat == 0) {
+    message->id = 0;
+  }
+}
+
+int MessageQueue::getCount() {
+  int count = 0;
+  for (int inx = 0; inx < MESSAGE_QUEUE_SIZE; inx++) {
+    if (slots[inx].id != 0) {
+      count++;
+    }
+  }
+  return count;
+}
+
+unsigned long MessageQueue::getReceived() {
+  return received;
+}
+
+unsigned long MessageQueue::getDropped() {
+  return dropped;
+}
+
+unsigned long MessageQueue::getExpired() {
+  return expired;
+}
+
+unsigned long MessageQueue::getLastLatencyMs() {
+  return lastLatencyMs;
+}
+
+unsigned long MessageQueue::getAverageLatencyMs() {
+  return latencies == 0 ? 0 : totalLatencyMs / latencies;
+}
+
+unsigned long MessageQueue::getMaxLatencyMs() {
+  return maxLatencyMs;
+}
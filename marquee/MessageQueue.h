@@ -0,0 +1,88 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <Arduino.h>
+
+#define MESSAGE_QUEUE_SIZE 8
+#define MESSAGE_TEXT_LEN 128
+#define MESSAGE_PRIORITY_URGENT 2   // this and above cut into whatever is scrolling
+#define MESSAGE_PRIORITY_MAX 3
+#define MESSAGE_DEFAULT_PRIORITY MESSAGE_PRIORITY_URGENT // a push is meant to be seen now; 0-1 wait for the scroll
+#define MESSAGE_DEFAULT_TTL 300     // seconds
+#define MESSAGE_MAX_TTL 86400       // a day; keeps the ttl in milliseconds inside an unsigned long
+
+/* Fixed-size queue for pushed messages (web API and UDP). Nothing here
+   touches flash or triggers a data refresh. The highest priority message is
+   shown first (oldest first within a priority), each one repeat times,
+   and messages whose TTL runs out before they are shown are dropped. When
+   the queue is full a new message replaces the oldest one of the lowest
+   priority, as long as that is not above its own.
+   Enqueue-to-first-pixel latency is measured for every message.
+*/
+class MessageQueue {
+
+public:
+  uint32_t push(const char* text, int priority, unsigned long ttlSeconds, int repeat);
+  boolean hasMessage();
+  boolean hasUrgent();
+  boolean next(char* text, size_t size, uint32_t &id);
+  void firstPixel(uint32_t id);
+  void displayed(uint32_t id);
+
+  int getCount();
+  unsigned long getReceived();
+  unsigned long getDropped();
+  unsigned long getExpired();
+  unsigned long getLastLatencyMs();
+  unsigned long getAverageLatencyMs();
+  unsigned long getMaxLatencyMs();
+
+private:
+  typedef struct {
+    uint32_t id;          // 0 = free slot; also gives the arrival order
+    uint8_t priority;
+    uint8_t repeat;
+    boolean shown;
+    unsigned long queuedAt;
+    unsigned long ttl;    // ms
+    char text[MESSAGE_TEXT_LEN];
+  } Message;
+
+  Message slots[MESSAGE_QUEUE_SIZE];
+  uint32_t lastId = 0;
+  unsigned long received = 0;
+  unsigned long dropped = 0;
+  unsigned long expired = 0;
+  unsigned long latencies = 0;
+  unsigned long totalLatencyMs = 0;
+  unsigned long lastLatencyMs = 0;
+  unsigned long maxLatencyMs = 0;
+
+  void prune();
+  Message* find(uint32_t id);
+  Message* best();
+};
+
+extern MessageQueue messageQueue;
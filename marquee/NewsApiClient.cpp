@@ -23,6 +23,7 @@ SOFTWARE.
 
 
 #include "NewsApiClient.h"
+#include "DnsCache.h"
 
 
 
@@ -40,66 +41,102 @@ void NewsApiClient::updateNewsClient(String ApiKey, String NewsSource) {
 void NewsApiClient::updateNews() {
   JsonStreamingParser parser;
   parser.setListener(this);
-  WiFiClient wifiClient;
-  HTTPClient http;
+  WiFiClient plainClient;
+  std::unique_ptr<BearSSL::WiFiClientSecure> secureClient(useTls ? new BearSSL::WiFiClientSecure() : nullptr);
+  WiFiClient &newsClient = useTls ? *secureClient : plainClient;
 
   if (myApiKey == "") {
     Serial.println("Please provide an API key for the News.");
     return;
   }
 
-  String apiGetData = "http://" + String(servername) + "/v2/top-headlines?sources=" + mySource + "&apiKey=" + myApiKey;
+  // HTTP/1.0 so the reply is never chunked and can be fed straight into the parser
+  String apiGetData = "GET /v2/top-headlines?sources=" + mySource + "&apiKey=" + myApiKey + " HTTP/1.0";
 
   Serial.println("Getting News Data");
   Serial.println(apiGetData);
-  http.begin(wifiClient, apiGetData);
-  int httpCode = http.GET();
-
-  if (httpCode > 0) {  // checks for connection
-    Serial.printf("[HTTP] GET... code: %d\n", httpCode);
-    if(httpCode == HTTP_CODE_OK) {
-      // get lenght of document (is -1 when Server sends no Content-Length header)
-      int len = http.getSize();
-      // create buffer for read
-      char buff[128] = { 0 };
-      // get tcp stream
-      WiFiClient * stream = http.getStreamPtr();
-      // read all data from server
-      Serial.println("Start parsing...");
-      while(http.connected() && (len > 0 || len == -1)) {
-        // get available data size
-        size_t size = stream->available();
-        if(size) {
-          // read up to 128 byte
-          int c = stream->readBytes(buff, ((size > sizeof(buff)) ? sizeof(buff) : size));
-          for(int i=0;i<c;i++) {
-            parser.parse(buff[i]); 
-          }
-            
-          if(len > 0)
-            len -= c;
-          }
-        delay(1);
-      }
-    }
-    http.end();
+  boolean connected = false;
+  if (useTls) {
+    connected = tls.connect(*secureClient, servername);
+  } else {
+    IPAddress serverIp;
+    connected = dnsCache.resolve(servername, serverIp) && plainClient.connect(serverIp, 80);
+  }
+  if (connected) {
+    newsClient.println(apiGetData);
+    newsClient.println("Host: " + String(servername));
+    newsClient.println("User-Agent: ArduinoWiFi/1.1");
+    newsClient.println("Connection: close");
+    newsClient.println();
   } else {
-    Serial.println("connection for news data failed: " + String(apiGetData)); //error message if no client connect
+    Serial.println("connection for news data failed: " + String(servername)); //error message if no client connect
     Serial.println();
     return;
   }
+
+  while (newsClient.connected() && !newsClient.available()) delay(1); //waits for data
+
+  // Check HTTP status
+  char status[32] = {0};
+  newsClient.readBytesUntil('\r', status, sizeof(status));
+  Serial.println("Response Header: " + String(status));
+  if (strstr(status, " 200 ") == nullptr) {
+    Serial.print(F("Unexpected response: "));
+    Serial.println(status);
+    newsClient.stop();
+    return;
+  }
+
+  // Skip HTTP headers
+  char endOfHeaders[] = "\r\n\r\n";
+  if (!newsClient.find(endOfHeaders)) {
+    Serial.println(F("Invalid response"));
+    newsClient.stop();
+    return;
+  }
+
+  // create buffer for read
+  char buff[128] = { 0 };
+  // read all data from server
+  Serial.println("Start parsing...");
+  while ((newsClient.connected() || newsClient.available()) && articleCount < HEADLINE_COUNT) {
+    // get available data size
+    size_t size = newsClient.available();
+    if (size) {
+      // read up to 128 byte
+      int c = newsClient.readBytes(buff, ((size > sizeof(buff)) ? sizeof(buff) : size));
+      for (int i = 0; i < c; i++) {
+        parser.parse(buff[i]);
+      }
+    }
+    delay(1);
+  }
+  newsClient.stop();
+}
+
+void NewsApiClient::setTls(boolean enabled, const char* fingerprintP) {
+  useTls = enabled;
+  tls.setFingerprint(fingerprintP);
+}
+
+boolean NewsApiClient::isTlsEnabled() {
+  return useTls;
+}
+
+TlsSession &NewsApiClient::getTls() {
+  return tls;
 }
 
 String NewsApiClient::getTitle(int index) {
-  return news[index].title;
+  return headlines.getTitle(index);
 }
 
 String NewsApiClient::getDescription(int index) {
-  return news[index].description;
+  return headlines.getDescription(index);
 }
 
 String NewsApiClient::getUrl(int index) {
-  return news[index].url;
+  return headlines.getUrl(index);
 }
 
 void NewsApiClient::updateNewsSource(String source) {
@@ -110,8 +147,13 @@ void NewsApiClient::whitespace(char c) {
 
 }
 
+// The store is cleared by whoever starts the update -- other sources may be adding to it too
 void NewsApiClient::startDocument() {
-  counterTitle = 0;
+  articleCount = 0;
+  currentTitle = "";
+  currentDescription = "";
+  currentUrl = "";
+  currentPublished = "";
 }
 
 void NewsApiClient::key(String key) {
@@ -119,19 +161,21 @@ void NewsApiClient::key(String key) {
 }
 
 void NewsApiClient::value(String value) {
-  if (counterTitle == 10) {
-    // we are full so return
+  if (articleCount >= HEADLINE_COUNT) {
+    // the newest articles come first, the rest wouldn't make it in
     return;
   }
   if (currentKey == "title") {
-    news[counterTitle].title = cleanText(value);
+    currentTitle = value;
   }
   if (currentKey == "description") {
-    news[counterTitle].description = cleanText(value);
+    currentDescription = value;
   }
   if (currentKey == "url") {
-    news[counterTitle].url = value;
-    counterTitle++;
+    currentUrl = value;
+  }
+  if (currentKey == "publishedAt") {
+    currentPublished = value;
   }
 
   Serial.println(currentKey + "=" + value);
@@ -140,7 +184,17 @@ void NewsApiClient::value(String value) {
 void NewsApiClient::endArray() {
 }
 
+// An article is complete when its object closes (the nested "source" object closes before the title is read)
 void NewsApiClient::endObject() {
+  if (currentTitle == "" || currentUrl == "") {
+    return;
+  }
+  headlines.add(currentTitle.c_str(), currentUrl.c_str(), currentDescription.c_str(), Headlines::parseTime(currentPublished.c_str()));
+  articleCount++;
+  currentTitle = "";
+  currentDescription = "";
+  currentUrl = "";
+  currentPublished = "";
 }
 void NewsApiClient::startArray() {
 }
@@ -152,47 +206,5 @@ void NewsApiClient::endDocument() {
 }
 
 String NewsApiClient::cleanText(String text) {
-  text.replace("’", "'");
-  text.replace("“", "\"");
-  text.replace("”", "\"");
-  text.replace("`", "'");
-  text.replace("‘", "'");
-  text.replace("„", "'");
-  text.replace("\\\"", "'");
-  text.replace("•", "-");
-  text.replace("é", "e");
-  text.replace("è", "e");
-  text.replace("ë", "e");
-  text.replace("ê", "e");
-  text.replace("à", "a");
-  text.replace("â", "a");
-  text.replace("ù", "u");
-  text.replace("ç", "c");
-  text.replace("î", "i");
-  text.replace("ï", "i");
-  text.replace("ô", "o");
-  text.replace("…", "...");
-  text.replace("–", "-");
-  text.replace("Â", "A");
-  text.replace("À", "A");
-  text.replace("æ", "ae");
-  text.replace("Æ", "AE");
-  text.replace("É", "E");
-  text.replace("È", "E");
-  text.replace("Ë", "E");
-  text.replace("Ô", "O");
-  text.replace("Ö", "Oe");
-  text.replace("ö", "oe");
-  text.replace("œ", "oe");
-  text.replace("Œ", "OE");
-  text.replace("Ù", "U");
-  text.replace("Û", "U");
-  text.replace("Ü", "Ue");
-  text.replace("ü", "ue");
-  text.replace("Ä", "Ae");
-  text.replace("ä", "ae");
-  text.replace("ß", "ss");
-  text.replace("»", "'");
-  text.replace("«", "'");
-  return text;
+  return Headlines::cleanText(text);
 }
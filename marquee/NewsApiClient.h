@@ -23,10 +23,11 @@ SOFTWARE.
 
 #pragma once
 #include <ESP8266WiFi.h>
-#include <ESP8266HTTPClient.h>
 #include <WiFiClient.h>
 #include <JsonListener.h>
 #include <JsonStreamingParser.h> // --> https://github.com/squix78/json-streaming-parser
+#include "TlsSession.h"
+#include "Headlines.h"
 
 class NewsApiClient: public JsonListener {
 
@@ -35,17 +36,15 @@ class NewsApiClient: public JsonListener {
     String myApiKey = "";
     
     String currentKey = "";
-    int counterTitle = 0;
-
-    typedef struct {
-      String title;
-      String description;
-      String url;
-    } newsfeed;
-
-    newsfeed news[10];
+    String currentTitle = "";
+    String currentDescription = "";
+    String currentUrl = "";
+    String currentPublished = "";
+    int articleCount = 0;   // articles read in this update
     
     const char* servername = "newsapi.org";  // remote server we will connect to
+    boolean useTls = false;
+    TlsSession tls = TlsSession("NewsAPI");
   
   public:
     NewsApiClient(String ApiKey, String NewsSource);
@@ -57,6 +56,9 @@ class NewsApiClient: public JsonListener {
     String getDescription(int index);
     String getUrl(int index);
     String cleanText(String text);
+    void setTls(boolean enabled, const char* fingerprintP);
+    boolean isTlsEnabled();
+    TlsSession &getTls();
     
     virtual void whitespace(char c);
     virtual void startDocument();
@@ -22,53 +22,205 @@ SOFTWARE.
 */
 
 #include "OctoPrintClient.h"
+#include "DnsCache.h"
+#include "JsonFilters.h"
+
+#define STALE_DATA_MS (30 * 60 * 1000UL) // drop cached job data if OctoPrint has been unreachable this long
+#define PUSH_RETRY_MS (60 * 1000UL)       // wait between attempts to (re)start the push connection
+#define CONNECT_TIMEOUT_MS 2000           // printers are on the LAN -- a slow connect means a dead host
+#define BATCH_TIMEOUT_MS 10000            // for all replies of one pipelined batch together
+#define POLL_PRINTING_MS (60 * 1000UL)
+#define POLL_STEADY_MS (5 * 60 * 1000UL)  // printing, and the local model has been tracking well
+#define POLL_FINISHING_MS (20 * 1000UL)   // the last few minutes of a print
+#define POLL_IDLE_MS (3 * 60 * 1000UL)
+#define MODEL_HORIZON_S (15 * 60)         // don't run the model on further than this past the last sample
+#define MODEL_STEADY_ERROR 0.5            // percent
+#define PUSH_SILENCE_MS (30 * 1000UL)     // fall back to polling if the push stream goes quiet this long
+#define PUSH_THROTTLE 2                   // OctoPrint sends "current" every 500ms * throttle
 
 OctoPrintClient::OctoPrintClient(String ApiKey, String server, int port, String user, String pass) {
   updateOctoPrintClient(ApiKey, server, port, user, pass);
 }
 
 void OctoPrintClient::updateOctoPrintClient(String ApiKey, String server, int port, String user, String pass) {
-  server.toCharArray(myServer, 100);
-  myApiKey = ApiKey;
-  myPort = port;
-  encodedAuth = "";
+  setPrinter(0, ApiKey, server, port);
+  setAuth(user, pass);
+}
+
+// A changed address or key starts the slot over and polls it on the next pass
+void OctoPrintClient::setPrinter(int index, String ApiKey, String server, int port) {
+  if (index < 0 || index >= MAX_PRINTERS) {
+    return;
+  }
+  PrinterStruct &printer = printers[index];
+  server.trim();
+  ApiKey.trim();
+  if (server == printer.server && ApiKey == printer.apiKey && port == printer.port) {
+    return;
+  }
+  strlcpy(printer.server, server.c_str(), sizeof(printer.server));
+  strlcpy(printer.apiKey, ApiKey.c_str(), sizeof(printer.apiKey));
+  printer.port = port;
+  resetPrintData(printer);
+  printer.pollRequested = true;
+  printer.lastSuccessMillis = 0;
+  printer.lastProgressChange = 0;
+  health[index].reset();
+  if (index == 0) {
+    stopPush();
+  }
+}
+
+void OctoPrintClient::setAuth(String user, String pass) {
+  String auth = "";
   if (user != "") {
     String userpass = user + ":" + pass;
     base64 b64;
-    encodedAuth = b64.encode(userpass, true);
+    auth = b64.encode(userpass, true);
+  }
+  if (auth != encodedAuth) {
+    stopPush();
+  }
+  encodedAuth = auth;
+}
+
+void OctoPrintClient::setPushEnabled(boolean enabled) {
+  if (!enabled) {
+    stopPush();
+  }
+  pushEnabled = enabled;
+}
+
+void OctoPrintClient::setError(int index, const char* error) {
+  strlcpy(printers[index].error, error, sizeof(printers[index].error));
+}
+
+boolean OctoPrintClient::validate(int index) {
+  PrinterStruct &printer = printers[index];
+  if (printer.server[0] == '\0') {
+    setError(index, "Server address is required; ");
+    return false;
+  }
+  if (printer.apiKey[0] == '\0') {
+    setError(index, "ApiKey is required; ");
+    return false;
   }
+  return true;
 }
 
-boolean OctoPrintClient::validate() {
-  boolean rtnValue = false;
-  printerData.error = "";
-  if (String(myServer) == "") {
-    printerData.error += "Server address is required; ";
+// Printing: every minute, less often once the local model has proven itself, faster near
+// the end so the finish shows promptly; idle: every few minutes
+unsigned long OctoPrintClient::getPollInterval(int index) {
+  if (!isPrinting(index)) {
+    return POLL_IDLE_MS;
   }
-  if (myApiKey == "") {
-    printerData.error += "ApiKey is required; ";
+  PrinterStruct &printer = printers[index];
+  uint32_t timeLeft = printer.progressPrintTimeLeft; // as of the last sample
+  if (timeLeft > 0 && timeLeft < 300) {
+    return POLL_FINISHING_MS;
   }
-  if (printerData.error == "") {
-    rtnValue = true;
+  if (printer.estimateSamples >= 3 && printer.estimateError < MODEL_STEADY_ERROR) {
+    // but be back in time for the last few minutes
+    unsigned long untilFinishing = timeLeft > 0 ? (timeLeft - 300) * 1000UL : POLL_STEADY_MS;
+    return constrain(untilFinishing, POLL_PRINTING_MS, POLL_STEADY_MS);
   }
-  return rtnValue;
+  return POLL_PRINTING_MS;
 }
 
+boolean OctoPrintClient::isPollDue(int index) {
+  PrinterStruct &printer = printers[index];
+  if (printer.server[0] == '\0') {
+    return false;
+  }
+  if (index == 0 && isPushActive()) {
+    return false; // the push stream keeps the first printer current
+  }
+  return printer.pollRequested || (millis() - printer.lastPollMillis) >= getPollInterval(index);
+}
+
+boolean OctoPrintClient::isDue() {
+  for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+    if (isPollDue(inx)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Polls the printers that are due. Up to PRINTER_PIPELINE requests are sent before any reply
+// is read, so OctoPrint works on them at the same time and a dead host costs one connect timeout.
 void OctoPrintClient::getPrinterJobResults() {
-  if (!validate()) {
-    return;
+  unsigned long batchStart = millis();
+  int next = 0;
+  while (next < MAX_PRINTERS) {
+    WiFiClient clients[PRINTER_PIPELINE];
+    int batch[PRINTER_PIPELINE];
+    int inFlight = 0;
+    for (; next < MAX_PRINTERS && inFlight < PRINTER_PIPELINE; next++) {
+      if (!isPollDue(next)) {
+        continue;
+      }
+      printers[next].pollRequested = false;
+      printers[next].lastPollMillis = millis();
+      if (sendJobRequest(next, clients[inFlight])) {
+        batch[inFlight++] = next;
+      }
+    }
+    if (inFlight == 0) {
+      continue;
+    }
+
+    // Take the replies in whatever order they come back
+    int waiting = inFlight;
+    unsigned long waitStart = millis();
+    while (waiting > 0 && (millis() - waitStart) < BATCH_TIMEOUT_MS) {
+      for (int inx = 0; inx < inFlight; inx++) {
+        if (batch[inx] < 0) {
+          continue;
+        }
+        if (clients[inx].available() || !clients[inx].connected()) {
+          readJobReply(batch[inx], clients[inx]);
+          clients[inx].stop();
+          batch[inx] = -1;
+          waiting--;
+        }
+      }
+      delay(1);
+    }
+    for (int inx = 0; inx < inFlight; inx++) {
+      if (batch[inx] >= 0) {
+        Serial.println("OctoPrint " + String(printers[batch[inx]].server) + " did not answer in time");
+        health[batch[inx]].recordFailure();
+        setError(batch[inx], "OctoPrint did not answer in time");
+        clients[inx].stop();
+      }
+    }
+  }
+  lastBatchMillis = millis() - batchStart;
+}
+
+boolean OctoPrintClient::sendJobRequest(int index, WiFiClient &printClient) {
+  PrinterStruct &printer = printers[index];
+  if (!validate(index)) {
+    return false;
+  }
+  if (!health[index].allowRequest()) {
+    // Serve the last known job data, but don't keep showing a print that may have ended long ago
+    if (printer.lastSuccessMillis != 0 && (millis() - printer.lastSuccessMillis) > STALE_DATA_MS) {
+      resetPrintData(printer);
+      printer.lastSuccessMillis = 0;
+    }
+    snprintf(printer.error, sizeof(printer.error), "OctoPrint unavailable (retry in %lds)", health[index].getSecondsToNextProbe());
+    return false;
   }
-  WiFiClient printClient;
-  printClient.setTimeout(10000);
-  String apiGetData = "GET /api/job HTTP/1.1";
-
-  Serial.println("Getting Octoprint Data");
-  Serial.println(apiGetData);
-  result = "";
-  if (printClient.connect(myServer, myPort)) {  //starts client connection, checks for connection
-    printClient.println(apiGetData);
-    printClient.println("Host: " + String(myServer) + ":" + String(myPort));
-    printClient.println("X-Api-Key: " + myApiKey);
+  printClient.setTimeout(CONNECT_TIMEOUT_MS);
+
+  Serial.println("Getting Octoprint Data from " + String(printer.server));
+  IPAddress serverIp;
+  if (dnsCache.resolve(printer.server, serverIp) && printClient.connect(serverIp, printer.port)) {  //starts client connection, checks for connection
+    printClient.println("GET /api/job HTTP/1.1");
+    printClient.println("Host: " + String(printer.server) + ":" + String(printer.port));
+    printClient.println("X-Api-Key: " + String(printer.apiKey));
     if (encodedAuth != "") {
       printClient.print("Authorization: ");
       printClient.println("Basic " + encodedAuth);
@@ -77,18 +229,24 @@ void OctoPrintClient::getPrinterJobResults() {
     printClient.println("Connection: close");
     if (printClient.println() == 0) {
       Serial.println("OctoPrint Connection failed.");
-      resetPrintData();
-      printerData.error = "Octoprint Connection Failed";
-      return;
+      health[index].recordFailure();
+      setError(index, "Octoprint Connection Failed");
+      return false;
     }
   } 
   else {
-    Serial.println("Connection for OctoPrint data failed: " + String(myServer) + ":" + String(myPort)); //error message if no client connect
+    Serial.println("Connection for OctoPrint data failed: " + String(printer.server) + ":" + String(printer.port)); //error message if no client connect
     Serial.println();
-    resetPrintData();
-      printerData.error = "Connection for OctoPrint data failed: " + String(myServer) + ":" + String(myPort);
-    return;
+    health[index].recordFailure();
+    snprintf(printer.error, sizeof(printer.error), "Connection for OctoPrint data failed: %s:%d", printer.server, printer.port);
+    return false;
   }
+  return true;
+}
+
+void OctoPrintClient::readJobReply(int index, WiFiClient &printClient) {
+  PrinterStruct &printer = printers[index];
+  printClient.setTimeout(2000); // the reply has started arriving, the rest is close behind
 
   // Check HTTP status
   char status[32] = {0};
@@ -96,8 +254,9 @@ void OctoPrintClient::getPrinterJobResults() {
   if (strcmp(status, "HTTP/1.1 200 OK") != 0) {
     Serial.print(F("Unexpected response: "));
     Serial.println(status);
-    resetPrintData();
-    printerData.error = String(status);
+    health[index].recordFailure();
+    resetPrintData(printer);
+    setError(index, status[0] == '\0' ? "No response" : status);
     return;
   }
 
@@ -105,115 +264,448 @@ void OctoPrintClient::getPrinterJobResults() {
   char endOfHeaders[] = "\r\n\r\n";
   if (!printClient.find(endOfHeaders)) {
     Serial.println(F("Invalid response"));
-    resetPrintData();
-    printerData.error = "Invalid response";
+    health[index].recordFailure();
+    resetPrintData(printer);
+    setError(index, "Invalid response");
     return;
   }
 
-  // const size_t bufferSize = JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(3) + 2*JSON_OBJECT_SIZE(5) + JSON_OBJECT_SIZE(6) + 710;
-  JsonDocument jdoc;
-  DeserializationError error = deserializeJson(jdoc, printClient);
+  JsonDocument filter(&jsonArena);
+  deserializeJson(filter, FPSTR(JOB_FILTER));
+  JsonDocument jdoc(&jsonBudget);
+  DeserializationError error = deserializeJson(jdoc, printClient, DeserializationOption::Filter(filter));
 
   // Parse JSON object
-  //  JsonObject& root = jsonBuffer.parseObject(printClient);
   if (error) {
-    Serial.println(F("OctoPrint Data Parsing failed!"));
+    Serial.println("OctoPrint Data Parsing failed! " + String(error.c_str()));
+    health[index].recordFailure();
     return;
   }
+  health[index].recordSuccess();
+  printer.lastSuccessMillis = millis();
+  printer.error[0] = '\0';
   
-  printerData.averagePrintTime = jdoc["job"]["averagePrintTime"].as<String>();
-  printerData.estimatedPrintTime = jdoc["job"]["estimatedPrintTime"].as<String>();
-  printerData.fileName = jdoc["job"]["file"]["name"].as<String>();
-  printerData.fileSize = jdoc["job"]["file"]["size"].as<String>();
-  printerData.lastPrintTime = jdoc["job"]["lastPrintTime"].as<String>();
-  printerData.progressCompletion = jdoc["progress"]["completion"].as<String>();
-  printerData.progressFilepos = jdoc["progress"]["filepos"].as<String>();
-  printerData.progressPrintTime = jdoc["progress"]["printTime"].as<String>();
-  printerData.progressPrintTimeLeft = jdoc["progress"]["printTimeLeft"].as<String>();
-  printerData.state = jdoc["state"].as<String>();
-
-  if (isPrinting()) {
-    Serial.println("Status: " + printerData.state + " " + printerData.fileName + "(" + printerData.progressCompletion + "%)");
-  } else if (isOperational()) {
-    Serial.println("Status: " + printerData.state);
+  readJob(printer, jdoc["job"]);
+  readProgress(printer, jdoc["progress"]);
+  strlcpy(printer.state, jdoc["state"] | "", sizeof(printer.state));
+
+  if (isPrinting(index)) {
+    Serial.printf("Status: %s %s(%.1f%%)\n", printer.state, printer.fileName, printer.progressCompletion);
+  } else if (isOperational(index)) {
+    Serial.printf("Status: %s\n", printer.state);
   } else {
     Serial.println("Printer Not Opperational");
   }
-  
-  printClient.stop(); //stop client
 }
 
-// Reset all PrinterData
-void OctoPrintClient::resetPrintData() {
-  printerData.averagePrintTime = "";
-  printerData.estimatedPrintTime = "";
-  printerData.fileName = "";
-  printerData.fileSize = "";
-  printerData.lastPrintTime = "";
-  printerData.progressCompletion = "";
-  printerData.progressFilepos = "";
-  printerData.progressPrintTime = "";
-  printerData.progressPrintTimeLeft = "";
-  printerData.state = "";
-  printerData.error = "";
+// Called on every frame, also while scrolling -- only services the socket, never blocks
+void OctoPrintClient::handlePush() {
+  if (pushStarted) {
+    webSocket.loop();
+  }
 }
 
-String OctoPrintClient::getAveragePrintTime(){
-  return printerData.averagePrintTime;
+// Called from loop() between scrolls -- the login is a blocking HTTP request
+void OctoPrintClient::maintainPush() {
+  if (!pushEnabled || printers[0].server[0] == '\0' || printers[0].apiKey[0] == '\0') {
+    return;
+  }
+  if (!pushStarted) {
+    if (lastPushAttempt != 0 && (millis() - lastPushAttempt) < PUSH_RETRY_MS) {
+      return;
+    }
+    lastPushAttempt = millis();
+    if (!health[0].isClosed()) {
+      return; // polling will tell us when OctoPrint is back
+    }
+    startPush();
+    return;
+  }
+  if (pushReauth) {
+    pushReauth = false;
+    if (pushLogin()) {
+      sendPushAuth();
+    }
+  }
 }
 
-String OctoPrintClient::getEstimatedPrintTime() {
-  return printerData.estimatedPrintTime;
+// Get a session for the socket with a passive login using the API key
+boolean OctoPrintClient::pushLogin() {
+  PrinterStruct &printer = printers[0];
+  WiFiClient loginClient;
+  loginClient.setTimeout(10000);
+  String body = "{\"passive\":true}";
+  IPAddress serverIp;
+  if (!dnsCache.resolve(printer.server, serverIp) || !loginClient.connect(serverIp, printer.port)) {
+    Serial.println("OctoPrint push login: connection failed");
+    return false;
+  }
+  loginClient.println("POST /api/login HTTP/1.0");
+  loginClient.println("Host: " + String(printer.server) + ":" + String(printer.port));
+  loginClient.println("X-Api-Key: " + String(printer.apiKey));
+  if (encodedAuth != "") {
+    loginClient.print("Authorization: ");
+    loginClient.println("Basic " + encodedAuth);
+  }
+  loginClient.println("User-Agent: ArduinoWiFi/1.1");
+  loginClient.println("Content-Type: application/json");
+  loginClient.println("Content-Length: " + String(body.length()));
+  loginClient.println("Connection: close");
+  loginClient.println();
+  loginClient.print(body);
+
+  char status[32] = {0};
+  loginClient.readBytesUntil('\r', status, sizeof(status));
+  char endOfHeaders[] = "\r\n\r\n";
+  if (strstr(status, " 200 ") == nullptr || !loginClient.find(endOfHeaders)) {
+    Serial.println("OctoPrint push login failed: " + String(status));
+    loginClient.stop();
+    return false;
+  }
+
+  JsonDocument filter(&jsonArena);
+  filter["name"] = true;
+  filter["session"] = true;
+  JsonDocument jdoc(&jsonBudget);
+  DeserializationError error = deserializeJson(jdoc, loginClient, DeserializationOption::Filter(filter));
+  loginClient.stop();
+  if (error || jdoc["session"].isNull()) {
+    Serial.println(F("OctoPrint push login: no session in reply"));
+    return false;
+  }
+  pushUser = jdoc["name"].as<String>();
+  pushSession = jdoc["session"].as<String>();
+  return true;
 }
 
-String OctoPrintClient::getFileName() {
-  return printerData.fileName;
+void OctoPrintClient::startPush() {
+  if (!pushLogin()) {
+    return;
+  }
+  IPAddress serverIp;
+  if (!dnsCache.resolve(printers[0].server, serverIp)) {
+    return;
+  }
+  Serial.println("Starting OctoPrint push connection to " + serverIp.toString() + ":" + String(printers[0].port));
+  webSocket.begin(serverIp.toString(), printers[0].port, "/sockjs/websocket", "");
+  if (encodedAuth != "") {
+    webSocket.setAuthorization(encodedAuth.c_str());
+  }
+  webSocket.onEvent([this](WStype_t type, uint8_t *payload, size_t length) {
+    onPushEvent(type, payload, length);
+  });
+  webSocket.setReconnectInterval(PUSH_RETRY_MS);
+  pushStarted = true;
+  pushWindowStart = millis();
+  pushWindowBytes = 0;
 }
 
-String OctoPrintClient::getFileSize() {
-  return printerData.fileSize;
+void OctoPrintClient::stopPush() {
+  if (pushStarted) {
+    webSocket.disconnect();
+  }
+  pushStarted = false;
+  pushConnected = false;
+  pushReauth = false;
+  lastPushAttempt = 0;
 }
 
-String OctoPrintClient::getLastPrintTime(){
-  return printerData.lastPrintTime;
+void OctoPrintClient::sendPushAuth() {
+  String auth = "{\"auth\":\"" + pushUser + ":" + pushSession + "\"}";
+  webSocket.sendTXT(auth);
+  String throttle = "{\"throttle\":" + String(PUSH_THROTTLE) + "}";
+  webSocket.sendTXT(throttle);
 }
 
-String OctoPrintClient::getProgressCompletion() {
-  return String(printerData.progressCompletion.toInt());
+void OctoPrintClient::onPushEvent(WStype_t type, uint8_t *payload, size_t length) {
+  switch (type) {
+    case WStype_CONNECTED:
+      Serial.println(F("OctoPrint push connected"));
+      pushConnected = true;
+      sendPushAuth();
+      break;
+    case WStype_DISCONNECTED:
+      if (pushConnected) {
+        Serial.println(F("OctoPrint push disconnected -- polling until it reconnects"));
+      }
+      pushConnected = false;
+      break;
+    case WStype_TEXT:
+      readPushMessage(payload, length);
+      break;
+    default:
+      break;
+  }
 }
 
-String OctoPrintClient::getProgressFilepos() {
-  return printerData.progressFilepos;  
+// "current" and "history" messages carry the same job/progress/state layout,
+// only fields present in the message are updated
+void OctoPrintClient::readPushMessage(uint8_t *payload, size_t length) {
+  PrinterStruct &printer = printers[0];
+  pushMessages++;
+  pushBytes += length;
+  pushWindowBytes += length;
+  if ((millis() - pushWindowStart) >= 60000) {
+    pushBytesPerMinute = pushWindowBytes * 60000 / (millis() - pushWindowStart);
+    pushWindowStart = millis();
+    pushWindowBytes = 0;
+  }
+
+  JsonDocument filter(&jsonArena);
+  deserializeJson(filter, FPSTR(PUSH_FILTER));
+
+  JsonDocument jdoc(&jsonBudget);
+  DeserializationError error = deserializeJson(jdoc, payload, length, DeserializationOption::Filter(filter));
+  if (error) {
+    Serial.println("OctoPrint push message parsing failed: " + String(error.c_str()));
+    return;
+  }
+  if (!jdoc["reauthRequired"].isNull()) {
+    pushReauth = true; // log in again from maintainPush(), not from inside the socket callback
+    return;
+  }
+  JsonObject current = jdoc["current"];
+  if (current.isNull()) {
+    current = jdoc["history"];
+  }
+  if (current.isNull()) {
+    return;
+  }
+  lastPushMessage = millis();
+  health[0].recordSuccess();
+  printer.lastSuccessMillis = millis();
+  printer.error[0] = '\0';
+
+  if (!current["state"]["text"].isNull()) {
+    strlcpy(printer.state, current["state"]["text"] | "", sizeof(printer.state));
+  }
+  if (!current["job"].isNull()) {
+    readJob(printer, current["job"]);
+  }
+  if (!current["progress"].isNull()) {
+    readProgress(printer, current["progress"]);
+  }
 }
 
-String OctoPrintClient::getProgressPrintTime() {
-  return printerData.progressPrintTime;
+// The job and progress objects look the same in /api/job and in push messages
+void OctoPrintClient::readJob(PrinterStruct &printer, JsonObject job) {
+  strlcpy(printer.fileName, job["file"]["name"] | "", sizeof(printer.fileName));
+  printer.fileSize = job["file"]["size"] | 0;
+  printer.estimatedPrintTime = job["estimatedPrintTime"] | 0.0f;
+  printer.averagePrintTime = job["averagePrintTime"] | 0.0f;
+  printer.lastPrintTime = job["lastPrintTime"] | 0.0f;
 }
 
-String OctoPrintClient::getProgressPrintTimeLeft() {
-  return printerData.progressPrintTimeLeft;
+void OctoPrintClient::readProgress(PrinterStruct &printer, JsonObject progress) {
+  float completion = progress["completion"] | 0.0f;
+  if (completion != printer.progressCompletion) {
+    printer.lastProgressChange = millis();
+  }
+  // Score the model against the new sample before it is moved onto it
+  if (printer.sampleMillis != 0 && completion >= printer.progressCompletion) {
+    float miss = fabs(getModelCompletion(printer) - completion);
+    printer.estimateError = printer.estimateSamples == 0 ? miss : printer.estimateError * 0.75 + miss * 0.25;
+    printer.estimateSamples++;
+  } else {
+    // first sample, or a new print started
+    printer.estimateError = 0;
+    printer.estimateSamples = 0;
+  }
+  printer.progressCompletion = completion;
+  printer.progressFilepos = progress["filepos"] | 0;
+  printer.progressPrintTime = progress["printTime"] | 0;
+  printer.progressPrintTimeLeft = progress["printTimeLeft"] | 0;
+  printer.sampleMillis = millis();
+  float timeCompletion = getTimeCompletion(printer, 0);
+  printer.completionBias = timeCompletion < 0 ? 0 : completion - timeCompletion;
 }
 
-String OctoPrintClient::getState() {
-  return printerData.state;
+// Seconds the model runs ahead of the last sample
+uint32_t OctoPrintClient::getModelElapsed(PrinterStruct &printer) {
+  if (printer.sampleMillis == 0 || strcmp(printer.state, "Printing") != 0) {
+    return 0;
+  }
+  uint32_t elapsed = (millis() - printer.sampleMillis) / 1000;
+  return elapsed > MODEL_HORIZON_S ? MODEL_HORIZON_S : elapsed;
 }
 
-boolean OctoPrintClient::isPrinting() {
-  boolean printing = false;
-  if (printerData.state == "Printing") {
-    printing = true;
+// Completion from print time alone: done / (done + left) when OctoPrint has an estimate of
+// the time left, otherwise against the slicer's estimate. -1 when there is nothing to go on.
+float OctoPrintClient::getTimeCompletion(PrinterStruct &printer, uint32_t elapsed) {
+  float printTime = printer.progressPrintTime + elapsed;
+  if (printer.progressPrintTimeLeft > 0) {
+    float timeLeft = printer.progressPrintTimeLeft > elapsed ? printer.progressPrintTimeLeft - elapsed : 0;
+    return 100.0 * printTime / (printTime + timeLeft);
+  }
+  if (printer.estimatedPrintTime > 0) {
+    return 100.0 * printTime / printer.estimatedPrintTime;
   }
-  return printing;
+  return -1;
 }
 
-boolean OctoPrintClient::isOperational() {
-  boolean operational = false;
-  if (printerData.state == "Operational") {
-    operational = true;
+// Moves smoothly from the reported completion and never shows less than it
+float OctoPrintClient::getModelCompletion(PrinterStruct &printer) {
+  uint32_t elapsed = getModelElapsed(printer);
+  if (elapsed == 0) {
+    return printer.progressCompletion;
   }
-  return operational;
+  float timeCompletion = getTimeCompletion(printer, elapsed);
+  if (timeCompletion < 0) {
+    return printer.progressCompletion;
+  }
+  return constrain(timeCompletion + printer.completionBias, printer.progressCompletion, 100.0f);
+}
+
+boolean OctoPrintClient::isPushActive() {
+  return pushEnabled && pushConnected && lastPushMessage != 0 && (millis() - lastPushMessage) < PUSH_SILENCE_MS;
+}
+
+unsigned long OctoPrintClient::getPushMessages() {
+  return pushMessages;
+}
+
+unsigned long OctoPrintClient::getPushBytesPerMinute() {
+  return pushBytesPerMinute;
 }
 
-String OctoPrintClient::getError() {
-  return printerData.error;
-}
+unsigned long OctoPrintClient::getLastBatchMillis() {
+  return lastBatchMillis;
+}
+
+long OctoPrintClient::getSecondsSinceProgressChange(int index) {
+  if (printers[index].lastProgressChange == 0) {
+    return -1;
+  }
+  return (millis() - printers[index].lastProgressChange) / 1000;
+}
+
+long OctoPrintClient::getSecondsToNextPoll(int index) {
+  if (!isConfigured(index) || printers[index].pollRequested) {
+    return 0;
+  }
+  unsigned long elapsed = millis() - printers[index].lastPollMillis;
+  unsigned long interval = getPollInterval(index);
+  return elapsed >= interval ? 0 : (interval - elapsed) / 1000;
+}
+
+// Reset all PrinterData (the slot keeps its server and schedule)
+void OctoPrintClient::resetPrintData(PrinterStruct &printer) {
+  printer.averagePrintTime = 0;
+  printer.estimatedPrintTime = 0;
+  printer.fileName[0] = '\0';
+  printer.fileSize = 0;
+  printer.lastPrintTime = 0;
+  printer.progressCompletion = 0;
+  printer.progressFilepos = 0;
+  printer.progressPrintTime = 0;
+  printer.progressPrintTimeLeft = 0;
+  printer.state[0] = '\0';
+  printer.error[0] = '\0';
+  printer.sampleMillis = 0;
+  printer.completionBias = 0;
+  printer.estimateError = 0;
+  printer.estimateSamples = 0;
+}
+
+boolean OctoPrintClient::isConfigured(int index) {
+  return printers[index].server[0] != '\0';
+}
+
+int OctoPrintClient::getPrinterCount() {
+  int count = 0;
+  for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+    if (isConfigured(inx)) {
+      count++;
+    }
+  }
+  return count;
+}
+
+int OctoPrintClient::getPrintingCount() {
+  int count = 0;
+  for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+    if (isPrinting(inx)) {
+      count++;
+    }
+  }
+  return count;
+}
+
+String OctoPrintClient::getServer(int index) {
+  return String(printers[index].server);
+}
+
+String OctoPrintClient::getAveragePrintTime(int index){
+  return String(printers[index].averagePrintTime, 0);
+}
+
+String OctoPrintClient::getEstimatedPrintTime(int index) {
+  return String(printers[index].estimatedPrintTime, 0);
+}
+
+String OctoPrintClient::getFileName(int index) {
+  return String(printers[index].fileName);
+}
+
+String OctoPrintClient::getFileSize(int index) {
+  return String(printers[index].fileSize);
+}
+
+String OctoPrintClient::getLastPrintTime(int index){
+  return String(printers[index].lastPrintTime, 0);
+}
+
+String OctoPrintClient::getProgressCompletion(int index) {
+  return String((int)getModelCompletion(printers[index]));
+}
+
+float OctoPrintClient::getProgressCompletionValue(int index) {
+  return getModelCompletion(printers[index]);
+}
+
+float OctoPrintClient::getEstimateError(int index) {
+  return printers[index].estimateError;
+}
+
+int OctoPrintClient::getEstimateSamples(int index) {
+  return printers[index].estimateSamples;
+}
+
+String OctoPrintClient::getProgressFilepos(int index) {
+  return String(printers[index].progressFilepos);
+}
+
+String OctoPrintClient::getProgressPrintTime(int index) {
+  return String(printers[index].progressPrintTime + getModelElapsed(printers[index]));
+}
+
+// Counts down between polls
+String OctoPrintClient::getProgressPrintTimeLeft(int index) {
+  uint32_t timeLeft = printers[index].progressPrintTimeLeft;
+  uint32_t elapsed = getModelElapsed(printers[index]);
+  return String(timeLeft > elapsed ? timeLeft - elapsed : 0);
+}
+
+String OctoPrintClient::getState(int index) {
+  return String(printers[index].state);
+}
+
+boolean OctoPrintClient::isPrinting(int index) {
+  return strcmp(printers[index].state, "Printing") == 0;
+}
+
+boolean OctoPrintClient::isOperational(int index) {
+  return strcmp(printers[index].state, "Operational") == 0;
+}
+
+String OctoPrintClient::getError(int index) {
+  return String(printers[index].error);
+}
+
+SourceHealth &OctoPrintClient::getHealth(int index) {
+  return health[index];
+}
+
+JsonBudget &OctoPrintClient::getJsonBudget() {
+  return jsonBudget;
+}
@@ -25,53 +25,126 @@ SOFTWARE.
 #include <ESP8266WiFi.h>
 #include <ArduinoJson.h>
 #include <base64.h>
+#include <WebSocketsClient.h> // --> https://github.com/Links2004/arduinoWebSockets
+#include "SourceHealth.h"
+#include "JsonLimits.h"
+
+#define MAX_PRINTERS 6         // OctoPrint hosts watched -- printer 1 is the one that can use push
+#define PRINTER_PIPELINE 3     // /api/job requests in flight at once (lwIP has 5 TCP slots, the web server needs some)
 
 class OctoPrintClient {
 
 private:
-  char myServer[100];
-  int myPort = 80;
-  String myApiKey = "";
-  String encodedAuth = "";
-
-  void resetPrintData();
-  boolean validate();
-  
-  String result;
+  String encodedAuth = "";     // shared by all printers (haproxy / basic auth in front of OctoPrint)
 
+  // Times are in seconds; values OctoPrint reports as null are kept as 0.
+  // Fixed size so a farm of printers doesn't fragment the heap.
   typedef struct {
-    String averagePrintTime;
-    String estimatedPrintTime;
-    String fileName;
-    String fileSize;
-    String lastPrintTime;
-    String progressCompletion;
-    String progressFilepos;
-    String progressPrintTime;
-    String progressPrintTimeLeft;
-    String state;
-    String error;
+    char server[48];
+    uint16_t port;
+    char apiKey[48];
+    float averagePrintTime;
+    float estimatedPrintTime;
+    char fileName[64];
+    uint32_t fileSize;         // bytes
+    float lastPrintTime;
+    float progressCompletion;  // percent
+    uint32_t progressFilepos;
+    uint32_t progressPrintTime;
+    uint32_t progressPrintTimeLeft;
+    char state[24];
+    char error[64];
+    // local progress model, moved forward from the last sample between polls
+    unsigned long sampleMillis;
+    float completionBias;      // reported completion minus the time based estimate at the sample
+    float estimateError;       // average miss of the model at each new sample, in percent
+    uint16_t estimateSamples;
+    boolean pollRequested;
+    unsigned long lastPollMillis;
+    unsigned long lastSuccessMillis;
+    unsigned long lastProgressChange;
   } PrinterStruct;
 
-  PrinterStruct printerData;
+  PrinterStruct printers[MAX_PRINTERS] = {};
+  SourceHealth health[MAX_PRINTERS] = { SourceHealth("OctoPrint"), SourceHealth("OctoPrint 2"), SourceHealth("OctoPrint 3"),
+                                        SourceHealth("OctoPrint 4"), SourceHealth("OctoPrint 5"), SourceHealth("OctoPrint 6") };
+  JsonBudget jsonBudget = JsonBudget("OctoPrint", JSON_BUDGET_OCTOPRINT);
+  unsigned long lastBatchMillis = 0;
+
+  void resetPrintData(PrinterStruct &printer);
+  void readJob(PrinterStruct &printer, JsonObject job);
+  void readProgress(PrinterStruct &printer, JsonObject progress);
+  uint32_t getModelElapsed(PrinterStruct &printer);
+  float getTimeCompletion(PrinterStruct &printer, uint32_t elapsed);
+  float getModelCompletion(PrinterStruct &printer);
+  boolean validate(int index);
+  boolean isPollDue(int index);
+  unsigned long getPollInterval(int index);
+  boolean sendJobRequest(int index, WiFiClient &printClient);
+  void readJobReply(int index, WiFiClient &printClient);
+  void setError(int index, const char* error);
+
+  // Push mode -- OctoPrint's raw SockJS websocket (/sockjs/websocket), first printer only
+  WebSocketsClient webSocket;
+  boolean pushEnabled = false;
+  boolean pushStarted = false;
+  boolean pushConnected = false;
+  boolean pushReauth = false;
+  String pushUser = "";
+  String pushSession = "";
+  unsigned long lastPushAttempt = 0;
+  unsigned long lastPushMessage = 0;
+  unsigned long pushMessages = 0;
+  unsigned long pushBytes = 0;
+  unsigned long pushWindowStart = 0;
+  unsigned long pushWindowBytes = 0;
+  unsigned long pushBytesPerMinute = 0;
+
+  boolean pushLogin();
+  void startPush();
+  void stopPush();
+  void sendPushAuth();
+  void onPushEvent(WStype_t type, uint8_t *payload, size_t length);
+  void readPushMessage(uint8_t *payload, size_t length);
+
 
-  
 public:
   OctoPrintClient(String ApiKey, String server, int port, String user, String pass);
   void getPrinterJobResults();
+  boolean isDue();
   void updateOctoPrintClient(String ApiKey, String server, int port, String user, String pass);
+  void setPrinter(int index, String ApiKey, String server, int port);
+  void setAuth(String user, String pass);
+  void setPushEnabled(boolean enabled);
+  void handlePush();
+  void maintainPush();
+  boolean isPushActive();
+  unsigned long getPushMessages();
+  unsigned long getPushBytesPerMinute();
+  unsigned long getLastBatchMillis();
 
-  String getAveragePrintTime();
-  String getEstimatedPrintTime();
-  String getFileName();
-  String getFileSize();
-  String getLastPrintTime();
-  String getProgressCompletion();
-  String getProgressFilepos();
-  String getProgressPrintTime();
-  String getProgressPrintTimeLeft();
-  String getState();
-  boolean isPrinting();
-  boolean isOperational();
-  String getError();
+  boolean isConfigured(int index);
+  int getPrinterCount();
+  int getPrintingCount();
+  String getServer(int index);
+  long getSecondsSinceProgressChange(int index);
+  long getSecondsToNextPoll(int index);
+  String getAveragePrintTime(int index);
+  String getEstimatedPrintTime(int index);
+  String getFileName(int index);
+  String getFileSize(int index);
+  String getLastPrintTime(int index);
+  String getProgressCompletion(int index);
+  float getProgressCompletionValue(int index);
+  float getEstimateError(int index);
+  int getEstimateSamples(int index);
+  String getProgressFilepos(int index);
+  String getProgressPrintTime(int index);
+  String getProgressPrintTimeLeft(int index);
+  String getState(int index);
+  boolean isPrinting(int index);
+  boolean isOperational(int index);
+  String getError(int index);
+  SourceHealth &getHealth(int index);
+  JsonBudget &getJsonBudget();
 };
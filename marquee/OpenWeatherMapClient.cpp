@@ -22,6 +22,8 @@ SOFTWARE.
 */
 
 #include "OpenWeatherMapClient.h"
+#include "DnsCache.h"
+#include "JsonFilters.h"
 #include "math.h"
 
 OpenWeatherMapClient::OpenWeatherMapClient(String ApiKey, int CityIDs[], int cityCount, boolean isMetric) {
@@ -35,19 +37,38 @@ void OpenWeatherMapClient::updateWeatherApiKey(String ApiKey) {
 }
 
 void OpenWeatherMapClient::updateWeather() {
-  WiFiClient weatherClient;
   if (myApiKey == "") {
-    weathers[0].error = "Please provide an API key for weather.";
-    Serial.println(weathers[0].error);
+    error = "Please provide an API key for weather.";
+    Serial.println(error);
     return;
   }
-  String apiGetData = "GET /data/2.5/group?id=" + myCityIDs + "&units=" + units + "&cnt=1&APPID=" + myApiKey + " HTTP/1.1";
+  String apiGetData = "GET /data/2.5/group?id=" + myCityIDs + "&units=metric&APPID=" + myApiKey + " HTTP/1.1";
 
   Serial.println("Getting Weather Data");
   Serial.println(apiGetData);
-  weathers[0].cached = false;
-  weathers[0].error = "";
-  if (weatherClient.connect(servername, 80)) {  //starts client connection, checks for connection
+  cached = false;
+  error = "";
+  // the BearSSL client and its buffers only exist when HTTPS is on
+  WiFiClient plainClient;
+  std::unique_ptr<BearSSL::WiFiClientSecure> secureClient(useTls ? new BearSSL::WiFiClientSecure() : nullptr);
+  WiFiClient &weatherClient = useTls ? *secureClient : plainClient;
+  boolean connected = false;
+  if (useTls) {
+    connected = tls.connect(*secureClient, servername);
+    if (!connected) {
+      error = tls.getLastError();
+      return;
+    }
+  } else {
+    IPAddress serverIp;
+    if (!dnsCache.resolve(servername, serverIp)) {
+      error = "Unable to resolve " + String(servername);
+      Serial.println(error);
+      return;
+    }
+    connected = plainClient.connect(serverIp, 80);
+  }
+  if (connected) {  //starts client connection, checks for connection
     weatherClient.println(apiGetData);
     weatherClient.println("Host: " + String(servername));
     weatherClient.println("User-Agent: ArduinoWiFi/1.1");
@@ -57,7 +78,7 @@ void OpenWeatherMapClient::updateWeather() {
   else {
     Serial.println("connection for weather data failed"); //error message if no client connect
     Serial.println();
-    weathers[0].error = "Connection for weather data failed";
+    error = "Connection for weather data failed";
     return;
   }
 
@@ -72,7 +93,7 @@ void OpenWeatherMapClient::updateWeather() {
   if (strcmp(status, "HTTP/1.1 200 OK") != 0) {
     Serial.print(F("Unexpected response: "));
     Serial.println(status);
-    weathers[0].error = "Weather Data Error: " + String(status);
+    error = "Weather Data Error: " + String(status);
     return;
   }
 
@@ -83,83 +104,59 @@ void OpenWeatherMapClient::updateWeather() {
     return;
   }
 
-  // const size_t bufferSize = 710;
-  JsonDocument jdoc;
+  JsonDocument filter(&jsonArena);
+  deserializeJson(filter, FPSTR(WEATHER_FILTER));
+  JsonDocument jdoc(&jsonBudget);
 
-  // Parse JSON object
-  DeserializationError error = deserializeJson(jdoc, weatherClient);
-  // JsonObject& root = jsonBuffer.parseObject(weatherClient);
-  if (error) {
-    Serial.println(F("Weather Data Parsing failed!"));
-    weathers[0].error = "Weather Data Parsing failed!";
+  // Parse JSON object -- only the filtered fields are kept
+  DeserializationError parseError = deserializeJson(jdoc, weatherClient, DeserializationOption::Filter(filter));
+  if (parseError) {
+    Serial.println("Weather Data Parsing failed! " + String(parseError.c_str()));
+    error = "Weather Data Parsing failed!";
     return;
   }
 
   weatherClient.stop(); //stop client
 
-  if (size_t jlen = measureJson(jdoc) <= 150) {
-    Serial.println("Error Does not look like we got the data.  Size: " + String(jlen));
-    weathers[0].cached = true;
-    weathers[0].error = jdoc["message"].as<String>();
-    Serial.println("Error: " + weathers[0].error);
+  if (jdoc["list"].size() == 0) {
+    Serial.println("Error Does not look like we got the data.");
+    cached = true;
+    error = jdoc["message"].as<String>();
+    Serial.println("Error: " + error);
     return;
   }
-  int count = jdoc["cnt"];
-
-  for (int inx = 0; inx < count; inx++) {
-    weathers[inx].lon       = jdoc["list"][inx]["coord"]["lon"].as<String>();
-    weathers[inx].lat       = jdoc["list"][inx]["coord"]["lat"].as<String>();
-    weathers[inx].dt        = jdoc["list"][inx]["dt"].as<String>();
-    weathers[inx].city      = jdoc["list"][inx]["name"].as<String>();
-    weathers[inx].country   = jdoc["list"][inx]["sys"]["country"].as<String>();
-    weathers[inx].temp      = jdoc["list"][inx]["main"]["temp"].as<String>();
-    weathers[inx].humidity  = jdoc["list"][inx]["main"]["humidity"].as<String>();
-    weathers[inx].condition = jdoc["list"][inx]["weather"][0]["main"].as<String>();
-    weathers[inx].wind      = jdoc["list"][inx]["wind"]["speed"].as<String>();
-    weathers[inx].weatherId = jdoc["list"][inx]["weather"][0]["id"].as<String>();
-    weathers[inx].description = jdoc["list"][inx]["weather"][0]["description"].as<String>();
-    weathers[inx].icon      = jdoc["list"][inx]["weather"][0]["icon"].as<String>();
-    weathers[inx].pressure  = jdoc["list"][inx]["main"]["pressure"].as<String>();
-    weathers[inx].direction = jdoc["list"][inx]["wind"]["deg"].as<String>();
-    weathers[inx].high      = jdoc["list"][inx]["main"]["temp_max"].as<String>();
-    weathers[inx].low       = jdoc["list"][inx]["main"]["temp_min"].as<String>();
-    weathers[inx].timeZone  = jdoc["list"][inx]["sys"]["timezone"].as<String>();
-
-    if (units == "metric") {
-      // convert to kph from m/s
-      float f = (weathers[inx].wind.toFloat() * 3.6);
-      weathers[inx].wind = String(f);
+  // The group endpoint returns the cities in the order they were requested
+  int inx = 0;
+  for (JsonObject city : jdoc["list"].as<JsonArray>()) {
+    if (inx >= MAX_CITIES) {
+      break;
     }
-
-    if (units != "metric")
-    {
-      float p = (weathers[inx].pressure.toFloat() * 0.0295301); //convert millibars to inches
-      weathers[inx].pressure = String(p);
-    }
-    
-    Serial.println("lat: " + weathers[inx].lat);
-    Serial.println("lon: " + weathers[inx].lon);
-    Serial.println("dt: " + weathers[inx].dt);
-    Serial.println("city: " + weathers[inx].city);
-    Serial.println("country: " + weathers[inx].country);
-    Serial.println("temp: " + weathers[inx].temp);
-    Serial.println("humidity: " + weathers[inx].humidity);
-    Serial.println("condition: " + weathers[inx].condition);
-    Serial.println("wind: " + weathers[inx].wind);
-    Serial.println("direction: " + weathers[inx].direction);
-    Serial.println("weatherId: " + weathers[inx].weatherId);
-    Serial.println("description: " + weathers[inx].description);
-    Serial.println("icon: " + weathers[inx].icon);
-    Serial.println("timezone: " + String(getTimeZone(inx)));
+    weather &w = weathers[inx];
+    w.lon       = city["coord"]["lon"];
+    w.lat       = city["coord"]["lat"];
+    w.dt        = city["dt"];
+    strlcpy(w.city, city["name"] | "", sizeof(w.city));
+    strlcpy(w.country, city["sys"]["country"] | "", sizeof(w.country));
+    w.temp      = city["main"]["temp"];
+    w.humidity  = city["main"]["humidity"];
+    strlcpy(w.condition, city["weather"][0]["main"] | "", sizeof(w.condition));
+    w.wind      = city["wind"]["speed"];
+    w.weatherId = city["weather"][0]["id"];
+    strlcpy(w.description, city["weather"][0]["description"] | "", sizeof(w.description));
+    strlcpy(w.icon, city["weather"][0]["icon"] | "", sizeof(w.icon));
+    w.pressure  = city["main"]["pressure"];
+    w.direction = city["wind"]["deg"];
+    w.high      = city["main"]["temp_max"];
+    w.low       = city["main"]["temp_min"];
+    w.timeZone  = city["sys"]["timezone"];
+
+    Serial.printf("city: %s, %s (%.4f, %.4f) dt: %lu timezone: %d\n", w.city, w.country, w.lat, w.lon, (unsigned long)w.dt, getTimeZone(inx));
+    Serial.printf("temp: %.1f C humidity: %u%% pressure: %.0f hPa wind: %.1f m/s @ %u\n", w.temp, w.humidity, w.pressure, w.wind, w.direction);
+    Serial.printf("condition: %s (%s) weatherId: %u icon: %s\n", w.condition, w.description, w.weatherId, w.icon);
     Serial.println();
-    
+    inx++;
   }
-}
-
-String OpenWeatherMapClient::roundValue(String value) {
-  float f = value.toFloat();
-  int rounded = (int)(f+0.5f);
-  return String(rounded);
+  cityCount = inx;
 }
 
 void OpenWeatherMapClient::updateCityIdList(int CityIDs[], int cityCount) {
@@ -174,121 +171,184 @@ void OpenWeatherMapClient::updateCityIdList(int CityIDs[], int cityCount) {
   }
 }
 
+void OpenWeatherMapClient::setTls(boolean enabled, const char* fingerprintP) {
+  useTls = enabled;
+  tls.setFingerprint(fingerprintP);
+}
+
+boolean OpenWeatherMapClient::isTlsEnabled() {
+  return useTls;
+}
+
+TlsSession &OpenWeatherMapClient::getTls() {
+  return tls;
+}
+
+// Only changes how the stored values are shown
 void OpenWeatherMapClient::setMetric(boolean isMetric) {
-  if (isMetric) {
-    units = "metric";
-  } else {
-    units = "imperial";
-  }
+  metric = isMetric;
+}
+
+float OpenWeatherMapClient::toDisplayTemp(float celsius) {
+  return metric ? celsius : (celsius * 1.8f) + 32.0f;
+}
+
+float OpenWeatherMapClient::getTempValue(int index) {
+  return toDisplayTemp(weathers[index].temp);
+}
+
+float OpenWeatherMapClient::getHighValue(int index) {
+  return toDisplayTemp(weathers[index].high);
+}
+
+float OpenWeatherMapClient::getLowValue(int index) {
+  return toDisplayTemp(weathers[index].low);
+}
+
+// kph or mph
+float OpenWeatherMapClient::getWindValue(int index) {
+  return weathers[index].wind * (metric ? 3.6f : 2.236936f);
+}
+
+// millibars or inches of mercury
+float OpenWeatherMapClient::getPressureValue(int index) {
+  return metric ? weathers[index].pressure : weathers[index].pressure * 0.0295301f;
+}
+
+int OpenWeatherMapClient::getHumidityValue(int index) {
+  return weathers[index].humidity;
+}
+
+int OpenWeatherMapClient::getDirectionValue(int index) {
+  return weathers[index].direction;
+}
+
+const char* OpenWeatherMapClient::getCityName(int index) {
+  return weathers[index].city;
+}
+
+const char* OpenWeatherMapClient::getDescriptionText(int index) {
+  return weathers[index].description;
+}
+
+const char* OpenWeatherMapClient::getDirectionAbbrev(int index) {
+  static const char* const directions[] = {"N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW"};
+  int val = (int)((weathers[index].direction / 22.5f) + 0.5f);
+  return directions[val % 16];
 }
 
 String OpenWeatherMapClient::getLat(int index) {
-  return weathers[index].lat;
+  return String(weathers[index].lat, 4);
 }
 
 String OpenWeatherMapClient::getLon(int index) {
-  return weathers[index].lon;
+  return String(weathers[index].lon, 4);
 }
 
 String OpenWeatherMapClient::getDt(int index) {
-  return weathers[index].dt;
+  return String(weathers[index].dt);
 }
 
 String OpenWeatherMapClient::getCity(int index) {
-  return weathers[index].city;
+  return String(weathers[index].city);
 }
 
 String OpenWeatherMapClient::getCountry(int index) {
-  return weathers[index].country;
+  return String(weathers[index].country);
 }
 
 String OpenWeatherMapClient::getTemp(int index) {
-  return weathers[index].temp;
+  return String(getTempValue(index), 1);
 }
 
 String OpenWeatherMapClient::getTempRounded(int index) {
-  return roundValue(getTemp(index));
+  return String(lroundf(getTempValue(index)));
 }
 
 String OpenWeatherMapClient::getHumidity(int index) {
-  return weathers[index].humidity;
+  return String(weathers[index].humidity);
 }
 
 String OpenWeatherMapClient::getHumidityRounded(int index) {
-  return roundValue(getHumidity(index));
+  return getHumidity(index);
 }
 
 String OpenWeatherMapClient::getCondition(int index) {
-  return weathers[index].condition;
+  return String(weathers[index].condition);
 }
 
 String OpenWeatherMapClient::getWind(int index) {
-  return weathers[index].wind;
+  return String(getWindValue(index), 1);
 }
 
 String OpenWeatherMapClient::getDirection(int index)
 {
-  return weathers[index].direction;
+  return String(weathers[index].direction);
 }
 
 String OpenWeatherMapClient::getDirectionRounded(int index)
 {
-  return roundValue(getDirection(index));
+  return getDirection(index);
 }
 
 String OpenWeatherMapClient::getDirectionText(int index) {
-  int num = getDirectionRounded(index).toInt();
-  int val = floor((num / 22.5) + 0.5);
-  String arr[] = {"N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW"};
-  return arr[(val % 16)];
+  return String(getDirectionAbbrev(index));
 }
 
 String OpenWeatherMapClient::getWindRounded(int index) {
-  return roundValue(getWind(index));
+  return String(lroundf(getWindValue(index)));
 }
 
 String OpenWeatherMapClient::getWeatherId(int index) {
-  return weathers[index].weatherId;
+  return String(weathers[index].weatherId);
 }
 
 String OpenWeatherMapClient::getDescription(int index) {
-  return weathers[index].description;
+  return String(weathers[index].description);
 }
 
 String OpenWeatherMapClient::getPressure(int index)
 {
-  return weathers[index].pressure;
+  return String(getPressureValue(index), metric ? 0 : 2);
 }
 
 String OpenWeatherMapClient::getHigh(int index)
 {
-  return roundValue(weathers[index].high);
+  return String(lroundf(getHighValue(index)));
 }
 
 String OpenWeatherMapClient::getLow(int index)
 {
-  return roundValue(weathers[index].low);
+  return String(lroundf(getLowValue(index)));
 }
 
 String OpenWeatherMapClient::getIcon(int index) {
-  return weathers[index].icon;
+  return String(weathers[index].icon);
 }
 
 boolean OpenWeatherMapClient::getCached() {
-  return weathers[0].cached;
+  return cached;
 }
 
 String OpenWeatherMapClient::getMyCityIDs() {
   return myCityIDs;
 }
 
+int OpenWeatherMapClient::getCityCount() {
+  return cityCount;
+}
+
+JsonBudget &OpenWeatherMapClient::getJsonBudget() {
+  return jsonBudget;
+}
+
 String OpenWeatherMapClient::getError() {
-  return weathers[0].error;
+  return error;
 }
 
 String OpenWeatherMapClient::getWeekDay(int index, float offset) {
   String rtnValue = "";
-  long epoc = weathers[index].dt.toInt();
+  long epoc = weathers[index].dt;
   long day = 0;
   if (epoc != 0) { 
     day = (((epoc + (3600 * (int)offset)) / 86400) + 4) % 7;
@@ -322,7 +382,7 @@ String OpenWeatherMapClient::getWeekDay(int index, float offset) {
 }
 
 int OpenWeatherMapClient::getTimeZone(int index) {
-  int rtnValue = weathers[index].timeZone.toInt();
+  int rtnValue = weathers[index].timeZone;
   if (rtnValue != 0) {
     rtnValue = rtnValue / 3600;
   }
@@ -330,7 +390,7 @@ int OpenWeatherMapClient::getTimeZone(int index) {
 }
 
 String OpenWeatherMapClient::getWeatherIcon(int index) {
-  int id = getWeatherId(index).toInt();
+  int id = weathers[index].weatherId;
   String W = ")";
   switch(id)
   {
@@ -24,41 +24,51 @@ SOFTWARE.
 #pragma once
 #include <ESP8266WiFi.h>
 #include <ArduinoJson.h>
+#include "JsonLimits.h"
+#include "TlsSession.h"
+
+#define MAX_CITIES 5  // cities fetched together in one group request
 
 class OpenWeatherMapClient {
 
 private:
   String myCityIDs = "";
   String myApiKey = "";
-  String units = "";
+  boolean metric = false;
+  boolean useTls = false;
+  TlsSession tls = TlsSession("OpenWeatherMap");
   
   const char* servername = "api.openweathermap.org";  // remote server we will connect to
 
+  // Values are kept as fetched in metric/SI units and converted when displayed,
+  // so switching units needs no new request
   typedef struct {
-    String lat;
-    String lon;
-    String dt;
-    String city;
-    String country;
-    String temp;
-    String humidity;
-    String condition;
-    String wind;
-    String weatherId;
-    String description;
-    String icon;
-    boolean cached;
-    String error;
-    String pressure;
-    String direction;
-    String high;
-    String low;
-    String timeZone;
+    float lat;
+    float lon;
+    uint32_t dt;
+    char city[40];
+    char country[4];
+    float temp;          // Celsius
+    uint8_t humidity;    // percent
+    char condition[16];
+    float wind;          // m/s
+    uint16_t weatherId;
+    char description[40];
+    char icon[4];
+    float pressure;      // hPa (millibars)
+    uint16_t direction;  // degrees
+    float high;          // Celsius
+    float low;           // Celsius
+    int32_t timeZone;    // seconds from UTC
   } weather;
 
-  weather weathers[5];
+  weather weathers[MAX_CITIES];
+  int cityCount = 0;
+  boolean cached = false;
+  String error = "";
+  JsonBudget jsonBudget = JsonBudget("Weather", JSON_BUDGET_WEATHER);
 
-  String roundValue(String value);
+  float toDisplayTemp(float celsius);
   
 public:
   OpenWeatherMapClient(String ApiKey, int CityIDs[], int cityCount, boolean isMetric);
@@ -66,6 +76,21 @@ public:
   void updateWeatherApiKey(String ApiKey);
   void updateCityIdList(int CityIDs[], int cityCount);
   void setMetric(boolean isMetric);
+  void setTls(boolean enabled, const char* fingerprintP);
+  boolean isTlsEnabled();
+  TlsSession &getTls();
+
+  // Numeric values in the display units (Celsius/kph/mbar or Fahrenheit/mph/inHg)
+  float getTempValue(int index);
+  float getHighValue(int index);
+  float getLowValue(int index);
+  float getWindValue(int index);
+  float getPressureValue(int index);
+  int getHumidityValue(int index);
+  int getDirectionValue(int index);
+  const char* getCityName(int index);
+  const char* getDescriptionText(int index);
+  const char* getDirectionAbbrev(int index);
 
   String getLat(int index);
   String getLon(int index);
@@ -90,6 +115,8 @@ public:
   String getIcon(int index);
   boolean getCached();
   String getMyCityIDs();
+  int getCityCount();
+  JsonBudget &getJsonBudget();
   String getWeatherIcon(int index);
   String getError();
   String getWeekDay(int index, float offset);
@@ -0,0 +1,184 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+#include "PageTemplate.h"
+
+PageTemplate::PageTemplate(ESP8266WebServer &server) : server(server) {
+  heapStart = ESP.getFreeHeap();
+  heapLow = heapStart;
+}
+
+PageTemplate::~PageTemplate() {
+  flush();
+}
+
+void PageTemplate::render(PGM_P templateP, const PageToken *tokensP, int count) {
+  char name[PAGE_TOKEN_LEN + 1];
+  PGM_P p = templateP;
+  char c;
+  while ((c = pgm_read_byte(p++)) != '\0') {
+    if (c != '%') {
+      print(c);
+      continue;
+    }
+    PGM_P start = p;
+    size_t length = 0;
+    while (length < PAGE_TOKEN_LEN) {
+      c = pgm_read_byte(p);
+      if (!isUpperCase(c) && !isDigit(c) && c != '_') {
+        break;
+      }
+      name[length++] = c;
+      p++;
+    }
+    name[length] = '\0';
+    TokenWriter writer = nullptr;
+    if (length > 0 && pgm_read_byte(p) == '%') {
+      writer = find(name, tokensP, count);
+    }
+    if (writer == nullptr) {
+      // not one of ours -- carry on from the character after the %
+      print('%');
+      p = start;
+      continue;
+    }
+    p++;
+    writer(*this);
+    sampleHeap();
+  }
+}
+
+TokenWriter PageTemplate::find(const char *name, const PageToken *tokensP, int count) {
+  for (int inx = 0; inx < count; inx++) {
+    if (strcmp_P(name, tokensP[inx].name) == 0) {
+      return (TokenWriter) pgm_read_ptr(&tokensP[inx].writer);
+    }
+  }
+  return nullptr;
+}
+
+void PageTemplate::print(char c) {
+  buffer[used++] = c;
+  if (used == sizeof(buffer)) {
+    flush();
+  }
+}
+
+void PageTemplate::print(const char *text) {
+  while (*text != '\0') {
+    print(*text++);
+  }
+}
+
+void PageTemplate::print(const String &text) {
+  print(text.c_str());
+}
+
+void PageTemplate::print(const __FlashStringHelper *text) {
+  print_P((PGM_P) text);
+}
+
+void PageTemplate::print(int number) {
+  print((long) number);
+}
+
+void PageTemplate::print(long number) {
+  char digits[12];
+  ltoa(number, digits, 10);
+  print(digits);
+}
+
+void PageTemplate::print_P(PGM_P textP) {
+  char c;
+  while ((c = pgm_read_byte(textP++)) != '\0') {
+    print(c);
+  }
+}
+
+void PageTemplate::printAttribute(const char *text) {
+  for (; *text != '\0'; text++) {
+    if (*text == '&') {
+      print("&amp;");
+    } else if (*text == '\'') {
+      print("&#39;");
+    } else {
+      print(*text);
+    }
+  }
+}
+
+void PageTemplate::printAttribute(const String &text) {
+  printAttribute(text.c_str());
+}
+
+void PageTemplate::printText(const char *text) {
+  for (; *text != '\0'; text++) {
+    switch (*text) {
+      case '&': print("&amp;"); break;
+      case '<': print("&lt;"); break;
+      case '>': print("&gt;"); break;
+      case '"': print("&quot;"); break;
+      case '\'': print("&#39;"); break;
+      default: print(*text);
+    }
+  }
+}
+
+void PageTemplate::printText(const String &text) {
+  printText(text.c_str());
+}
+
+void PageTemplate::printChecked(boolean checked) {
+  if (checked) {
+    print(F("checked='checked'"));
+  }
+}
+
+void PageTemplate::printOption(const char *value, const char *label, boolean selected) {
+  print(F("<option value='"));
+  print(value);
+  print(selected ? F("' selected>") : F("'>"));
+  print(label);
+  print(F("</option>"));
+}
+
+void PageTemplate::flush() {
+  if (used > 0) {
+    server.sendContent(buffer, used);
+    used = 0;
+  }
+  sampleHeap();
+}
+
+void PageTemplate::sampleHeap() {
+  uint32_t heap = ESP.getFreeHeap();
+  if (heap < heapLow) {
+    heapLow = heap;
+  }
+}
+
+uint32_t PageTemplate::getHeapUsed() {
+  return heapStart - heapLow;
+}
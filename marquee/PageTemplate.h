@@ -0,0 +1,83 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+#pragma once
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+
+#define PAGE_BUFFER_SIZE 256   // bytes collected before they go out as one chunk
+#define PAGE_TOKEN_LEN 23      // longest %TOKEN% name
+
+class PageTemplate;
+
+// Writes the value of one %TOKEN% to the page
+typedef void (*TokenWriter)(PageTemplate &page);
+
+// Kept in PROGMEM -- the name is stored without the % signs
+typedef struct {
+  char name[PAGE_TOKEN_LEN + 1];
+  TokenWriter writer;
+} PageToken;
+
+/* Streams a PROGMEM template to the web client. Text is copied from flash
+   into a small buffer that is sent whenever it fills, and each %TOKEN% is
+   handed to its writer from the token table as it is reached, so the page
+   is never held in RAM. A % that doesn't start a known token is sent as is.
+
+   The least free heap is sampled at every chunk and token, which gives the
+   heap the page took beyond what was free when it started.
+*/
+class PageTemplate {
+
+public:
+  PageTemplate(ESP8266WebServer &server);
+  ~PageTemplate();
+  void render(PGM_P templateP, const PageToken *tokensP, int count);
+  void print(char c);
+  void print(const char *text);
+  void print(const String &text);
+  void print(const __FlashStringHelper *text);
+  void print(int number);
+  void print(long number);
+  void print_P(PGM_P textP);
+  void printAttribute(const char *text);   // & and ' escaped, for values in '...'
+  void printAttribute(const String &text);
+  void printText(const char *text);        // & < > " ' escaped, for text from elsewhere
+  void printText(const String &text);
+  void printChecked(boolean checked);
+  void printOption(const char *value, const char *label, boolean selected);
+  void flush();
+  uint32_t getHeapUsed();
+
+private:
+  ESP8266WebServer &server;
+  char buffer[PAGE_BUFFER_SIZE];
+  size_t used = 0;
+  uint32_t heapStart;
+  uint32_t heapLow;
+
+  TokenWriter find(const char *name, const PageToken *tokensP, int count);
+  void sampleHeap();
+};
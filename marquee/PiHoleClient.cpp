@@ -23,28 +23,65 @@ SOFTWARE.
 */
 
 #include "PiHoleClient.h"
-#include <cmath>
+#include "DnsCache.h"
+#include "JsonFilters.h"
 #include <StreamUtils.h>
 
-JsonDocument PiHoleClient::queryApi(String urlPath, String sid) {
-  errorMessage = "";
-  String httpServer = "http://" + server + ":" + String(port);
+// A changed address or key starts the instance over: new session, no cached data
+void PiHoleClient::setInstance(int index, String server, int port, String apiKey) {
+  if (index < 0 || index >= MAX_PIHOLES) {
+    return;
+  }
+  Instance &pihole = instances[index];
+  server.trim();
+  apiKey.trim();
+  if (pihole.server == server && pihole.port == port && pihole.apiKey == apiKey) {
+    return;
+  }
+  pihole.server = server;
+  pihole.port = port;
+  pihole.apiKey = apiKey;
+  pihole.sid = "";
+  pihole.error = "";
+  pihole.summary = {};
+  pihole.hasSummary = false;
+  pihole.historyCount = 0;
+  health[index].reset();
+  mergeSummaries();
+  mergeGraphData();
+}
+
+boolean PiHoleClient::isConfigured(Instance &pihole) {
+  return !pihole.server.isEmpty() && pihole.port != 0;
+}
+
+// Pi-hole doesn't depend on the Host header, so the URL can carry the cached address
+String PiHoleClient::baseUrl(Instance &pihole) {
+  IPAddress serverIp;
+  String host = pihole.server;
+  if (dnsCache.resolve(pihole.server.c_str(), serverIp)) {
+    host = serverIp.toString();
+  }
+  return "http://" + host + ":" + String(pihole.port);
+}
+
+JsonDocument PiHoleClient::queryApi(Instance &pihole, String urlPath, const char* filterSpec) {
+  pihole.error = "";
+  String httpServer = baseUrl(pihole);
   String response = "";
   String apiGetData;
-  JsonDocument errordoc;
-  errordoc["isError"] = true;
-  errordoc["errorMsg"] = "No Error";
 
-  if (this->apiKey == "") {
-    errorMessage = "Pi-hole API Key Password is required to view Summary Data.";
-    Serial.println(errorMessage);
-    errordoc["errormsg"] = "NoKey";
-    return errordoc;
+  // On failure pihole.error says why and the caller gets an empty document
+  if (pihole.apiKey == "") {
+    pihole.error = "Pi-hole API Key Password is required to view Summary Data.";
+    Serial.println(pihole.error);
+    return JsonDocument(&jsonBudget);
   }
 
   WiFiClient client;
 
   HTTPClient http;
+  http.setTimeout(PIHOLE_TIMEOUT_MS);
   http.addHeader("Content-Type", "application/json");
   // For debugging, save header data
   const char* headerKeys[] = {"Date", "Content-Type", "Content-Length"};
@@ -53,11 +90,9 @@ JsonDocument PiHoleClient::queryApi(String urlPath, String sid) {
 
   int httpCode = -1;
 
-  JsonDocument jdoc;
-
   int attempts = 0;
   do {
-    apiGetData = httpServer + urlPath + ( urlPath.indexOf('?') > 0 ? "&" : "?") + "sid=" + sid;
+    apiGetData = httpServer + urlPath + ( urlPath.indexOf('?') > 0 ? "&" : "?") + "sid=" + pihole.sid;
 
     Serial.print("Attempt "+ String(attempts) + ": Using " + apiGetData);
     if (http.begin(client, apiGetData)) {
@@ -65,12 +100,15 @@ JsonDocument PiHoleClient::queryApi(String urlPath, String sid) {
        Serial.println(" -> (" + String(httpCode) + ")");
     } else {
        Serial.printf("\n[HTTP] Unable to connect\n");
-       errordoc["errorMsg"] = "No Connect";
-       return errordoc;
+       pihole.error = "Unable to connect to " + httpServer;
+       return JsonDocument(&jsonBudget);
     }
     if (httpCode == 403 || httpCode == 401) {
-      Serial.println("Old SID: "  + sid);
-      sid = authGetSid(apiKey);
+      Serial.println("Old SID: "  + pihole.sid);
+      http.end();
+      pihole.sid = authGetSid(pihole);
+    } else {
+      break; // only an expired session is worth retrying -- a dead host would just time out again
     }
     attempts++;
   } while ((httpCode != 200) && (attempts < 3));
@@ -81,12 +119,10 @@ JsonDocument PiHoleClient::queryApi(String urlPath, String sid) {
     
     if (httpCode != 200) {
       // Bad Response Code
-      errorMessage = "Error response (" + String(httpCode) + "): " + response;
-      Serial.println(errorMessage);
+      pihole.error = "Error response (" + String(httpCode) + "): " + response;
+      Serial.println(pihole.error);
       http.end();
-      errordoc["errorMsg"] = "HTTP Error Code " + String(httpCode);
-      errordoc["httpcode"] = String(httpCode);
-      return errordoc;
+      return JsonDocument(&jsonBudget);
     }
     // Serial.println("API call response-code: " + String(httpCode));
     // Serial.println("Response: " + response);
@@ -97,32 +133,38 @@ JsonDocument PiHoleClient::queryApi(String urlPath, String sid) {
         Serial.println(http.header(i));
     }
   } else {
-    errorMessage = "Failed to connect and get data: " + http.errorToString(httpCode);
-    Serial.println(errorMessage);
+    pihole.error = "Failed to connect and get data: " + http.errorToString(httpCode);
+    Serial.println(pihole.error);
     http.end();
-    errordoc["errorMsg"] = errorMessage;
-    return errordoc;
+    return JsonDocument(&jsonBudget);
   }
+  http.end();
 
   // Parse JSON object
-  DeserializationError error = deserializeJson(jdoc, response);
+  JsonDocument filter(&jsonArena);
+  deserializeJson(filter, FPSTR(filterSpec));
+  JsonDocument jdoc(&jsonBudget);
+  DeserializationError error = deserializeJson(jdoc, response, DeserializationOption::Filter(filter));
   if (!error) return jdoc;
   else { 
-    errordoc["errorMsg"] = "Json Parse error: " + String(error.c_str());
-    return errordoc;
+    pihole.error = "Json Parse error: " + String(error.c_str());
+    return JsonDocument(&jsonBudget);
   }
 }
 
-String PiHoleClient::authGetSid(String apiKey) {
-    Serial.println("authGetSid()");
-    sid = "NoAuth";
-    String apiAuth = "http://" + server + ":" + String(port) + "/api/auth";
-    String authPayload = R"({"password":")" + apiKey + R"("})";
+String PiHoleClient::authGetSid(Instance &pihole) {
+    Serial.println("authGetSid() " + pihole.server);
+    String sid = "NoAuth";
+    String apiAuth = baseUrl(pihole) + "/api/auth";
+    String authPayload = R"({"password":")" + pihole.apiKey + R"("})";
     WiFiClient client;
     HTTPClient http;
+    http.setTimeout(PIHOLE_TIMEOUT_MS);
     http.addHeader("Content-Type", "application/json");
 
-    JsonDocument jdoc;
+    JsonDocument filter(&jsonArena);
+    deserializeJson(filter, FPSTR(AUTH_FILTER));
+    JsonDocument jdoc(&jsonBudget);
 
     Serial.println(apiAuth + " with " + authPayload);
 
@@ -130,7 +172,7 @@ String PiHoleClient::authGetSid(String apiKey) {
       int httpCode = http.POST(authPayload);
       if (httpCode == 200) {
         String authReply = http.getString();
-        deserializeJson(jdoc, authReply);
+        deserializeJson(jdoc, authReply, DeserializationOption::Filter(filter));
         sid = jdoc["session"]["sid"].as<String>();
         if (sid.isEmpty()) {
           Serial.println("SID not found");
@@ -149,36 +191,64 @@ String PiHoleClient::authGetSid(String apiKey) {
     return sid;
 }
 
-String PiHoleClient::getStatus() {
+uint8_t PiHoleClient::getStatus(Instance &pihole) {
   Serial.println("getStatus()");
-  if (server.isEmpty() || port == 0 || apiKey.isEmpty()) {
-    return "Object Not Initialized";
+  if (!isConfigured(pihole) || pihole.apiKey.isEmpty()) {
+    return STATUS_UNKNOWN;
   }
 
-  if (sid.isEmpty()) {
-    sid = authGetSid(apiKey);
+  if (pihole.sid.isEmpty()) {
+    pihole.sid = authGetSid(pihole);
   }
 
-  JsonDocument jdoc = queryApi("/api/info/login", sid);
+  JsonDocument jdoc = queryApi(pihole, "/api/info/login", LOGIN_FILTER);
 
   bool isDns = jdoc["dns"];
-  // piHoleData.piHoleStatus = isDns ? "Running" : "Stopped";
-  return ( isDns ? "Blocking" : "Disabled" );
+  return ( isDns ? STATUS_BLOCKING : STATUS_DISABLED );
 }
 
+// The instances are asked one after the other (HTTPClient blocks), each with a short
+// timeout and its own breaker so a dead one costs one timeout per probe at most
 void PiHoleClient::getPiHoleData() {
   Serial.println("getPiHoleData()");
 
-  if (server.isEmpty() || port == 0 || apiKey.isEmpty()) {
+  if (getInstanceCount() == 0) {
     Serial.println("Object Not Initialized");
     return; 
   }
 
-  if (sid.isEmpty()) {
-    sid = authGetSid(apiKey);
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    fetchSummary(inx);
   }
+  mergeSummaries();
+
+  Serial.println("Pi-Hole Status: " + getPiHoleStatus() + " (" + String(getAnsweringCount()) + "/" + String(getInstanceCount()) + " answering)");
+  Serial.println("Todays Percentage Blocked: " + getAdsPercentageToday());
+  Serial.println();
+}
 
-  JsonDocument jdoc = queryApi("/api/stats/summary", sid);
+void PiHoleClient::fetchSummary(int index) {
+  Instance &pihole = instances[index];
+  if (!isConfigured(pihole)) {
+    return;
+  }
+
+  if (!health[index].allowRequest()) {
+    Serial.println(pihole.server + " unavailable, serving cached data (next probe in " + String(health[index].getSecondsToNextProbe()) + "s)");
+    return;
+  }
+
+  if (pihole.sid.isEmpty()) {
+    pihole.sid = authGetSid(pihole);
+  }
+
+  JsonDocument jdoc = queryApi(pihole, "/api/stats/summary", SUMMARY_FILTER);
+  if (pihole.error != "") {
+    // keep the last known summary in the totals
+    health[index].recordFailure();
+    return;
+  }
+  health[index].recordSuccess();
 
   JsonObject queries = jdoc["queries"];
   JsonObject gravity = jdoc["gravity"];
@@ -186,81 +256,148 @@ void PiHoleClient::getPiHoleData() {
   JsonObject clients = jdoc["clients"];
   JsonObject replies = jdoc["replies"];
 
-  piHoleData.domains_being_blocked = gravity["domains_being_blocked"].as<String>();
-  piHoleData.dns_queries_today     = queries["total"].as<String>();
-  piHoleData.ads_blocked_today     = queries["blocked"].as<String>();
-  float pct_blocked = queries["percent_blocked"];
-  pct_blocked = std::round(pct_blocked*10)/10;
-  piHoleData.ads_percentage_today  = String(pct_blocked);
-  piHoleData.unique_domains        = queries["unique_domains"].as<String>();
-  piHoleData.queries_forwarded     = queries["forwarded"].as<String>();
-  piHoleData.queries_cached        = queries["cached"].as<String>();
-  piHoleData.clients_ever_seen     = clients["total"].as<String>();
-  piHoleData.unique_clients        = clients["active"].as<String>();
-  unsigned int dnsTotalQueries = 0;
+  phd &summary = pihole.summary;
+  summary.domains_being_blocked = gravity["domains_being_blocked"];
+  summary.dns_queries_today     = queries["total"];
+  summary.ads_blocked_today     = queries["blocked"];
+  summary.ads_percentage_today  = queries["percent_blocked"];
+  summary.unique_domains        = queries["unique_domains"];
+  summary.queries_forwarded     = queries["forwarded"];
+  summary.queries_cached        = queries["cached"];
+  summary.clients_ever_seen     = clients["total"];
+  summary.unique_clients        = clients["active"];
+  uint32_t dnsTotalQueries = 0;
   for ( auto qt : query_types ) {
-    JsonVariant value = qt.value();
-    dnsTotalQueries += value.as<int>();
+    dnsTotalQueries += qt.value().as<uint32_t>();
   }
-  piHoleData.dns_queries_all_types = String(dnsTotalQueries);
-  piHoleData.reply_NODATA = replies["NODATA"].as<String>();
-  piHoleData.reply_NXDOMAIN = replies["NXDOMAIN"].as<String>();
-  piHoleData.reply_CNAME = replies["CNAME"].as<String>();
-  piHoleData.reply_IP = replies["IP"].as<String>();
+  summary.dns_queries_all_types = dnsTotalQueries;
+  summary.reply_NODATA = replies["NODATA"];
+  summary.reply_NXDOMAIN = replies["NXDOMAIN"];
+  summary.reply_CNAME = replies["CNAME"];
+  summary.reply_IP = replies["IP"];
 
   /* This is not data part of the summary */
-  piHoleData.privacy_level = jdoc["privacy_level"].as<String>();
-  piHoleData.piHoleStatus = getStatus();
-
-  /*  Original
-  piHoleData.domains_being_blocked = (const char*)root["domains_being_blocked"];
-  piHoleData.dns_queries_today = (const char*)root["dns_queries_today"];
-  piHoleData.ads_blocked_today = (const char*)root["ads_blocked_today"];
-  piHoleData.ads_percentage_today = (const char*)root["ads_percentage_today"];
-  piHoleData.unique_domains = (const char*)root["unique_domains"];
-  piHoleData.queries_forwarded = (const char*)root["queries_forwarded"];
-  piHoleData.queries_cached = (const char*)root["queries_cached"];
-  piHoleData.clients_ever_seen = (const char*)root["clients_ever_seen"];
-  piHoleData.unique_clients = (const char*)root["unique_clients"];
-  piHoleData.dns_queries_all_types = (const char*)root["dns_queries_all_types"];
-  piHoleData.reply_NODATA = (const char*)root["reply_NODATA"];
-  piHoleData.reply_NXDOMAIN = (const char*)root["reply_NXDOMAIN"];
-  piHoleData.reply_CNAME = (const char*)root["reply_CNAME"];
-  piHoleData.reply_IP = (const char*)root["reply_IP"];
-  piHoleData.privacy_level = (const char*)root["privacy_level"];
-  piHoleData.piHoleStatus = (const char*)root["status"];
-  */
-
-  Serial.println("Pi-Hole Status: " + piHoleData.piHoleStatus);
-  Serial.println("Todays Percentage Blocked: " + piHoleData.ads_percentage_today);
-  Serial.println();
+  summary.privacy_level = jdoc["privacy_level"] | -1;
+  summary.piHoleStatus = getStatus(pihole);
+  pihole.hasSummary = true;
+}
+
+// Query counters add up; blocklist and client counts are mostly the same sets
+// seen from each instance, so the largest is the better estimate
+void PiHoleClient::mergeSummaries() {
+  piHoleData = {};
+  piHoleData.privacy_level = -1;
+  errorMessage = "";
+  boolean blocking = false;
+  boolean disabled = false;
+  boolean any = false;
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    Instance &pihole = instances[inx];
+    if (!isConfigured(pihole)) {
+      continue;
+    }
+    if (!pihole.hasSummary) {
+      if (errorMessage == "") {
+        errorMessage = pihole.error;
+      }
+      continue;
+    }
+    phd &summary = pihole.summary;
+    piHoleData.domains_being_blocked = max(piHoleData.domains_being_blocked, summary.domains_being_blocked);
+    piHoleData.dns_queries_today += summary.dns_queries_today;
+    piHoleData.ads_blocked_today += summary.ads_blocked_today;
+    piHoleData.unique_domains = max(piHoleData.unique_domains, summary.unique_domains);
+    piHoleData.queries_forwarded += summary.queries_forwarded;
+    piHoleData.queries_cached += summary.queries_cached;
+    piHoleData.clients_ever_seen = max(piHoleData.clients_ever_seen, summary.clients_ever_seen);
+    piHoleData.unique_clients = max(piHoleData.unique_clients, summary.unique_clients);
+    piHoleData.dns_queries_all_types += summary.dns_queries_all_types;
+    piHoleData.reply_NODATA += summary.reply_NODATA;
+    piHoleData.reply_NXDOMAIN += summary.reply_NXDOMAIN;
+    piHoleData.reply_CNAME += summary.reply_CNAME;
+    piHoleData.reply_IP += summary.reply_IP;
+    if (piHoleData.privacy_level < 0) {
+      piHoleData.privacy_level = summary.privacy_level;
+    }
+    blocking |= summary.piHoleStatus == STATUS_BLOCKING;
+    disabled |= summary.piHoleStatus == STATUS_DISABLED;
+    any = true;
+  }
+  if (!any) {
+    return; // nothing to show yet -- errorMessage says why
+  }
+  errorMessage = "";
+  if (piHoleData.dns_queries_today > 0) {
+    piHoleData.ads_percentage_today = 100.0f * piHoleData.ads_blocked_today / piHoleData.dns_queries_today;
+  }
+  if (blocking && disabled) {
+    piHoleData.piHoleStatus = STATUS_PARTIAL;
+  } else if (blocking) {
+    piHoleData.piHoleStatus = STATUS_BLOCKING;
+  } else if (disabled) {
+    piHoleData.piHoleStatus = STATUS_DISABLED;
+  }
 }
 
 void PiHoleClient::getTopClientsBlocked() {
   resetClientsBlocked();
   Serial.println("getTopClientsBlocked()");
 
-  if (server.isEmpty() || port == 0 || apiKey.isEmpty()) {
+  if (getInstanceCount() == 0) {
     Serial.println("Object Not Initialized");
     return; 
   }
 
-  if (sid.isEmpty()) {
-    sid = authGetSid(apiKey);
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    fetchTopClientsBlocked(inx);
+  }
+  for (int inx = 0; inx < 3 && blockedClients[inx].clientAddress != ""; inx++) {
+    Serial.println("Blocked Client " + String(inx+1) + ": " + blockedClients[inx].clientAddress + " (" + String(blockedClients[inx].blockedCount) + ")");
+  }
+  Serial.println();
+}
+
+void PiHoleClient::fetchTopClientsBlocked(int index) {
+  Instance &pihole = instances[index];
+  if (!isConfigured(pihole) || !health[index].isClosed()) {
+    return;
+  }
+
+  if (pihole.sid.isEmpty()) {
+    pihole.sid = authGetSid(pihole);
   }
 
   // const size_t bufferSize = JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(3) + 70;
-  JsonDocument jdoc = queryApi("/api/stats/top_clients?blocked=true&count=3", sid);
+  JsonDocument jdoc = queryApi(pihole, "/api/stats/top_clients?blocked=true&count=3", TOP_CLIENTS_FILTER);
 
   JsonObject blocked = jdoc["top_sources_blocked"];
-  int count = 0;
   for (JsonPair p : blocked) {
-    blockedClients[count].clientAddress = p.key().c_str();
-    blockedClients[count].blockedCount = p.value().as<int>();
-    Serial.println("Blocked Client " + String(count+1) + ": " + blockedClients[count].clientAddress + " (" + String(blockedClients[count].blockedCount) + ")");
-    count++;
+    addClientBlocked(p.key().c_str(), p.value().as<int>());
   }
-  Serial.println();
+}
+
+// A client that uses both Pi-holes is one client -- add up its counts, keep the top 3
+void PiHoleClient::addClientBlocked(String clientAddress, int count) {
+  int slot = -1;
+  for (int inx = 0; inx < 3; inx++) {
+    if (blockedClients[inx].clientAddress == clientAddress) {
+      count += blockedClients[inx].blockedCount;
+      slot = inx;
+      break;
+    }
+  }
+  if (slot < 0) {
+    slot = 2;
+    if (blockedClients[slot].clientAddress != "" && blockedClients[slot].blockedCount >= count) {
+      return;
+    }
+  }
+  while (slot > 0 && blockedClients[slot - 1].blockedCount < count) {
+    blockedClients[slot] = blockedClients[slot - 1];
+    slot--;
+  }
+  blockedClients[slot].clientAddress = clientAddress;
+  blockedClients[slot].blockedCount = count;
 }
 
 /* Get the history of blocked DNS - this data is too large to be put in a String,
@@ -269,29 +406,47 @@ void PiHoleClient::getTopClientsBlocked() {
 void PiHoleClient::getGraphData() {
   Serial.println("getGraphData()");
 
-  if (server.isEmpty() || port == 0 || apiKey.isEmpty()) {
+  if (getInstanceCount() == 0) {
     Serial.println("Object Not Initialized");
     return; 
   }
 
-  if (this->apiKey == "") {
-    errorMessage = "Pi-hole API Key Password is required to view Summary Data.";
-    Serial.println(errorMessage);
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    fetchGraphData(inx);
+  }
+  mergeGraphData();
+
+  Serial.println("\nHigh Value: " + String(blockedHigh));
+  Serial.println("Count: " + String(blockedCount));
+  Serial.println();  
+}
+
+void PiHoleClient::fetchGraphData(int index) {
+  Instance &pihole = instances[index];
+  if (!isConfigured(pihole)) {
     return;
   }
 
-  if (sid.isEmpty()) {
-    sid = authGetSid(apiKey);
+  if (pihole.apiKey == "") {
+    pihole.error = "Pi-hole API Key Password is required to view Summary Data.";
+    Serial.println(pihole.error);
+    return;
   }
 
-  // Initialize
-  blockedCount = 0;
-  blockedHigh  = 0;
-  resetBlockedGraphData();
-  String apiGetData = "http://" + server + ":" + String(port) + "/api/history?sid=" + sid;
+  if (!health[index].isClosed()) {
+    // Pi-hole is not answering -- keep the last graph rather than waiting on another timeout
+    return;
+  }
+
+  if (pihole.sid.isEmpty()) {
+    pihole.sid = authGetSid(pihole);
+  }
+
+  String apiGetData = baseUrl(pihole) + "/api/history?sid=" + pihole.sid;
 
   WiFiClient client;
   HTTPClient http;
+  http.setTimeout(PIHOLE_TIMEOUT_MS);
   // Ask HTTPClient to collect the Transfer-Encoding header
   // (by default, it discards all headers)
   const char* keys[] = {"Transfer-Encoding","Content-Type"};
@@ -306,6 +461,7 @@ void PiHoleClient::getGraphData() {
       Serial.println(apiGetData + " -> (" + String(httpCode) + ")");
   } else {
       Serial.printf("\n[HTTP] Unable to connect\n");
+      health[index].recordFailure();
       return;
   }
 
@@ -313,46 +469,70 @@ void PiHoleClient::getGraphData() {
   ChunkDecodingStream decodedStream(http.getStream());
   Stream& response = http.header("Transfer-Encoding") == "chunked" ? decodedStream : rawStream;
   
-  JsonDocument jdoc;
+  JsonDocument filter(&jsonArena);
+  deserializeJson(filter, FPSTR(HISTORY_FILTER));
+  JsonDocument jdoc(&jsonBudget);
 
   if (httpCode > 0) {
-    DeserializationError error = deserializeJson(jdoc, response);
+    DeserializationError error = deserializeJson(jdoc, response, DeserializationOption::Filter(filter));
     if (!error) {
-      // Serial.print("jdoc debug: ");
-      // for (int i=0; i<10; i++)  Serial.println(jdoc["history"][i]["blocked"].as<long>());
-
+      // only replaced once we have a new history, so a failed fetch keeps the old graph
       JsonArray historyJson = jdoc["history"].as<JsonArray>();
-      size_t sizeOfBlocked = sizeof(blocked) / sizeof(int);
-      // Serial.println("Json size: " + String(historyJson.size()));
-
-      // Serial.println("History record: ");
+      pihole.historyCount = 0;
       for (auto val : historyJson) {
-        // Serial.print(String(blockedCount) + ", ");
-        if (blockedCount >= sizeOfBlocked) break; // stay inside array size
+        if (pihole.historyCount >= PIHOLE_HISTORY_SIZE) break; // stay inside array size
         int readblocked = val["blocked"].as<int>();
-        blocked[blockedCount++] = readblocked;
-        blockedHigh = (readblocked > blockedHigh) ? readblocked : blockedHigh;
+        pihole.history[pihole.historyCount++] = (uint16_t)constrain(readblocked, 0, 65535);
       }
-      // historyJson.clear();
+      pihole.historyFetchedAt = millis();
+      health[index].recordSuccess();
     } else {
-      Serial.print("Deserialization error: ");
-      Serial.println(error.c_str());
-      http.end();
-      return;
+      pihole.error = "History parse error: " + String(error.c_str());
+      Serial.println(pihole.error);
+      health[index].recordFailure();
     }
   } else {
     Serial.println("History API HTTP failure: " + String(httpCode));
-    http.end();
-    return;
+    health[index].recordFailure();
   }
 
   http.end();
-
-  Serial.println("\nHigh Value: " + String(blockedHigh));
-  Serial.println("Count: " + String(blockedCount));
-  Serial.println();  
 }
 
+// Sum the series bucket by bucket, lined up on the current bucket. A history
+// kept from an instance that has stopped answering ends where its fetch did, so
+// it is moved back by the 10 minute buckets since -- its old buckets land
+// where they belong and the newer ones get nothing from it -- and it drops
+// out once it is older than the whole series.
+void PiHoleClient::mergeGraphData() {
+  resetBlockedGraphData();
+  unsigned long now = millis();
+  size_t age[MAX_PIHOLES] = {0};
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    Instance &pihole = instances[inx];
+    if (!isConfigured(pihole) || pihole.historyCount == 0) {
+      continue;
+    }
+    age[inx] = min((now - pihole.historyFetchedAt) / PIHOLE_BUCKET_MS, (unsigned long) PIHOLE_HISTORY_SIZE);
+    blockedCount = max(blockedCount, min(pihole.historyCount + age[inx], (size_t) PIHOLE_HISTORY_SIZE));
+  }
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    Instance &pihole = instances[inx];
+    if (!isConfigured(pihole) || pihole.historyCount == 0) {
+      continue;
+    }
+    // where the instance's oldest bucket falls in the merged series; negative ones are older than it
+    long shift = (long) blockedCount - (long) age[inx] - (long) pihole.historyCount;
+    for (size_t bucket = 0; bucket < pihole.historyCount; bucket++) {
+      if (shift + (long) bucket >= 0) {
+        blocked[shift + bucket] += pihole.history[bucket];
+      }
+    }
+  }
+  for (size_t bucket = 0; bucket < blockedCount; bucket++) {
+    blockedHigh = max(blockedHigh, blocked[bucket]);
+  }
+}
 
 /*
 void PiHoleClient::getGraphData(String server, int port, String apiKey) {
@@ -448,7 +628,7 @@ void PiHoleClient::resetClientsBlocked() {
 }
 
 void PiHoleClient::resetBlockedGraphData() {
-  for (int inx = 0; inx < 144; inx++) {
+  for (int inx = 0; inx < PIHOLE_HISTORY_SIZE; inx++) {
     blocked[inx] = 0;
   }
   blockedCount = 0;
@@ -456,73 +636,125 @@ void PiHoleClient::resetBlockedGraphData() {
 }
 
 String PiHoleClient::getDomainsBeingBlocked() {
-  return piHoleData.domains_being_blocked;
+  return String(piHoleData.domains_being_blocked);
 }
 
 String PiHoleClient::getDnsQueriesToday() {
-  return piHoleData.dns_queries_today;
+  return String(piHoleData.dns_queries_today);
 }
 
 String PiHoleClient::getAdsBlockedToday() {
-  return piHoleData.ads_blocked_today;
+  return String(piHoleData.ads_blocked_today);
 }
 
 String PiHoleClient::getAdsPercentageToday() {
-  return piHoleData.ads_percentage_today;
+  return String(piHoleData.ads_percentage_today, 1);
 }
 
 String PiHoleClient::getUniqueClients() {
-  return piHoleData.unique_clients;
+  return String(piHoleData.unique_clients);
 }
 
 String PiHoleClient::getClientsEverSeen() {
-  return piHoleData.clients_ever_seen;
+  return String(piHoleData.clients_ever_seen);
 }
 
 String PiHoleClient::getUniqueDomains() {
-  return piHoleData.unique_domains;
+  return String(piHoleData.unique_domains);
 }
 
 String PiHoleClient::getQueriesForwarded() {
-  return piHoleData.queries_forwarded;
+  return String(piHoleData.queries_forwarded);
 }
 
 String PiHoleClient::getQueriesCached() {
-  return piHoleData.queries_cached;
+  return String(piHoleData.queries_cached);
 }
 
 String PiHoleClient::getDnsQueriesAllTypes() {
-  return piHoleData.dns_queries_all_types;
+  return String(piHoleData.dns_queries_all_types);
 }
 
 String PiHoleClient::getReplyNODATA() {
-  return piHoleData.reply_NODATA;
+  return String(piHoleData.reply_NODATA);
 }
 
 String PiHoleClient::getReplyNXDOMAIN() {
-  return piHoleData.reply_NXDOMAIN;
+  return String(piHoleData.reply_NXDOMAIN);
 }
 
 String PiHoleClient::getReplyCNAME() {
-  return piHoleData.reply_CNAME;
+  return String(piHoleData.reply_CNAME);
 }
 
 String PiHoleClient::getReplyIP() {
-  return piHoleData.reply_IP;
+  return String(piHoleData.reply_IP);
 }
 
 String PiHoleClient::getPrivacyLevel() {
-  return piHoleData.privacy_level;
+  if (piHoleData.privacy_level < 0) {
+    return "";
+  }
+  return String(piHoleData.privacy_level);
 }
 
 String PiHoleClient::getPiHoleStatus() {
-  return piHoleData.piHoleStatus;
+  switch (piHoleData.piHoleStatus) {
+    case STATUS_BLOCKING:
+      return "Blocking";
+    case STATUS_DISABLED:
+      return "Disabled";
+    case STATUS_PARTIAL:
+      return "Partly blocking";
+    default:
+      return "";
+  }
 }
 
 String PiHoleClient::getError() {
   return errorMessage;
 }
 
+SourceHealth &PiHoleClient::getHealth() {
+  return health[0];
+}
+
+JsonBudget &PiHoleClient::getJsonBudget() {
+  return jsonBudget;
+}
+
+int PiHoleClient::getInstanceCount() {
+  int count = 0;
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    if (isConfigured(instances[inx])) {
+      count++;
+    }
+  }
+  return count;
+}
+
+int PiHoleClient::getAnsweringCount() {
+  int count = 0;
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    if (isConfigured(instances[inx]) && instances[inx].hasSummary && health[inx].isClosed()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+SourceHealth &PiHoleClient::getHealth(int index) {
+  return health[index];
+}
+
+String PiHoleClient::getServer(int index) {
+  return instances[index].server;
+}
+
+String PiHoleClient::getInstanceError(int index) {
+  return instances[index].error;
+}
+
 int *PiHoleClient::getBlockedAds() {
   return blocked;
 }
@@ -27,6 +27,13 @@ SOFTWARE.
 #include <ESP8266HTTPClient.h>
 
 #include <ArduinoJson.h>
+#include "SourceHealth.h"
+#include "JsonLimits.h"
+
+#define MAX_PIHOLES 3            // redundant Pi-holes -- their stats are merged into one view
+#define PIHOLE_TIMEOUT_MS 2500   // per request, so a dead instance can't stall the others for long
+#define PIHOLE_HISTORY_SIZE 144  // 24 hours of 10 minute buckets
+#define PIHOLE_BUCKET_MS 600000UL
 
 class PiHoleClient {
 
@@ -37,12 +44,9 @@ private:
   void resetBlockedGraphData();
   
   String errorMessage = "";
-  String server;
-  int port;
-  String apiKey;
-  String sid;
+  JsonBudget jsonBudget = JsonBudget("Pi-hole", JSON_BUDGET_PIHOLE);
 
-  int blocked[144] = {0};  
+  int blocked[PIHOLE_HISTORY_SIZE] = {0};  
   size_t blockedCount = 0;
   int blockedHigh = 0;
 
@@ -53,33 +57,63 @@ private:
 
   ClientBlocked blockedClients[3];
 
+  enum { STATUS_UNKNOWN, STATUS_DISABLED, STATUS_BLOCKING, STATUS_PARTIAL };
+
   typedef struct {
-    String domains_being_blocked;
-    String dns_queries_today;
-    String ads_blocked_today;
-    String ads_percentage_today;
-    String unique_domains;
-    String queries_forwarded;
-    String queries_cached;
-    String clients_ever_seen;
-    String unique_clients;
-    String dns_queries_all_types;
-    String reply_NODATA;
-    String reply_NXDOMAIN;
-    String reply_CNAME;
-    String reply_IP;
-    String privacy_level;
-    String piHoleStatus;
+    uint32_t domains_being_blocked;
+    uint32_t dns_queries_today;
+    uint32_t ads_blocked_today;
+    float ads_percentage_today;
+    uint32_t unique_domains;
+    uint32_t queries_forwarded;
+    uint32_t queries_cached;
+    uint16_t clients_ever_seen;
+    uint16_t unique_clients;
+    uint32_t dns_queries_all_types;
+    uint32_t reply_NODATA;
+    uint32_t reply_NXDOMAIN;
+    uint32_t reply_CNAME;
+    uint32_t reply_IP;
+    int8_t privacy_level;   // -1 when the API doesn't report it
+    uint8_t piHoleStatus;   // STATUS_*
   } phd;
   
-  phd piHoleData;
-  JsonDocument queryApi(String urlPath, String sid);
-  String getStatus();
-  String authGetSid(String apiKey);
+  phd piHoleData = {};    // merged over every instance that has answered
+
+  // One Pi-hole: its own session, and the last data it gave us so an instance
+  // that stops answering still counts with what it last reported
+  typedef struct {
+    String server;
+    int port;
+    String apiKey;
+    String sid;
+    String error;
+    phd summary;
+    boolean hasSummary;
+    uint16_t history[PIHOLE_HISTORY_SIZE];
+    size_t historyCount;
+    unsigned long historyFetchedAt;  // millis() when history was read
+  } Instance;
+
+  Instance instances[MAX_PIHOLES] = {};
+  SourceHealth health[MAX_PIHOLES] = { SourceHealth("Pi-hole"), SourceHealth("Pi-hole 2"), SourceHealth("Pi-hole 3") };
+
+  boolean isConfigured(Instance &pihole);
+  String baseUrl(Instance &pihole);
+  JsonDocument queryApi(Instance &pihole, String urlPath, const char* filterSpec);
+  uint8_t getStatus(Instance &pihole);
+  String authGetSid(Instance &pihole);
+  void fetchSummary(int index);
+  void fetchGraphData(int index);
+  void fetchTopClientsBlocked(int index);
+  void mergeSummaries();
+  void mergeGraphData();
+  void addClientBlocked(String clientAddress, int count);
   
 public:
   PiHoleClient() {};
-  PiHoleClient(String server, int port, String apiKey) : server(server), port(port), apiKey(apiKey) {};
+  PiHoleClient(String server, int port, String apiKey) { setInstance(0, server, port, apiKey); };
+  void setInstance(int index, String server, int port, String apiKey);
   void getPiHoleData();
   void getGraphData();
   void getTopClientsBlocked();
@@ -103,6 +137,14 @@ public:
   
   String getPiHoleStatus();
   String getError();
+  SourceHealth &getHealth();
+  JsonBudget &getJsonBudget();
+
+  int getInstanceCount();
+  int getAnsweringCount();
+  SourceHealth &getHealth(int index);
+  String getServer(int index);
+  String getInstanceError(int index);
 
   int *getBlockedAds();  
   int getBlockedCount();
@@ -0,0 +1,340 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "RssClient.h"
+#include "DnsCache.h"
+
+// One or more http(s)://host[:port]/path separated by spaces or new lines
+void RssClient::setUrls(String urls) {
+  feedCount = 0;
+  urls.replace("\r", " ");
+  urls.replace("\n", " ");
+  urls.trim();
+  while (urls != "" && feedCount < MAX_RSS_FEEDS) {
+    int space = urls.indexOf(' ');
+    feeds[feedCount++] = space >= 0 ? urls.substring(0, space) : urls;
+    urls = space >= 0 ? urls.substring(space + 1) : "";
+    urls.trim();
+  }
+  selectFeed(feedCount > 0 ? feeds[0] : "");
+}
+
+void RssClient::selectFeed(String url) {
+  url.trim();
+  host = "";
+  useTls = url.startsWith("https://");
+  if (url == "") {
+    return;
+  }
+  url = url.substring(url.indexOf("://") >= 0 ? url.indexOf("://") + 3 : 0);
+  int slash = url.indexOf('/');
+  urlPath = slash >= 0 ? url.substring(slash) : "/";
+  host = slash >= 0 ? url.substring(0, slash) : url;
+  port = useTls ? 443 : 80;
+  int colon = host.indexOf(':');
+  if (colon > 0) {
+    port = host.substring(colon + 1).toInt();
+    host = host.substring(0, colon);
+  }
+}
+
+boolean RssClient::isConfigured() {
+  return feedCount > 0;
+}
+
+// Every feed in turn; the caller clears the store first. Totals cover all feeds.
+boolean RssClient::updateNews() {
+  if (!isConfigured()) {
+    return false;
+  }
+  errorMessage = "";
+  feedTitle[0] = '\0';
+  lastBytes = 0;
+  lastMillis = 0;
+  lastParseMicros = 0;
+  stoppedEarly = false;
+  boolean any = false;
+  for (int inx = 0; inx < feedCount; inx++) {
+    current = inx;
+    selectFeed(feeds[inx]);
+    any |= updateFeed();
+  }
+  return any;
+}
+
+boolean RssClient::updateFeed() {
+  WiFiClient plainClient;
+  std::unique_ptr<BearSSL::WiFiClientSecure> secureClient(useTls ? new BearSSL::WiFiClientSecure() : nullptr);
+  WiFiClient &client = useTls ? *secureClient : plainClient;
+  // HTTP/1.0 so the reply is never chunked and can be fed straight into the tokenizer
+  String request = "GET " + urlPath + " HTTP/1.0";
+  Serial.println("Getting RSS feed from " + host);
+  Serial.println(request);
+  boolean connected = false;
+  if (useTls) {
+    connected = tls[current].connect(*secureClient, host.c_str(), port);
+  } else {
+    IPAddress serverIp;
+    connected = dnsCache.resolve(host.c_str(), serverIp) && plainClient.connect(serverIp, port);
+  }
+  if (!connected) {
+    errorMessage = useTls ? tls[current].getLastError() : "Connection failed: " + host;
+    Serial.println(errorMessage);
+    return false;
+  }
+  client.println(request);
+  client.println("Host: " + host);
+  client.println("User-Agent: ArduinoWiFi/1.1");
+  client.println("Connection: close");
+  client.println();
+
+  unsigned long start = millis();
+  while (client.connected() && !client.available() && (millis() - start) < RSS_TIMEOUT_MS) delay(1); //waits for data
+  if (!client.available()) {
+    errorMessage = "No reply from " + host;
+    Serial.println(errorMessage);
+    client.stop();
+    lastMillis += millis() - start;
+    return false;
+  }
+
+  char status[32] = {0};
+  client.readBytesUntil('\r', status, sizeof(status));
+  char endOfHeaders[] = "\r\n\r\n";
+  if (strstr(status, " 200 ") == nullptr || !client.find(endOfHeaders)) {
+    errorMessage = "Unexpected response: " + String(status);
+    Serial.println(errorMessage);
+    client.stop();
+    return false;
+  }
+
+  tokenizer.setListener(this);
+  tokenizer.reset();
+  clearItem();
+  inItem = false;
+  target = nullptr;
+  feedItems = 0;
+  unsigned long feedBytes = 0;
+  char buff[128];
+  boolean timedOut = false;
+  while ((client.connected() || client.available()) && feedItems < HEADLINE_COUNT) {
+    if ((millis() - start) >= RSS_TIMEOUT_MS) {
+      timedOut = true;
+      break;
+    }
+    size_t size = client.available();
+    if (size) {
+      int count = client.readBytes(buff, ((size > sizeof(buff)) ? sizeof(buff) : size));
+      unsigned long parseStart = micros();
+      for (int inx = 0; inx < count; inx++) {
+        tokenizer.parse(buff[inx]);
+      }
+      lastParseMicros += micros() - parseStart;
+      lastBytes += count;
+      feedBytes += count;
+    }
+    delay(1);
+  }
+  boolean skipped = feedItems >= HEADLINE_COUNT && (client.connected() || client.available());
+  stoppedEarly |= skipped;
+  client.stop();
+  lastMillis += millis() - start;
+
+  Serial.println("RSS: " + String(feedItems) + " items from " + host + ", " + String(feedBytes) + " bytes in " + String(millis() - start) + " ms"
+                 + (skipped ? ", rest of the feed skipped" : ""));
+  if (timedOut) {
+    // keep what came in time, but say the feed stalled
+    errorMessage = "Feed timed out after " + String(feedBytes) + " bytes: " + host;
+    Serial.println(errorMessage);
+  }
+  if (feedItems == 0) {
+    errorMessage = timedOut ? errorMessage : "No items found in the feed: " + host;
+    return false;
+  }
+  return true;
+}
+
+// "atom:link" -> "link"
+const char* RssClient::localName(const char* name) {
+  const char* colon = strchr(name, ':');
+  return colon != nullptr ? colon + 1 : name;
+}
+
+void RssClient::clearItem() {
+  title[0] = '\0';
+  link[0] = '\0';
+  description[0] = '\0';
+  published[0] = '\0';
+  linkFromAttribute = false;
+}
+
+// Start collecting text into buffer -- only the first occurrence of a field counts
+void RssClient::capture(char* buffer, size_t size, boolean markup) {
+  if (buffer[0] != '\0') {
+    return;
+  }
+  target = buffer;
+  targetSize = size;
+  targetLength = 0;
+  stripMarkup = markup;
+  inMarkup = false;
+}
+
+void RssClient::startElement(const char* name) {
+  const char* local = localName(name);
+  inLink = false;
+  if (strcmp(local, "item") == 0 || strcmp(local, "entry") == 0) {
+    inItem = true;
+    clearItem();
+  } else if (strcmp(local, "title") == 0) {
+    if (inItem) {
+      capture(title, sizeof(title), false);
+    } else {
+      capture(feedTitle, sizeof(feedTitle), false);
+    }
+  } else if (inItem && strcmp(local, "link") == 0) {
+    inLink = true;
+    capture(link, sizeof(link), false);
+  } else if (inItem && (strcmp(local, "description") == 0 || strcmp(local, "summary") == 0 || strcmp(local, "content") == 0)) {
+    capture(description, sizeof(description), true);
+  } else if (inItem && (strcmp(local, "pubDate") == 0 || strcmp(local, "published") == 0 || strcmp(local, "updated") == 0 || strcmp(local, "date") == 0)) {
+    capture(published, sizeof(published), false);
+  }
+}
+
+// Atom links are <link rel="alternate" href="..."/>
+void RssClient::attribute(const char* name, const char* value) {
+  if (!inLink) {
+    return;
+  }
+  if (strcmp(name, "href") == 0 && (link[0] == '\0' || linkFromAttribute)) {
+    strlcpy(link, value, sizeof(link));
+    linkFromAttribute = true;
+  } else if (strcmp(name, "rel") == 0 && strcmp(value, "alternate") != 0) {
+    // enclosure, self, replies ... -- not the article, whether rel comes before href or after
+    if (linkFromAttribute) {
+      link[0] = '\0';
+      linkFromAttribute = false;
+    }
+    inLink = false;
+  }
+}
+
+void RssClient::endElement(const char* name) {
+  const char* local = localName(name);
+  if (target != nullptr) {
+    while (targetLength > 0 && target[targetLength - 1] == ' ') {
+      target[--targetLength] = '\0';
+    }
+    target = nullptr;
+  }
+  if (strcmp(local, "link") == 0) {
+    inLink = false;
+    linkFromAttribute = false; // later <link>s can't replace this one
+  }
+  if (inItem && (strcmp(local, "item") == 0 || strcmp(local, "entry") == 0)) {
+    inItem = false;
+    if (title[0] != '\0') {
+      headlines.add(title, link, description, Headlines::parseTime(published));
+      feedItems++;
+    }
+  }
+}
+
+// Whitespace runs become one space; tags inside descriptions are dropped
+void RssClient::characters(char c) {
+  if (target == nullptr) {
+    return;
+  }
+  if (stripMarkup) {
+    if (c == '<') {
+      inMarkup = true;
+      return;
+    }
+    if (inMarkup) {
+      if (c == '>') {
+        inMarkup = false;
+        c = ' ';
+      } else {
+        return;
+      }
+    }
+  }
+  if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+    if (targetLength == 0 || target[targetLength - 1] == ' ') {
+      return;
+    }
+    c = ' ';
+  }
+  if (targetLength < targetSize - 1) {
+    target[targetLength++] = c;
+    target[targetLength] = '\0';
+  }
+}
+
+String RssClient::getFeedTitle() {
+  return String(feedTitle);
+}
+
+String RssClient::getError() {
+  return errorMessage;
+}
+
+unsigned long RssClient::getLastBytes() {
+  return lastBytes;
+}
+
+unsigned long RssClient::getLastMillis() {
+  return lastMillis;
+}
+
+unsigned long RssClient::getLastParseMicros() {
+  return lastParseMicros;
+}
+
+unsigned long RssClient::getBytesPerSecond() {
+  if (lastMillis == 0) {
+    return 0;
+  }
+  return (unsigned long)((uint64_t)lastBytes * 1000 / lastMillis);
+}
+
+boolean RssClient::wasStoppedEarly() {
+  return stoppedEarly;
+}
+
+int RssClient::getFeedCount() {
+  return feedCount;
+}
+
+// Feeds are numbered from 0 in the order NEWS_RSS_URL lists them
+void RssClient::setFingerprint(int feed, const char* fingerprintP) {
+  if (feed >= 0 && feed < MAX_RSS_FEEDS) {
+    tls[feed].setFingerprint(fingerprintP);
+  }
+}
+
+TlsSession &RssClient::getTls(int feed) {
+  return tls[feed];
+}
@@ -0,0 +1,108 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <ESP8266WiFi.h>
+#include "XmlTokenizer.h"
+#include "Headlines.h"
+#include "TlsSession.h"
+
+#define RSS_FEED_TITLE_LEN 48
+#define RSS_PUBLISHED_LEN 40
+#define MAX_RSS_FEEDS 4
+#define RSS_TIMEOUT_MS 15000   // per feed, from the request to the last byte read
+
+/* RSS 2.0 / Atom headline source. Each feed is streamed through the XML
+   tokenizer and each <item>/<entry> is handed to the shared headline store
+   (title, link, description/summary with HTML tags stripped, publish time),
+   which merges the feeds. Reading a feed stops after as many items as the
+   store holds, so memory use doesn't depend on the feed size and a long feed
+   costs no more time than its first few items.
+   Each feed has its own TLS session and fingerprint, so https feeds can be
+   on different sites.
+*/
+class RssClient: public XmlListener {
+
+public:
+  void setUrls(String urls);
+  boolean isConfigured();
+  boolean updateNews();
+
+  String getFeedTitle();
+  String getError();
+  unsigned long getLastBytes();
+  unsigned long getLastMillis();
+  unsigned long getLastParseMicros();
+  unsigned long getBytesPerSecond();
+  boolean wasStoppedEarly();
+  int getFeedCount();
+  void setFingerprint(int feed, const char* fingerprintP);
+  TlsSession &getTls(int feed);
+
+  virtual void startElement(const char* name);
+  virtual void attribute(const char* name, const char* value);
+  virtual void endElement(const char* name);
+  virtual void characters(char c);
+
+private:
+  String feeds[MAX_RSS_FEEDS];
+  int feedCount = 0;
+  int current = 0;   // the feed being read
+  String host = "";
+  int port = 80;
+  String urlPath = "/";
+  boolean useTls = false;
+  TlsSession tls[MAX_RSS_FEEDS] = { TlsSession("RSS 1"), TlsSession("RSS 2"), TlsSession("RSS 3"), TlsSession("RSS 4") };
+  XmlTokenizer tokenizer;
+  String errorMessage = "";
+
+  // one item at a time is staged here
+  boolean inItem = false;
+  boolean inLink = false;
+  boolean linkFromAttribute = false;
+  char title[HEADLINE_TITLE_LEN];
+  char link[HEADLINE_URL_LEN];
+  char description[HEADLINE_DESCRIPTION_LEN];
+  char published[RSS_PUBLISHED_LEN];
+  char feedTitle[RSS_FEED_TITLE_LEN];
+  int feedItems = 0;
+
+  // the field text is going into
+  char* target = nullptr;
+  size_t targetSize = 0;
+  size_t targetLength = 0;
+  boolean stripMarkup = false;
+  boolean inMarkup = false;
+
+  unsigned long lastBytes = 0;
+  unsigned long lastMillis = 0;
+  unsigned long lastParseMicros = 0;
+  boolean stoppedEarly = false;
+
+  void selectFeed(String url);
+  boolean updateFeed();
+  static const char* localName(const char* name);
+  void capture(char* buffer, size_t size, boolean markup);
+  void clearItem();
+};
@@ -36,6 +36,7 @@ SOFTWARE.
  ******************************************************************************/
  
 #include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
 #include <ESP8266WebServer.h>
 #include <ESP8266HTTPUpdateServer.h>
 #include <WiFiManager.h> // --> https://github.com/tzapu/WiFiManager
@@ -49,23 +50,38 @@ SOFTWARE.
 #include "OpenWeatherMapClient.h"
 #include "TimeDB.h"
 #include "NewsApiClient.h" 
+#include "RssClient.h"
 #include "OctoPrintClient.h"
 #include "PiHoleClient.h"
+#include "DnsCache.h"
+#include "TlsSession.h"
+#include "SntpClock.h"
+#include "JsonPathSource.h"
+#include "MessageQueue.h"
+#include "DisplayText.h"
+#include "MarqueeText.h"
+#include "ContentScheduler.h"
+#include "PageTemplate.h"
+#include "WebAssets.h"
 
 //******************************
 // Start Settings
 //******************************
 
 String TIMEDBKEY = ""; // Your API Key from https://timezonedb.com/register
+boolean NTP_ENABLED = true; // keep the clock on SNTP -- TimeZoneDB is then only needed for the UTC offset
+String NTP_SERVER = "pool.ntp.org"; // host or host:port
+String TIMEZONE_RULE = ""; // Optional POSIX TZ rule (e.g. "EST5EDT,M3.2.0,M11.1.0") -- blank uses TimeZoneDB's offset
 String APIKEY = ""; // Your API Key from http://openweathermap.org/
 // Default City Location (use http://openweathermap.org/find to find city ID)
-int CityIDs[] = { 5304391 }; //Only USE ONE for weather marquee
+int CityIDs[MAX_CITIES] = { 5304391 }; // Up to MAX_CITIES (5) -- fetched in one request, the marquee rotates through them
 String marqueeMessage = "";
 boolean IS_METRIC = false; // false = Imperial and true = Metric
 boolean IS_24HOUR = false; // 23:00 millitary 24 hour clock
 boolean IS_PM = true; // Show PM indicator on Clock when in AM/PM mode
 const int WEBSERVER_PORT = 80; // The port you can access this device on over HTTP
 const boolean WEBSERVER_ENABLED = true;  // Device will provide a web interface via http://[ip]:[port]/
+const int MESSAGE_UDP_PORT = 0; // e.g. 4210 to take pushed messages over UDP: "text" or "priority,ttl,repeat|text". Off by default -- anyone on the network can send them, Basic Auth or not
 boolean IS_BASIC_AUTH = false;  // Use Basic Authorization for Configuration security on Web Interface
 char* www_username = "admin";  // User account for the Web Interface
 char* www_password = "password";  // Password for the Web Interface
@@ -77,6 +93,23 @@ boolean flashOnSeconds = true; // when true the : character in the time will fla
 boolean NEWS_ENABLED = true;
 String NEWS_API_KEY = ""; // Get your News API Key from https://newsapi.org
 String NEWS_SOURCE = "reuters";  // https://newsapi.org/sources to get full list of news sources available
+String NEWS_RSS_URL = "";  // RSS 2.0 or Atom feeds (http:// or https://), up to 4 separated by spaces -- merged with NewsAPI, repeats dropped
+
+// HTTPS for the internet APIs -- keeps the API keys off the wire, costs RAM and handshake time
+boolean WEATHER_USE_TLS = false;
+boolean TIMEDB_USE_TLS = false;
+boolean NEWS_USE_TLS = false;
+// Certificates are checked against the root CAs in TrustAnchors.h. A SHA-1 fingerprint here
+// ("AB:CD:..." as shown by your browser) pins that site's own certificate instead -- for a site
+// under a root that isn't shipped. Update it when the site renews its certificate.
+static const char WEATHER_FINGERPRINT[] PROGMEM = "";
+static const char TIMEDB_FINGERPRINT[] PROGMEM = "";
+static const char NEWS_FINGERPRINT[] PROGMEM = "";
+// one per https:// feed, in the order NEWS_RSS_URL lists the feeds
+static const char RSS_FINGERPRINT_1[] PROGMEM = "";
+static const char RSS_FINGERPRINT_2[] PROGMEM = "";
+static const char RSS_FINGERPRINT_3[] PROGMEM = "";
+static const char RSS_FINGERPRINT_4[] PROGMEM = "";
 
 // Display Settings
 // CLK -> D5 (SCK)  
@@ -100,17 +133,30 @@ String timeDisplayTurnsOff = "23:00"; // 24 Hour Format HH:MM -- Leave blank for
 // OctoPrint Monitoring -- Monitor your 3D printer OctoPrint Server
 boolean OCTOPRINT_ENABLED = false;
 boolean OCTOPRINT_PROGRESS = true;
-String OctoPrintApiKey = "";  // ApiKey from your User Account on OctoPrint
-String OctoPrintServer = "";  // IP or Address of your OctoPrint Server (DO NOT include http://)
-int OctoPrintPort = 80;       // the port you are running your OctoPrint server on (usually 80);
+boolean OCTOPRINT_PUSH = false; // keep a websocket open to the first OctoPrint for live progress (falls back to polling /api/job)
+// Up to MAX_PRINTERS (6) -- printing ones get stacked progress bars on taller displays, or take turns
+String OctoPrintApiKey[MAX_PRINTERS] = { "" };  // ApiKey from your User Account on OctoPrint
+String OctoPrintServer[MAX_PRINTERS] = { "" };  // IP or Address of your OctoPrint Server (DO NOT include http://)
+int OctoPrintPort[MAX_PRINTERS] = { 80, 80, 80, 80, 80, 80 }; // the port you are running your OctoPrint server on (usually 80);
 String OctoAuthUser = "";     // only used if you have haproxy or basic athentintication turned on (not default)
 String OctoAuthPass = "";     // only used with haproxy or basic auth (only needed if you must authenticate)
 
 // Pi-hole Client -- monitor basic stats from your Pi-hole server (see http://pi-hole.net)
 boolean USE_PIHOLE = true;   // Set true to display your Pi-hole details
-String PiHoleServer = "";     // IP or Address only (DO NOT include http://)
-int PiHolePort = 80;          // Port of your Pi-hole address (default 80)
-String PiHoleApiKey = "";   // Optional -- only needed to see top blocked clients
+// Up to MAX_PIHOLES (3) -- list a redundant pair and the marquee shows their combined stats
+String PiHoleServer[MAX_PIHOLES] = { "" };     // IP or Address only (DO NOT include http://)
+int PiHolePort[MAX_PIHOLES] = { 80, 80, 80 };  // Port of your Pi-hole address (default 80)
+String PiHoleApiKey[MAX_PIHOLES] = { "" };     // Optional -- only needed to see top blocked clients
+
+// Custom JSON sources -- values from any local HTTP endpoint that returns JSON (Home Assistant, Prometheus, CI ...)
+// Paths are separated by ';' (e.g. "state;attributes.unit_of_measurement") and fill {0}..{3} in the format
+boolean JSON_SOURCES_ENABLED = false;
+String JsonSourceName[MAX_JSON_SOURCES] = { "" };
+String JsonSourceUrl[MAX_JSON_SOURCES] = { "" };      // http://host[:port]/path
+String JsonSourceHeader[MAX_JSON_SOURCES] = { "" };   // optional, e.g. "Authorization: Bearer <token>"
+String JsonSourcePaths[MAX_JSON_SOURCES] = { "" };
+String JsonSourceFormat[MAX_JSON_SOURCES] = { "" };   // e.g. "Living room {0}C" -- blank shows the values
+int JsonSourceRefresh[MAX_JSON_SOURCES] = { 5, 5, 5 }; // minutes
 
 boolean ENABLE_OTA = true;    // this will allow you to load firmware to the device over WiFi (see OTA for ESP8266)
 String OTA_Password = "Dilbert45";     // Set an OTA password here -- leave blank if you don't want to be prompted for password
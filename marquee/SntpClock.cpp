@@ -0,0 +1,241 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "SntpClock.h"
+#include "DnsCache.h"
+
+#define NTP_PACKET_SIZE 48
+#define NTP_UNIX_OFFSET 2208988800UL // seconds from 1900 to 1970
+
+static uint64_t readTimestampMs(const uint8_t *p) {
+  uint32_t seconds = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+  uint32_t fraction = ((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7];
+  return (uint64_t)(seconds - NTP_UNIX_OFFSET) * 1000 + (((uint64_t)fraction * 1000) >> 32);
+}
+
+static void writeTimestampMs(uint8_t *p, uint64_t ms) {
+  uint32_t seconds = (uint32_t)(ms / 1000) + NTP_UNIX_OFFSET;
+  uint32_t fraction = (uint32_t)((((uint64_t)(ms % 1000)) << 32) / 1000);
+  for (int inx = 0; inx < 4; inx++) {
+    p[inx] = seconds >> (24 - inx * 8);
+    p[inx + 4] = fraction >> (24 - inx * 8);
+  }
+}
+
+void SntpClock::setServer(String server) {
+  server.trim();
+  port = SNTP_PORT;
+  int colon = server.indexOf(':');
+  if (colon > 0) {
+    port = server.substring(colon + 1).toInt();
+    server = server.substring(0, colon);
+  }
+  if (server != host) {
+    interval = SNTP_MIN_INTERVAL;
+    lastAttemptMillis = 0;
+  }
+  host = server;
+}
+
+String SntpClock::getServer() {
+  return port == SNTP_PORT ? host : host + ":" + String(port);
+}
+
+boolean SntpClock::isDue() {
+  if (host == "" || WiFi.status() != WL_CONNECTED) {
+    return false;
+  }
+  if (lastAttemptMillis == 0) {
+    return true;
+  }
+  // after a failure try again at the shortest interval
+  long wait = (synced && lastSyncMillis == lastAttemptMillis) ? interval : SNTP_MIN_INTERVAL;
+  return (millis() - lastAttemptMillis) >= (unsigned long)wait * 1000;
+}
+
+boolean SntpClock::sync() {
+  lastAttemptMillis = millis();
+  if (lastAttemptMillis == 0) {
+    lastAttemptMillis = 1;
+  }
+  IPAddress ip;
+  if (!dnsCache.resolve(host.c_str(), ip)) {
+    failures++;
+    return false;
+  }
+  if (!udpStarted) {
+    udpStarted = udp.begin(SNTP_LOCAL_PORT);
+  }
+
+  // keep the sample with the shortest round trip -- it has the least asymmetry in it
+  int64_t bestOffset = 0;
+  long bestDelay = -1;
+  for (int inx = 0; inx < SNTP_BURST; inx++) {
+    int64_t sampleOffset;
+    long sampleDelay;
+    if (request(ip, sampleOffset, sampleDelay) && (bestDelay < 0 || sampleDelay < bestDelay)) {
+      bestOffset = sampleOffset;
+      bestDelay = sampleDelay;
+    }
+  }
+  if (bestDelay < 0) {
+    failures++;
+    Serial.println("SNTP sync with " + getServer() + " failed");
+    return false;
+  }
+
+  rebase();
+  unsigned long sinceLast = millis() - lastSyncMillis;
+  boolean wasSynced = synced;
+  if (!synced || bestOffset > SNTP_STEP_THRESHOLD_MS || bestOffset < -SNTP_STEP_THRESHOLD_MS) {
+    // too far off to slew in reasonable time -- step, and start the interval over
+    baseUtcMs += bestOffset;
+    slewRemainingMs = 0;
+    interval = SNTP_MIN_INTERVAL;
+  } else {
+    // whatever the last slew hadn't yet corrected was already known; the rest is drift
+    long driftError = (long)bestOffset - slewRemainingMs;
+    if (sinceLast >= SNTP_MIN_INTERVAL * 1000UL) {
+      driftPpm += 0.5 * driftError * 1000000.0 / sinceLast;
+      driftPpm = constrain(driftPpm, -SNTP_MAX_DRIFT_PPM, SNTP_MAX_DRIFT_PPM);
+    }
+    slewRemainingMs = (long)bestOffset;
+    if (abs(slewRemainingMs) < 20 && interval < SNTP_MAX_INTERVAL) {
+      interval *= 2;
+    } else if (abs(slewRemainingMs) > 50 && interval > SNTP_MIN_INTERVAL) {
+      interval /= 2;
+    }
+  }
+  offsetMs = wasSynced ? (long)bestOffset : 0; // the first step is from uptime, not a real offset
+  delayMs = bestDelay;
+  synced = true;
+  syncs++;
+  lastSyncMillis = lastAttemptMillis;
+  Serial.println("SNTP " + getServer() + ": offset " + String(offsetMs) + " ms, delay " + String(delayMs) + " ms, drift "
+                 + String(driftPpm, 1) + " ppm, next in " + String(interval) + " s");
+  return true;
+}
+
+// One request/reply; offset and delay per RFC 4330
+boolean SntpClock::request(IPAddress &ip, int64_t &offset, long &roundTripDelay) {
+  uint8_t packet[NTP_PACKET_SIZE];
+  memset(packet, 0, sizeof(packet));
+  packet[0] = 0x23; // LI 0, version 4, mode 3 (client)
+
+  while (udp.parsePacket() > 0) {
+    udp.flush(); // drop late replies to an earlier request
+  }
+  uint64_t t1 = getUtcMs();
+  writeTimestampMs(packet + 40, t1);
+  uint8_t sent[8];
+  memcpy(sent, packet + 40, sizeof(sent)); // echoed back as the originate timestamp
+  unsigned long sentAt = millis();
+  udp.beginPacket(ip, port);
+  udp.write(packet, sizeof(packet));
+  if (!udp.endPacket()) {
+    return false;
+  }
+
+  while (millis() - sentAt < SNTP_TIMEOUT_MS) {
+    if (udp.parsePacket() >= NTP_PACKET_SIZE) {
+      unsigned long roundTrip = millis() - sentAt;
+      udp.read(packet, sizeof(packet));
+      uint8_t mode = packet[0] & 0x07;
+      if (mode != 4 || packet[1] == 0 || memcmp(packet + 24, sent, sizeof(sent)) != 0) {
+        continue; // not a server reply, kiss-o'-death, or not ours
+      }
+      int64_t t2 = readTimestampMs(packet + 32);
+      int64_t t3 = readTimestampMs(packet + 40);
+      int64_t t4 = t1 + roundTrip;
+      offset = ((t2 - (int64_t)t1) + (t3 - t4)) / 2;
+      roundTripDelay = (long)((int64_t)roundTrip - (t3 - t2));
+      return true;
+    }
+    delay(1);
+  }
+  return false;
+}
+
+boolean SntpClock::isSynced() {
+  return synced;
+}
+
+time_t SntpClock::getUtc() {
+  return getUtcMs() / 1000;
+}
+
+long SntpClock::slewApplied(unsigned long elapsed) {
+  long limit = (long)((uint64_t)elapsed * SNTP_SLEW_PPM / 1000000);
+  return constrain(slewRemainingMs, -limit, limit);
+}
+
+uint64_t SntpClock::getUtcMs() {
+  unsigned long elapsed = millis() - baseMillis;
+  if (elapsed >= 60 * 60 * 1000UL) {
+    rebase(); // keeps millis() wrapping out of it and the float math small
+    elapsed = millis() - baseMillis;
+  }
+  return baseUtcMs + elapsed + (int64_t)(elapsed * driftPpm / 1000000.0) + slewApplied(elapsed);
+}
+
+// Fold the time elapsed so far into the base
+void SntpClock::rebase() {
+  unsigned long now = millis();
+  unsigned long elapsed = now - baseMillis;
+  long slewed = slewApplied(elapsed);
+  baseUtcMs += elapsed + (int64_t)(elapsed * driftPpm / 1000000.0) + slewed;
+  slewRemainingMs -= slewed;
+  baseMillis = now;
+}
+
+long SntpClock::getOffsetMs() {
+  return offsetMs;
+}
+
+long SntpClock::getDelayMs() {
+  return delayMs;
+}
+
+float SntpClock::getDriftPpm() {
+  return driftPpm;
+}
+
+long SntpClock::getIntervalSeconds() {
+  return interval;
+}
+
+long SntpClock::getSecondsSinceSync() {
+  if (!synced) {
+    return -1;
+  }
+  return (millis() - lastSyncMillis) / 1000;
+}
+
+unsigned long SntpClock::getSyncs() {
+  return syncs;
+}
+
+unsigned long SntpClock::getFailures() {
+  return failures;
+}
@@ -0,0 +1,93 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
+#include <TimeLib.h>
+
+#define SNTP_PORT 123
+#define SNTP_LOCAL_PORT 2390
+#define SNTP_TIMEOUT_MS 500
+#define SNTP_BURST 3              // requests per sync, the one with the lowest delay is used
+#define SNTP_MIN_INTERVAL 64      // seconds between syncs -- doubles while the clock holds, halves when it doesn't
+#define SNTP_MAX_INTERVAL 4096
+#define SNTP_STEP_THRESHOLD_MS 128 // larger offsets are stepped, smaller ones slewed
+#define SNTP_SLEW_PPM 500         // slew rate, 0.5 ms per second
+#define SNTP_MAX_DRIFT_PPM 500
+
+/* Disciplined UTC clock synced over SNTP.
+   Each sync measures the offset and round trip delay from the best of a short
+   burst of requests. Small offsets are slewed out gradually so the displayed
+   seconds never jump; large ones (or the first sync) step the clock. The
+   crystal's frequency error is estimated from the offset left over between
+   syncs and applied continuously, and the sync interval grows as long as the
+   clock stays within a few ms of the server. The server may be given as
+   host:port, to test against a local NTP stand-in.
+*/
+class SntpClock {
+
+public:
+  void setServer(String server);
+  String getServer();
+  boolean isDue();
+  boolean sync();
+
+  boolean isSynced();
+  time_t getUtc();
+  uint64_t getUtcMs();
+
+  long getOffsetMs();      // last measured offset (server - local)
+  long getDelayMs();       // last round trip delay
+  float getDriftPpm();     // estimated crystal error, positive when it runs slow
+  long getIntervalSeconds();
+  long getSecondsSinceSync();
+  unsigned long getSyncs();
+  unsigned long getFailures();
+
+private:
+  WiFiUDP udp;
+  String host = "";
+  uint16_t port = SNTP_PORT;
+  boolean udpStarted = false;
+
+  // clock state -- UTC ms at baseMillis, plus the slew still to apply
+  uint64_t baseUtcMs = 0;
+  unsigned long baseMillis = 0;
+  long slewRemainingMs = 0;
+  float driftPpm = 0;
+  boolean synced = false;
+
+  unsigned long lastSyncMillis = 0;
+  unsigned long lastAttemptMillis = 0;
+  long interval = SNTP_MIN_INTERVAL;
+  long offsetMs = 0;
+  long delayMs = 0;
+  unsigned long syncs = 0;
+  unsigned long failures = 0;
+
+  long slewApplied(unsigned long elapsed);
+  void rebase();
+  boolean request(IPAddress &ip, int64_t &offset, long &roundTripDelay);
+};
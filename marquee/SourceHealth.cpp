@@ -0,0 +1,124 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "SourceHealth.h"
+
+SourceHealth::SourceHealth(const char* name, unsigned long baseBackoffMs, unsigned long maxBackoffMs, int failureThreshold) {
+  this->name = name;
+  this->baseBackoff = baseBackoffMs;
+  this->maxBackoff = maxBackoffMs;
+  this->failureThreshold = failureThreshold;
+}
+
+boolean SourceHealth::allowRequest() {
+  if (state == CLOSED) {
+    return true;
+  }
+  if (state == OPEN && (millis() - openedAt) >= probeDelay) {
+    Serial.println(String(name) + " circuit half-open, probing");
+    state = HALF_OPEN;
+    return true;
+  }
+  // OPEN and still backing off, or a probe is already outstanding
+  return false;
+}
+
+void SourceHealth::recordSuccess() {
+  if (state != CLOSED) {
+    Serial.println(String(name) + " circuit closed");
+  }
+  state = CLOSED;
+  consecutiveFailures = 0;
+  trips = 0;
+}
+
+void SourceHealth::recordFailure() {
+  consecutiveFailures++;
+  if (state == HALF_OPEN || consecutiveFailures >= failureThreshold) {
+    trip();
+  }
+}
+
+void SourceHealth::reset() {
+  state = CLOSED;
+  consecutiveFailures = 0;
+  trips = 0;
+  probeDelay = 0;
+}
+
+// Open the circuit with exponential backoff (base * 2^trips, capped) and
+// "equal jitter": half of the backoff is fixed, the other half is random
+void SourceHealth::trip() {
+  unsigned long backoff = baseBackoff;
+  for (int inx = 0; inx < trips && backoff < maxBackoff; inx++) {
+    backoff *= 2;
+  }
+  if (backoff > maxBackoff) {
+    backoff = maxBackoff;
+  }
+  trips++;
+  probeDelay = (backoff / 2) + random(backoff / 2 + 1);
+  openedAt = millis();
+  state = OPEN;
+  Serial.println(String(name) + " circuit open, next probe in " + String(probeDelay / 1000) + "s");
+}
+
+SourceHealth::State SourceHealth::getState() {
+  return state;
+}
+
+boolean SourceHealth::isClosed() {
+  return state == CLOSED;
+}
+
+String SourceHealth::getStateText() {
+  switch (state) {
+    case CLOSED:
+      return "Closed";
+    case OPEN:
+      return "Open";
+    case HALF_OPEN:
+      return "Half-Open";
+    default:
+      return "";
+  }
+}
+
+long SourceHealth::getSecondsToNextProbe() {
+  if (state != OPEN) {
+    return 0;
+  }
+  unsigned long elapsed = millis() - openedAt;
+  if (elapsed >= probeDelay) {
+    return 0;
+  }
+  return (probeDelay - elapsed) / 1000;
+}
+
+int SourceHealth::getFailureCount() {
+  return consecutiveFailures;
+}
+
+const char* SourceHealth::getName() {
+  return name;
+}
@@ -0,0 +1,66 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <Arduino.h>
+
+/* Circuit breaker for a remote data source.
+   CLOSED    - requests go through as normal
+   OPEN      - the source failed repeatedly; requests are skipped and the
+               caller keeps serving its last known data
+   HALF_OPEN - the backoff expired; a single probe request is allowed.
+               Success closes the circuit, failure re-opens it with a
+               doubled (jittered) backoff.
+*/
+class SourceHealth {
+
+public:
+  enum State { CLOSED, OPEN, HALF_OPEN };
+
+  SourceHealth(const char* name, unsigned long baseBackoffMs = 60000, unsigned long maxBackoffMs = 3600000, int failureThreshold = 2);
+
+  boolean allowRequest();
+  void recordSuccess();
+  void recordFailure();
+  void reset();
+
+  State getState();
+  boolean isClosed();
+  String getStateText();
+  long getSecondsToNextProbe();
+  int getFailureCount();
+  const char* getName();
+
+private:
+  const char* name;
+  State state = CLOSED;
+  int failureThreshold;
+  int consecutiveFailures = 0;
+  int trips = 0;
+  unsigned long baseBackoff;
+  unsigned long maxBackoff;
+  unsigned long openedAt = 0;
+  unsigned long probeDelay = 0;
+
+  void trip();
+};
@@ -22,6 +22,9 @@ SOFTWARE.
 */
 
 #include "TimeDB.h"
+#include "DnsCache.h"
+#include "JsonFilters.h"
+#include <StreamUtils.h>
 
 TimeDB::TimeDB(String apiKey)
 {
@@ -30,19 +33,60 @@ TimeDB::TimeDB(String apiKey)
 
 void TimeDB::updateConfig(String apiKey, String lat, String lon)
 {
+  if (apiKey != myApiKey || lat != myLat || lon != myLon) {
+    updateRequested = true;
+  }
   myApiKey = apiKey;
   myLat = lat;
   myLon = lon;
 }
 
-time_t TimeDB::getTime()
+// POSIX TZ rule to compute local time on the device; empty uses TimeZoneDB's offset
+void TimeDB::setTimeZoneRule(String posixRule)
+{
+  posixRule.trim();
+  if (posixRule != "" && zone.parse(posixRule.c_str())) {
+    Serial.println("Time zone rule: " + posixRule);
+    return;
+  }
+  if (posixRule != "") {
+    Serial.println("Invalid time zone rule, using TimeZoneDB offset: " + posixRule);
+  }
+  zone.setFixed(gmtOffset, dst, zoneEnd);
+}
+
+// TimeZoneDB is only needed once a day, after a config change, or when the
+// offset it gave us runs out (a DST change) and no rule is configured
+boolean TimeDB::needsUpdate()
+{
+  if (!synced || updateRequested) {
+    return true;
+  }
+  if ((millis() - lastUpdateMillis) >= TIME_SYNC_INTERVAL_MS) {
+    return true;
+  }
+  return !zone.isRule() && zoneEnd != 0 && getUtc() >= zoneEnd;
+}
+
+boolean TimeDB::updateTime()
 {
-  WiFiClient client;
-  String apiGetData = "GET /v2.1/get-time-zone?key=" + myApiKey + "&format=json&by=position&lat=" + myLat + "&lng=" + myLon + " HTTP/1.1";
+  if (myApiKey == "" || myLat == "") {
+    return false;
+  }
+  WiFiClient plainClient;
+  std::unique_ptr<BearSSL::WiFiClientSecure> secureClient(useTls ? new BearSSL::WiFiClientSecure() : nullptr);
+  WiFiClient &client = useTls ? *secureClient : plainClient;
+  String apiGetData = "GET /v2.1/get-time-zone?key=" + myApiKey + "&format=json&by=position&lat=" + myLat + "&lng=" + myLon + " HTTP/1.0";
   Serial.println("Getting Time Data for " + myLat + "," + myLon);
   Serial.println(apiGetData);
-  String result = "";
-  if (client.connect(servername, 80)) {  //starts client connection, checks for connection
+  boolean connected = false;
+  if (useTls) {
+    connected = tls.connect(*secureClient, servername);
+  } else {
+    IPAddress serverIp;
+    connected = dnsCache.resolve(servername, serverIp) && plainClient.connect(serverIp, 80);
+  }
+  if (connected) {  //starts client connection, checks for connection
     client.println(apiGetData);
     client.println("Host: " + String(servername));
     client.println("User-Agent: ArduinoWiFi/1.1");
@@ -52,44 +96,138 @@ time_t TimeDB::getTime()
   else {
     Serial.println("connection for time data failed"); //error message if no client connect
     Serial.println();
-    return 20;
+    return false;
   }
 
   while (client.connected() && !client.available()) delay(1); //waits for data
 
   Serial.println("Waiting for data");
 
-  boolean record = false;
-  while (client.connected() || client.available()) { //connected or data available
-    char c = client.read(); //gets byte from ethernet buffer
-    if (String(c) == "{") {
-      record = true;
-    }
-    if (record) {
-      result = result + c;
-    }
-    if (String(c) == "}") {
-      record = false;
-    }
+  // Check HTTP status
+  char status[32] = {0};
+  client.readBytesUntil('\r', status, sizeof(status));
+  if (strstr(status, " 200 ") == nullptr) {
+    Serial.println("Unexpected response: " + String(status));
+    client.stop();
+    return false;
+  }
+
+  // Skip HTTP headers
+  char endOfHeaders[] = "\r\n\r\n";
+  if (!client.find(endOfHeaders)) {
+    Serial.println(F("Invalid response"));
+    client.stop();
+    return false;
   }
+
+  // Parse straight off the socket, 64 bytes at a time -- the body is never held in memory
+  JsonDocument filter(&jsonArena);
+  deserializeJson(filter, FPSTR(TIME_FILTER));
+  JsonDocument jdoc(&jsonBudget);
+  ReadBufferingStream bufferedClient(client, 64);
+  unsigned long parseStart = micros();
+  DeserializationError error = deserializeJson(jdoc, bufferedClient, DeserializationOption::Filter(filter));
+  lastParseMicros = micros() - parseStart;
   client.stop(); //stop client
-  Serial.println(result);
-
-  int timeStart = result.lastIndexOf('{'); // trim response to start of JSON -- issue 194
-  result = result.substring(timeStart);
-  char jsonArray [result.length() + 1];
-  result.toCharArray(jsonArray, sizeof(jsonArray));
-  jsonArray[result.length() + 1] = '\0';
-  JsonDocument jdoc;
-  deserializeJson(jdoc, jsonArray);
-  // JsonObject& root = json_buf.parseObject(jsonArray);
-  localMillisAtUpdate = millis();
+
+  if (error) {
+    Serial.println("Time Data Parsing failed! " + String(error.c_str()));
+    return false;
+  }
+  if (strcmp(jdoc["status"] | "", "OK") != 0) {
+    Serial.println("Time Data Error: " + jdoc["message"].as<String>());
+    return false;
+  }
+  time_t timestamp = jdoc["timestamp"] | 0; // local time
+  if (timestamp == 0) {
+    return false;
+  }
+  gmtOffset = jdoc["gmtOffset"] | 0;
+  JsonVariant dstValue = jdoc["dst"]; // sent as the string "0" or "1"
+  dst = dstValue.is<const char*>() ? strcmp(dstValue.as<const char*>(), "1") == 0 : dstValue.as<int>() != 0;
+  zoneEnd = jdoc["zoneEnd"] | 0;
+  Serial.println("timestamp: " + String((unsigned long)timestamp) + " gmtOffset: " + String(gmtOffset) + " dst: " + String(dst) + " zoneEnd: " + String((unsigned long)zoneEnd)
+                 + " (parsed in " + String(lastParseMicros) + " us, " + String(jsonBudget.getPeak()) + " bytes peak)");
   Serial.println();
-  if (jdoc["timestamp"] == 0) {
-    return 20;
-  } else {
-    return (unsigned long) jdoc["timestamp"];
+
+  setUtc(timestamp - gmtOffset);
+  if (!zone.isRule()) {
+    zone.setFixed(gmtOffset, dst, zoneEnd);
   }
+  lastUpdateMillis = millis();
+  updateRequested = false;
+  return true;
+}
+
+void TimeDB::setUtc(time_t utc)
+{
+  utcBase = utc;
+  millisAtBase = millis();
+  synced = true;
+}
+
+void TimeDB::setClock(SntpClock *clock)
+{
+  this->clock = clock;
+}
+
+time_t TimeDB::getUtc()
+{
+  if (clock != nullptr && clock->isSynced()) {
+    return clock->getUtc();
+  }
+  unsigned long elapsed = millis() - millisAtBase;
+  if (elapsed >= 24 * 60 * 60 * 1000UL) {
+    // move the base up so millis() wrapping after 49 days can't throw the clock
+    utcBase += elapsed / 1000;
+    millisAtBase += (elapsed / 1000) * 1000;
+    elapsed = millis() - millisAtBase;
+  }
+  return utcBase + elapsed / 1000;
+}
+
+// 0 until the first successful update (TimeLib keeps its own time then)
+time_t TimeDB::getLocalTime()
+{
+  if (!isSynced()) {
+    return 0;
+  }
+  return zone.toLocal(getUtc());
+}
+
+boolean TimeDB::isSynced() {
+  return synced || (clock != nullptr && clock->isSynced());
+}
+
+boolean TimeDB::isRuleActive() {
+  return zone.isRule();
+}
+
+long TimeDB::getOffset() {
+  return zone.getOffset(getUtc());
+}
+
+time_t TimeDB::getNextChange() {
+  return zone.getNextChange(getUtc());
+}
+
+long TimeDB::getSecondsSinceUpdate() {
+  if (lastUpdateMillis == 0) {
+    return -1;
+  }
+  return (millis() - lastUpdateMillis) / 1000;
+}
+
+long TimeDB::getGmtOffset() {
+  return gmtOffset;
+}
+
+boolean TimeDB::isDst() {
+  return zone.isDst(getUtc());
+}
+
+unsigned long TimeDB::getLastParseMicros() {
+  return lastParseMicros;
 }
 
 String TimeDB::getDayName() {
@@ -181,3 +319,20 @@ String TimeDB::zeroPad(int number) {
     return String(number);
   }
 }
+
+JsonBudget &TimeDB::getJsonBudget() {
+  return jsonBudget;
+}
+
+void TimeDB::setTls(boolean enabled, const char* fingerprintP) {
+  useTls = enabled;
+  tls.setFingerprint(fingerprintP);
+}
+
+boolean TimeDB::isTlsEnabled() {
+  return useTls;
+}
+
+TlsSession &TimeDB::getTls() {
+  return tls;
+}
@@ -25,22 +25,60 @@ SOFTWARE.
 #include <ESP8266WiFi.h>
 #include <TimeLib.h> // https://github.com/PaulStoffregen/Time 
 #include <ArduinoJson.h>
+#include "JsonLimits.h"
+#include "TlsSession.h"
+#include "TimeZoneRule.h"
+#include "SntpClock.h"
+
+#define TIME_SYNC_INTERVAL_MS (24 * 60 * 60 * 1000UL) // ask TimeZoneDB once a day, the clock runs from millis() in between
 
 class TimeDB
 {
   public:
     TimeDB(String apiKey);
     void updateConfig(String apiKey, String lat, String lon);
-    time_t getTime();
+    void setTimeZoneRule(String posixRule);
+    boolean needsUpdate();
+    boolean updateTime();
+    void setUtc(time_t utc);
+    void setClock(SntpClock *clock);
+    time_t getUtc();
+    time_t getLocalTime();
+    boolean isSynced();
+    boolean isRuleActive();
+    long getOffset();
+    boolean isDst();
+    time_t getNextChange();
+    long getSecondsSinceUpdate();
+    long getGmtOffset();
+    unsigned long getLastParseMicros();
     String getDayName();
     String getMonthName();
     String getAmPm();
     String zeroPad(int number);
+    JsonBudget &getJsonBudget();
+    void setTls(boolean enabled, const char* fingerprintP);
+    boolean isTlsEnabled();
+    TlsSession &getTls();
 
   private:
     const char* servername = "api.timezonedb.com";  // remote server we will connect to
-    long localMillisAtUpdate;
+    // UTC is kept as a base time plus millis() since it was set
+    time_t utcBase = 0;
+    unsigned long millisAtBase = 0;
+    boolean synced = false;
+    SntpClock *clock = nullptr; // preferred over our own base once it has synced
+    unsigned long lastUpdateMillis = 0;
+    boolean updateRequested = true;
+    TimeZoneRule zone;
+    long gmtOffset = 0;      // seconds, from the last successful update
+    boolean dst = false;
+    time_t zoneEnd = 0;      // UTC time TimeZoneDB's offset stops being valid (0 = no change known)
+    unsigned long lastParseMicros = 0;
     String myApiKey;
     String myLat;
     String myLon;
+    JsonBudget jsonBudget = JsonBudget("TimeDB", JSON_BUDGET_TIMEDB);
+    boolean useTls = false;
+    TlsSession tls = TlsSession("TimeZoneDB");
 };
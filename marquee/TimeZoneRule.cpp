@@ -0,0 +1,287 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "TimeZoneRule.h"
+
+#define SECS_PER_HOUR_L 3600L
+#define DEFAULT_TRANSITION_TIME (2 * SECS_PER_HOUR_L) // 02:00 local when a rule has no /time
+
+static boolean isLeapYear(int year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static int daysInMonth(int year, int month) {
+  static const uint8_t days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (month == 2 && isLeapYear(year)) {
+    return 29;
+  }
+  return days[month - 1];
+}
+
+// Midnight (as if UTC) at the start of the given date
+static time_t dateStart(int year, int month, int day) {
+  tmElements_t tm;
+  tm.Year = year - 1970;
+  tm.Month = month;
+  tm.Day = day;
+  tm.Hour = 0;
+  tm.Minute = 0;
+  tm.Second = 0;
+  return makeTime(tm);
+}
+
+boolean TimeZoneRule::parse(const char* posix) {
+  rule = false;
+  if (posix == nullptr || posix[0] == '\0') {
+    return false;
+  }
+  const char* p = parseName(posix);
+  if (p == nullptr) {
+    return false;
+  }
+  long seconds = 0;
+  p = parseTime(p, seconds);
+  if (p == nullptr) {
+    return false;
+  }
+  stdOffset = -seconds; // POSIX counts west of Greenwich as positive
+  hasDst = false;
+  if (*p == '\0') {
+    rule = true;
+    return true;
+  }
+
+  p = parseName(p);
+  if (p == nullptr) {
+    return false;
+  }
+  dstOffset = stdOffset + SECS_PER_HOUR_L;
+  if (*p != ',' && *p != '\0') {
+    p = parseTime(p, seconds);
+    if (p == nullptr) {
+      return false;
+    }
+    dstOffset = -seconds;
+  }
+  if (*p == '\0') {
+    // no dates given -- the POSIX default is the US rule
+    p = parseTransition("M3.2.0", dstStart);
+    p = parseTransition("M11.1.0", dstEnd);
+  } else {
+    p = parseTransition(p + 1, dstStart);
+    if (p == nullptr || *p != ',') {
+      return false;
+    }
+    p = parseTransition(p + 1, dstEnd);
+    if (p == nullptr || *p != '\0') {
+      return false;
+    }
+  }
+  hasDst = true;
+  rule = true;
+  return true;
+}
+
+// From an offset known to be right until validUntil (0 = no known change)
+void TimeZoneRule::setFixed(long offsetSeconds, boolean isDst, time_t validUntil) {
+  rule = false;
+  hasDst = false;
+  stdOffset = offsetSeconds;
+  fixedDst = isDst;
+  fixedUntil = validUntil;
+}
+
+boolean TimeZoneRule::isRule() {
+  return rule;
+}
+
+long TimeZoneRule::getOffset(time_t utc) {
+  if (!rule) {
+    if (fixedUntil != 0 && utc >= fixedUntil) {
+      // past the known change and not yet refreshed -- assume the usual one hour DST step
+      return stdOffset + (fixedDst ? -SECS_PER_HOUR_L : SECS_PER_HOUR_L);
+    }
+    return stdOffset;
+  }
+  return isDst(utc) ? dstOffset : stdOffset;
+}
+
+boolean TimeZoneRule::isDst(time_t utc) {
+  if (!rule) {
+    return (fixedUntil != 0 && utc >= fixedUntil) ? !fixedDst : fixedDst;
+  }
+  if (!hasDst) {
+    return false;
+  }
+  return dstInYear(utc, year(utc + stdOffset));
+}
+
+time_t TimeZoneRule::toLocal(time_t utc) {
+  return utc + getOffset(utc);
+}
+
+time_t TimeZoneRule::getNextChange(time_t utc) {
+  if (!rule) {
+    return fixedUntil > utc ? fixedUntil : 0;
+  }
+  if (!hasDst) {
+    return 0;
+  }
+  int thisYear = year(utc + stdOffset);
+  time_t next = 0;
+  for (int inx = thisYear; inx <= thisYear + 1; inx++) {
+    time_t candidates[] = { transitionUtc(dstStart, inx, stdOffset), transitionUtc(dstEnd, inx, dstOffset) };
+    for (time_t candidate : candidates) {
+      if (candidate > utc && (next == 0 || candidate < next)) {
+        next = candidate;
+      }
+    }
+  }
+  return next;
+}
+
+boolean TimeZoneRule::dstInYear(time_t utc, int year) {
+  time_t start = transitionUtc(dstStart, year, stdOffset);
+  time_t end = transitionUtc(dstEnd, year, dstOffset);
+  if (start < end) {
+    return utc >= start && utc < end;
+  }
+  // southern hemisphere: DST runs over the new year
+  return !(utc >= end && utc < start);
+}
+
+// UTC instant of a transition; the rule's time is local time in the offset in force before it
+time_t TimeZoneRule::transitionUtc(Transition &when, int year, long offset) {
+  time_t date;
+  if (when.type == 'M') {
+    time_t first = dateStart(year, when.month, 1);
+    int firstWeekday = ((first / SECS_PER_DAY) + 4) % 7; // 1970-01-01 was a Thursday
+    int day = 1 + ((when.weekday - firstWeekday + 7) % 7) + (when.week - 1) * 7;
+    while (day > daysInMonth(year, when.month)) {
+      day -= 7; // week 5 means the last one
+    }
+    date = first + (time_t)(day - 1) * SECS_PER_DAY;
+  } else if (when.type == 'J') {
+    // 1-365, February 29th is never counted
+    int day = when.day - 1;
+    if (isLeapYear(year) && when.day >= 60) {
+      day++;
+    }
+    date = dateStart(year, 1, 1) + (time_t)day * SECS_PER_DAY;
+  } else {
+    date = dateStart(year, 1, 1) + (time_t)when.day * SECS_PER_DAY;
+  }
+  return date + when.time - offset;
+}
+
+const char* TimeZoneRule::parseName(const char* p) {
+  const char* start = p;
+  if (*p == '<') {
+    while (*p != '\0' && *p != '>') {
+      p++;
+    }
+    return *p == '>' ? p + 1 : nullptr;
+  }
+  while (isalpha(*p)) {
+    p++;
+  }
+  return (p - start) >= 3 ? p : nullptr;
+}
+
+// [+|-]hh[:mm[:ss]]
+const char* TimeZoneRule::parseTime(const char* p, long &seconds) {
+  int sign = 1;
+  if (*p == '+' || *p == '-') {
+    sign = (*p == '-') ? -1 : 1;
+    p++;
+  }
+  if (!isdigit(*p)) {
+    return nullptr;
+  }
+  long parts[3] = {0, 0, 0};
+  for (int inx = 0; inx < 3; inx++) {
+    while (isdigit(*p)) {
+      parts[inx] = parts[inx] * 10 + (*p - '0');
+      p++;
+    }
+    if (*p != ':' || inx == 2) {
+      break;
+    }
+    p++;
+  }
+  seconds = sign * (parts[0] * SECS_PER_HOUR_L + parts[1] * 60 + parts[2]);
+  return p;
+}
+
+// Mm.w.d, Jn or n, each optionally followed by /time
+const char* TimeZoneRule::parseTransition(const char* p, Transition &when) {
+  when.time = DEFAULT_TRANSITION_TIME;
+  if (*p == 'M') {
+    int values[3] = {0, 0, 0};
+    p++;
+    for (int inx = 0; inx < 3; inx++) {
+      if (!isdigit(*p)) {
+        return nullptr;
+      }
+      while (isdigit(*p)) {
+        values[inx] = values[inx] * 10 + (*p - '0');
+        p++;
+      }
+      if (inx < 2) {
+        if (*p != '.') {
+          return nullptr;
+        }
+        p++;
+      }
+    }
+    if (values[0] < 1 || values[0] > 12 || values[1] < 1 || values[1] > 5 || values[2] > 6) {
+      return nullptr;
+    }
+    when.type = 'M';
+    when.month = values[0];
+    when.week = values[1];
+    when.weekday = values[2];
+  } else {
+    when.type = 'D';
+    if (*p == 'J') {
+      when.type = 'J';
+      p++;
+    }
+    if (!isdigit(*p)) {
+      return nullptr;
+    }
+    int day = 0;
+    while (isdigit(*p)) {
+      day = day * 10 + (*p - '0');
+      p++;
+    }
+    if ((when.type == 'J' && (day < 1 || day > 365)) || day > 365) {
+      return nullptr;
+    }
+    when.day = day;
+  }
+  if (*p == '/') {
+    p = parseTime(p + 1, when.time);
+  }
+  return p;
+}
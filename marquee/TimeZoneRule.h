@@ -0,0 +1,73 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <TimeLib.h> // https://github.com/PaulStoffregen/Time
+
+/* Local time offset for a UTC instant, worked out on the device.
+   Either from a POSIX TZ rule, e.g.
+     "PST8PDT,M3.2.0,M11.1.0"        (US Pacific)
+     "CET-1CEST,M3.5.0,M10.5.0/3"    (Central Europe)
+     "AEST-10AEDT,M10.1.0,M4.1.0/3"  (Sydney -- DST spans the new year)
+   or from a fixed offset that is valid until a given UTC time (what
+   TimeZoneDB reports as gmtOffset/zoneEnd). Supports the Mm.w.d, Jn and n
+   date forms, <+03>-3 style quoted names and transition times outside 0-24h.
+*/
+class TimeZoneRule {
+
+public:
+  boolean parse(const char* posix);
+  void setFixed(long offsetSeconds, boolean isDst, time_t validUntil);
+  boolean isRule();
+
+  long getOffset(time_t utc);   // seconds east of UTC
+  boolean isDst(time_t utc);
+  time_t toLocal(time_t utc);
+  time_t getNextChange(time_t utc); // 0 if there is none
+
+private:
+  typedef struct {
+    char type;   // 'M', 'J' or 'D' (zero based day of year)
+    uint8_t month;
+    uint8_t week;
+    uint8_t weekday;
+    uint16_t day;
+    long time;   // seconds after local midnight
+  } Transition;
+
+  boolean rule = false;
+  boolean hasDst = false;
+  long stdOffset = 0;    // seconds east of UTC
+  long dstOffset = 0;
+  Transition dstStart;
+  Transition dstEnd;
+  boolean fixedDst = false;
+  time_t fixedUntil = 0;
+
+  boolean dstInYear(time_t utc, int year);
+  time_t transitionUtc(Transition &when, int year, long offset);
+  static const char* parseName(const char* p);
+  static const char* parseTime(const char* p, long &seconds);
+  static const char* parseTransition(const char* p, Transition &when);
+};
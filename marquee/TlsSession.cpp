@@ -0,0 +1,172 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "TlsSession.h"
+#include <TimeLib.h>
+#include "TrustAnchors.h"
+
+TlsClock TlsSession::clock = nullptr;
+BearSSL::X509List *TlsSession::trustAnchors = nullptr;
+
+TlsSession::TlsSession(const char* name) {
+  this->name = name;
+}
+
+void TlsSession::setFingerprint(const char* fingerprintP) {
+  fingerprint = fingerprintP;
+}
+
+void TlsSession::setClock(TlsClock clock) {
+  TlsSession::clock = clock;
+}
+
+// __DATE__ and __TIME__ -- no certificate in use can have expired before the build
+time_t TlsSession::buildTime() {
+  static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  char month[4] = {0};
+  int day = 1, year = 1970, hour = 0, minute = 0, second = 0;
+  sscanf(__DATE__, "%3s %d %d", month, &day, &year);
+  sscanf(__TIME__, "%d:%d:%d", &hour, &minute, &second);
+  const char* found = strstr(months, month);
+  tmElements_t elements;
+  elements.Year = CalendarYrToTm(year);
+  elements.Month = found != nullptr ? (found - months) / 3 + 1 : 1;
+  elements.Day = day;
+  elements.Hour = hour;
+  elements.Minute = minute;
+  elements.Second = second;
+  return makeTime(elements);
+}
+
+// SNI needs the host name, so this connects by name rather than through the
+// DNS cache (lwIP keeps its own short lived cache of the answer)
+boolean TlsSession::connect(BearSSL::WiFiClientSecure &client, const char* host, uint16_t port) {
+  if (rxBufferSize == 0) {
+    boolean mfln = BearSSL::WiFiClientSecure::probeMaxFragmentLength(host, port, TLS_RX_BUFFER);
+    rxBufferSize = mfln ? TLS_RX_BUFFER : TLS_FULL_BUFFER;
+    Serial.println(String(name) + " TLS max fragment length " + (mfln ? "supported" : "not supported") + ", rx buffer " + String(rxBufferSize));
+  }
+  client.setBufferSizes(rxBufferSize, TLS_TX_BUFFER);
+
+  if (isPinned()) {
+    char fp[64] = {0};
+    strncpy_P(fp, fingerprint, sizeof(fp) - 1);
+    client.setFingerprint(fp);
+  } else {
+    if (trustAnchors == nullptr) {
+      trustAnchors = new BearSSL::X509List(TRUST_ANCHORS);
+      Serial.println("TLS trust anchors: " + String(trustAnchors->getCount()) + " root CAs");
+    }
+    client.setTrustAnchors(trustAnchors);
+    time_t utc = clock != nullptr ? clock() : 0;
+    client.setX509Time(utc != 0 ? utc : buildTime());
+  }
+  client.setSession(&session);
+
+  // BearSSL copies the negotiated parameters back into the session after the
+  // handshake; when the server resumed they come back unchanged
+  uint8_t previous[sizeof(BearSSL::Session)];
+  memcpy(previous, (const void*)&session, sizeof(previous));
+  boolean hadSession = false;
+  for (size_t inx = 0; inx < sizeof(previous) && !hadSession; inx++) {
+    hadSession = previous[inx] != 0;
+  }
+
+  uint32_t heapBefore = ESP.getFreeHeap();
+  unsigned long start = millis();
+  if (!client.connect(host, port)) {
+    char error[64] = {0};
+    if (client.getLastSSLError(error, sizeof(error)) != 0) {
+      refused++; // the handshake failed -- often a certificate that didn't verify
+    }
+    lastError = "HTTPS connection failed: " + String(error);
+    Serial.println(String(name) + " " + lastError);
+    return false;
+  }
+  lastError = "";
+  lastHandshakeMs = millis() - start;
+  handshakes++;
+  totalHandshakeMs += lastHandshakeMs;
+  uint32_t heapUsed = heapBefore > ESP.getFreeHeap() ? heapBefore - ESP.getFreeHeap() : 0;
+  if (heapUsed > peakHeapUse) {
+    peakHeapUse = heapUsed;
+  }
+  boolean resumed = hadSession && memcmp(previous, (const void*)&session, sizeof(previous)) == 0;
+  if (resumed) {
+    resumptions++;
+  }
+  Serial.println(String(name) + " TLS " + (resumed ? "resumed" : "full handshake") + " in " + String(lastHandshakeMs) + " ms, heap used " + String(heapUsed));
+  return true;
+}
+
+const char* TlsSession::getName() {
+  return name;
+}
+
+unsigned long TlsSession::getHandshakes() {
+  return handshakes;
+}
+
+unsigned long TlsSession::getResumptions() {
+  return resumptions;
+}
+
+int TlsSession::getResumptionRate() {
+  if (handshakes == 0) {
+    return 0;
+  }
+  return (resumptions * 100) / handshakes;
+}
+
+unsigned long TlsSession::getLastHandshakeMs() {
+  return lastHandshakeMs;
+}
+
+unsigned long TlsSession::getAverageHandshakeMs() {
+  if (handshakes == 0) {
+    return 0;
+  }
+  return totalHandshakeMs / handshakes;
+}
+
+uint32_t TlsSession::getPeakHeapUse() {
+  return peakHeapUse;
+}
+
+int TlsSession::getRxBufferSize() {
+  return rxBufferSize;
+}
+
+unsigned long TlsSession::getRefused() {
+  return refused;
+}
+
+// Empty after a good connection
+String TlsSession::getLastError() {
+  return lastError;
+}
+
+// A fingerprint set in Settings.h; otherwise the root CAs are used
+boolean TlsSession::isPinned() {
+  return fingerprint != nullptr && pgm_read_byte(fingerprint) != '\0';
+}
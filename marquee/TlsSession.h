@@ -0,0 +1,82 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <ESP8266WiFi.h>
+#include <WiFiClientSecureBearSSL.h>
+
+#define TLS_TX_BUFFER 512     // requests are a few hundred bytes
+#define TLS_RX_BUFFER 1024    // used when the server accepts Max Fragment Length
+#define TLS_FULL_BUFFER 16384 // servers that ignore MFLN can send full 16K records
+
+/* HTTPS connection state for one upstream source.
+   - probes once whether the server supports Max Fragment Length negotiation
+     and shrinks the BearSSL receive buffer from 16K to 1K when it does
+   - keeps the TLS session so later requests resume instead of doing a full
+     handshake
+   - verifies the server's certificate chain against the root CAs in
+     TrustAnchors.h; a SHA-1 fingerprint in PROGMEM, when one is set, pins
+     the site's own certificate instead
+   - certificate dates are checked against the clock from setClock(), or the
+     build date until that clock has been set
+*/
+typedef time_t (*TlsClock)(); // UTC, 0 while unknown
+
+class TlsSession {
+
+public:
+  TlsSession(const char* name);
+  static void setClock(TlsClock clock);
+  void setFingerprint(const char* fingerprintP);
+  boolean connect(BearSSL::WiFiClientSecure &client, const char* host, uint16_t port = 443);
+
+  const char* getName();
+  unsigned long getHandshakes();
+  unsigned long getResumptions();
+  int getResumptionRate();
+  unsigned long getLastHandshakeMs();
+  unsigned long getAverageHandshakeMs();
+  uint32_t getPeakHeapUse();
+  int getRxBufferSize();
+  unsigned long getRefused();
+  String getLastError();
+  boolean isPinned();
+
+private:
+  const char* name;
+  const char* fingerprint = nullptr; // PROGMEM hex string
+  BearSSL::Session session;
+  int rxBufferSize = 0;              // 0 until MFLN has been probed
+
+  unsigned long handshakes = 0;
+  unsigned long resumptions = 0;
+  unsigned long lastHandshakeMs = 0;
+  unsigned long totalHandshakeMs = 0;
+  uint32_t peakHeapUse = 0;
+  unsigned long refused = 0;
+  String lastError = "";
+
+  static TlsClock clock;
+  static BearSSL::X509List *trustAnchors; // parsed on the first unpinned connection, then shared
+  static time_t buildTime();
+};
@@ -0,0 +1,197 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+// Generated by tools/make_web_assets.py -- edit tools/web or sources.json and run it again
+
+#pragma once
+#include <Arduino.h>
+
+#define WEB_ASSET_COUNT 3
+#define WEB_APP_CSS_TAG "8c6bf15ac51d"
+#define WEB_APP_JS_TAG "2e0ce0701e24"
+#define WEB_SOURCES_JSON_TAG "5540d8619709"
+
+// /app.css -- 3721 bytes, 1176 gzipped
+static const uint8_t WEB_APP_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x57, 0x5b, 0x6f, 0xa3, 0x38,
+  0x14, 0xfe, 0x2b, 0xdd, 0x8e, 0x56, 0x9a, 0x8e, 0x42, 0x65, 0x48, 0xe8, 0x05, 0x1e, 0x56, 0x33,
+  0x55, 0xf7, 0x27, 0xec, 0xd3, 0xbe, 0x38, 0xf8, 0x10, 0xac, 0x82, 0xcd, 0x1a, 0xa7, 0x49, 0x06,
+  0xe5, 0xbf, 0xef, 0x31, 0x36, 0x09, 0x06, 0x77, 0x2e, 0x8a, 0xd4, 0xc6, 0x3e, 0x9f, 0xbf, 0x73,
+  0x3f, 0x76, 0x2a, 0xdd, 0xd4, 0xfd, 0x56, 0x1e, 0xa3, 0x8e, 0x7f, 0xe7, 0x62, 0x97, 0x6d, 0xa5,
+  0x62, 0xa0, 0x22, 0xdc, 0x39, 0x7f, 0x59, 0x7d, 0xc9, 0xb6, 0x50, 0x4a, 0x05, 0xf8, 0x85, 0x96,
+  0x1a, 0xd4, 0x14, 0xc8, 0x45, 0x05, 0x8a, 0xeb, 0x73, 0x85, 0x04, 0xab, 0xad, 0x64, 0xa7, 0xbe,
+  0x94, 0x42, 0x47, 0x25, 0x6d, 0x78, 0x7d, 0xca, 0xfe, 0x01, 0xc5, 0xa8, 0xa0, 0xab, 0x8e, 0x8a,
+  0x2e, 0xea, 0x10, 0x58, 0xe6, 0x83, 0x18, 0x0f, 0x43, 0x16, 0xa7, 0xed, 0x31, 0xaf, 0xb9, 0x80,
+  0xa8, 0x02, 0xbe, 0xab, 0x74, 0x16, 0xdf, 0xa7, 0x79, 0x43, 0xd5, 0x8e, 0x8b, 0x8c, 0x9c, 0xab,
+  0xa4, 0xbf, 0x42, 0xd7, 0x04, 0xa1, 0xc3, 0xf2, 0x60, 0xa1, 0x1b, 0x42, 0x46, 0x68, 0x8c, 0xb2,
+  0x1b, 0xc4, 0xaf, 0x27, 0xf8, 0x64, 0xf3, 0x73, 0xbc, 0x71, 0xc3, 0x38, 0x99, 0x91, 0xdc, 0x79,
+  0xab, 0x65, 0x9b, 0xc5, 0x28, 0xec, 0x64, 0xcd, 0xd9, 0xcd, 0x27, 0x00, 0x18, 0xcf, 0x24, 0xf6,
+  0x0c, 0x6f, 0x76, 0xfd, 0x3b, 0x28, 0xcd, 0x0b, 0x5a, 0x47, 0xb4, 0xe6, 0x3b, 0x91, 0x35, 0x9c,
+  0xb1, 0x1a, 0xce, 0xf7, 0x87, 0x75, 0x54, 0xa0, 0x3e, 0x8a, 0xee, 0xa8, 0xbe, 0xa5, 0x8c, 0x99,
+  0xe0, 0xdc, 0x93, 0x18, 0x9a, 0x9b, 0xf8, 0xa1, 0x3d, 0x0e, 0x00, 0xb7, 0x7d, 0x11, 0x3f, 0x21,
+  0xa9, 0x11, 0xfe, 0xc1, 0x9b, 0x56, 0x2a, 0x4d, 0x85, 0xf6, 0x79, 0x6c, 0xb4, 0x57, 0xfe, 0x9e,
+  0x4b, 0x85, 0xd9, 0xdc, 0xd2, 0x29, 0xc4, 0xac, 0x26, 0xc2, 0x02, 0xea, 0x3a, 0x52, 0xf2, 0x30,
+  0x25, 0x19, 0xb7, 0x2c, 0xac, 0x37, 0xa4, 0x20, 0x74, 0x76, 0x7b, 0x9b, 0x33, 0xde, 0xb5, 0x35,
+  0x3d, 0x65, 0x9a, 0x6e, 0x6b, 0xc8, 0x8b, 0x1a, 0x0c, 0x99, 0xd4, 0xd5, 0x60, 0x50, 0xc7, 0x19,
+  0x20, 0x7b, 0x3f, 0xa6, 0x89, 0x90, 0x3f, 0xf3, 0x03, 0x67, 0xba, 0xc2, 0xb8, 0x98, 0xc4, 0x6c,
+  0x69, 0xf1, 0xb6, 0x53, 0x72, 0x2f, 0x18, 0xda, 0x59, 0x4b, 0x95, 0x7d, 0x2a, 0xcb, 0x32, 0x6f,
+  0x65, 0xc7, 0x35, 0x97, 0x22, 0x2b, 0xf9, 0x11, 0xd8, 0xd5, 0xc7, 0xfc, 0x7b, 0xc4, 0x05, 0x83,
+  0x63, 0x16, 0xe7, 0x12, 0x83, 0x59, 0xd6, 0xc6, 0xc6, 0xbd, 0x96, 0x67, 0xe7, 0x44, 0x6f, 0xa9,
+  0x07, 0x2d, 0x17, 0x40, 0x85, 0x61, 0x06, 0x31, 0x42, 0x6e, 0xdc, 0xff, 0x88, 0x6b, 0x68, 0x16,
+  0xe1, 0xcc, 0xf1, 0x04, 0xd5, 0x59, 0x0d, 0xa5, 0x76, 0x66, 0x1a, 0x7a, 0x97, 0xe4, 0x4c, 0x48,
+  0x01, 0x17, 0x77, 0xb7, 0xb5, 0x2c, 0xde, 0x72, 0xb9, 0xd7, 0xa6, 0x0c, 0xb1, 0xe8, 0x46, 0xde,
+  0x61, 0xdf, 0xd7, 0x32, 0xb1, 0xca, 0x3f, 0xbd, 0x50, 0xaf, 0xe1, 0xa8, 0x5d, 0x75, 0x0c, 0x36,
+  0x4c, 0x15, 0x1f, 0x2a, 0x24, 0x8b, 0xba, 0x96, 0x16, 0x80, 0x1b, 0xaa, 0xa1, 0xb5, 0xb3, 0x76,
+  0x90, 0xfa, 0x86, 0x14, 0x54, 0x31, 0xdb, 0x6a, 0x15, 0x65, 0x18, 0x03, 0x72, 0x93, 0xa0, 0x8a,
+  0xd4, 0x54, 0xe2, 0x8d, 0xda, 0x6d, 0xe9, 0x67, 0xb2, 0x32, 0x9f, 0xfb, 0xf8, 0xe1, 0x6e, 0x65,
+  0x65, 0xb6, 0xb4, 0x7d, 0x61, 0x72, 0x67, 0xbd, 0xda, 0x6b, 0x2d, 0x45, 0x1f, 0x0a, 0x02, 0x17,
+  0x43, 0x13, 0x7e, 0xe0, 0x4d, 0xb0, 0xde, 0xe7, 0x89, 0xb1, 0x3e, 0x33, 0x28, 0xa4, 0xa2, 0x43,
+  0xce, 0x07, 0x05, 0xb6, 0x18, 0xdc, 0x84, 0x58, 0x56, 0xc9, 0x28, 0x98, 0xc4, 0xab, 0xc0, 0x72,
+  0x04, 0x95, 0x17, 0x7b, 0xd5, 0x21, 0xa0, 0x95, 0x7c, 0x58, 0xfa, 0x41, 0x3b, 0x28, 0xda, 0x4e,
+  0x5c, 0xca, 0x2a, 0x63, 0x4b, 0xef, 0x0a, 0x8f, 0x10, 0x32, 0xa9, 0xb4, 0x65, 0x61, 0x16, 0x45,
+  0x31, 0xeb, 0xb6, 0xc1, 0xed, 0xde, 0x4f, 0xe9, 0x35, 0xd7, 0x03, 0x84, 0x8b, 0x76, 0xaf, 0xa7,
+  0x65, 0x36, 0xab, 0x80, 0x69, 0x50, 0x2f, 0x83, 0x13, 0x6d, 0x6b, 0xa6, 0xd3, 0x04, 0x35, 0xcf,
+  0x79, 0x2d, 0x76, 0xcc, 0x89, 0x8f, 0x9d, 0xcf, 0x84, 0x0a, 0xd0, 0x4a, 0xd7, 0x74, 0x66, 0xb8,
+  0xb9, 0x5e, 0x1c, 0xbe, 0x5f, 0x3a, 0x4d, 0x41, 0x8d, 0xe1, 0x7f, 0x87, 0xdc, 0x4c, 0xb2, 0x71,
+  0xea, 0xd8, 0x11, 0x66, 0x86, 0x5b, 0x7f, 0xfd, 0x9a, 0x05, 0xe6, 0x8e, 0x93, 0x5a, 0xd3, 0x7b,
+  0x6f, 0x15, 0x82, 0x77, 0x50, 0x18, 0xa5, 0x1f, 0x93, 0xe6, 0x3f, 0xa5, 0xc0, 0x33, 0x76, 0x74,
+  0x59, 0x95, 0xfe, 0xc4, 0x98, 0x44, 0xeb, 0x3a, 0x32, 0xc6, 0x63, 0xbd, 0x51, 0xe7, 0xfa, 0xd5,
+  0x1e, 0x76, 0x5a, 0xec, 0x9e, 0xcb, 0x8f, 0x41, 0x2a, 0x13, 0xa7, 0x2b, 0x35, 0xdd, 0x62, 0x8c,
+  0xf7, 0x1a, 0xf2, 0x61, 0x1f, 0x67, 0xff, 0x95, 0xc8, 0x34, 0x6b, 0x7f, 0x9d, 0x1d, 0xf3, 0x0c,
+  0x0c, 0xa5, 0xd9, 0x2f, 0x8a, 0x75, 0x01, 0xb3, 0x33, 0xb6, 0xf7, 0x27, 0xea, 0x2c, 0xf3, 0x06,
+  0xe5, 0x23, 0x86, 0x2d, 0xeb, 0x1d, 0x17, 0xa7, 0xc9, 0x55, 0x66, 0x7a, 0x7a, 0x1e, 0x79, 0x1c,
+  0x1b, 0xf5, 0x14, 0x92, 0x2c, 0x73, 0x09, 0x8c, 0xef, 0x9b, 0xde, 0xbf, 0x6c, 0x67, 0x98, 0x1a,
+  0xd3, 0x03, 0x53, 0xc8, 0xd3, 0x02, 0x72, 0x3c, 0x1e, 0xe7, 0xa8, 0xcd, 0x12, 0xb5, 0x53, 0x00,
+  0xa2, 0xbf, 0x8e, 0xfe, 0x1f, 0x76, 0xe0, 0xa6, 0xa0, 0x65, 0x4a, 0x96, 0x0c, 0xa7, 0x5f, 0x6d,
+  0xe1, 0x67, 0x30, 0x9f, 0x79, 0x25, 0x55, 0xd0, 0xd8, 0x7b, 0x6f, 0x18, 0x07, 0x76, 0xed, 0x8d,
+  0x86, 0x77, 0xaa, 0x3e, 0x47, 0x91, 0x2e, 0xee, 0x7e, 0x44, 0xee, 0x40, 0x77, 0x21, 0xf6, 0x88,
+  0x25, 0xbf, 0x4f, 0xc5, 0x3c, 0xaa, 0x92, 0x76, 0x2b, 0xfc, 0xa3, 0x5c, 0x38, 0xf5, 0xa9, 0xbe,
+  0xdc, 0x02, 0xc1, 0x61, 0xdc, 0x60, 0xf7, 0xb8, 0xca, 0xb9, 0x4f, 0xa0, 0x59, 0x4e, 0x4a, 0x43,
+  0x89, 0x1e, 0xa3, 0xab, 0xf3, 0x2b, 0xfd, 0xdf, 0x64, 0x4d, 0x92, 0xdb, 0x41, 0x5e, 0xc8, 0x5d,
+  0x40, 0xfc, 0xf0, 0xfc, 0x6c, 0xc5, 0x02, 0x0e, 0x38, 0x5a, 0xdb, 0xcb, 0xd3, 0xc2, 0x03, 0xad,
+  0x1f, 0x1d, 0xc7, 0x7e, 0x1b, 0xd2, 0xf1, 0x98, 0x26, 0x23, 0x89, 0x3e, 0x48, 0xf5, 0x86, 0xd6,
+  0x2a, 0x60, 0x21, 0xa2, 0xf8, 0x61, 0x34, 0x86, 0x2d, 0x89, 0xfa, 0xb3, 0x13, 0xd6, 0x72, 0xcf,
+  0x22, 0xbc, 0xeb, 0x04, 0x76, 0x21, 0x43, 0x4f, 0x75, 0x80, 0x2a, 0x7e, 0x75, 0x86, 0xc3, 0x29,
+  0x64, 0x52, 0xfa, 0x72, 0x15, 0x47, 0x5d, 0x4d, 0xbb, 0x2a, 0x08, 0x7a, 0xb1, 0x20, 0xcc, 0x97,
+  0x0c, 0xe9, 0xf8, 0xf6, 0xd5, 0xca, 0x0f, 0xbc, 0xe4, 0xc1, 0xd8, 0xc6, 0x4e, 0xae, 0x40, 0x14,
+  0x55, 0x30, 0xbc, 0x2e, 0x32, 0xff, 0xed, 0xa1, 0x33, 0x93, 0x27, 0x2a, 0xb8, 0xc2, 0x77, 0xd5,
+  0x02, 0xfa, 0xd7, 0xc5, 0xf5, 0xe2, 0x2d, 0x64, 0xe9, 0xdf, 0x2e, 0x03, 0x43, 0x8a, 0x22, 0xac,
+  0x11, 0x11, 0x4c, 0x04, 0x79, 0xb2, 0x30, 0xd5, 0x75, 0x21, 0x96, 0xd7, 0xd4, 0x8a, 0xf1, 0x39,
+  0xd3, 0x05, 0xf3, 0x4c, 0xac, 0x5c, 0xf3, 0x06, 0x42, 0x80, 0xc7, 0xd8, 0x11, 0x34, 0xb4, 0x35,
+  0x17, 0xc5, 0x5b, 0xb0, 0x5c, 0xd2, 0x6f, 0x2e, 0xac, 0x1d, 0xbe, 0x1f, 0x83, 0x61, 0x59, 0x0f,
+  0x3c, 0x07, 0xfe, 0xab, 0x1d, 0x60, 0xab, 0x3f, 0x25, 0xb3, 0x5f, 0x0a, 0xe9, 0xe5, 0xf7, 0x80,
+  0xfd, 0x79, 0x30, 0x7b, 0x76, 0xb9, 0x67, 0xc4, 0x47, 0x4f, 0x75, 0x1e, 0x91, 0x38, 0x58, 0xa4,
+  0x84, 0xdc, 0x3a, 0xb1, 0x08, 0x06, 0xe9, 0xd5, 0x89, 0x13, 0x76, 0x7d, 0x69, 0x9b, 0x65, 0x10,
+  0xfd, 0x92, 0x3a, 0xf4, 0xda, 0x47, 0xaf, 0x85, 0xb7, 0xdc, 0xf8, 0xd2, 0x4d, 0x90, 0x6b, 0x28,
+  0x37, 0x23, 0x7e, 0xf6, 0xd1, 0xcf, 0x41, 0x74, 0xbc, 0xb1, 0xe8, 0x98, 0x78, 0xe8, 0x98, 0x84,
+  0xb9, 0x13, 0x87, 0x8e, 0x7d, 0x74, 0x38, 0x06, 0x5f, 0x9d, 0x25, 0xb1, 0xef, 0x55, 0xbc, 0x0e,
+  0xa1, 0x1f, 0x37, 0xce, 0x92, 0xd4, 0xb7, 0x24, 0x0d, 0x5a, 0x82, 0x86, 0xdf, 0x9e, 0xff, 0x07,
+  0x36, 0xf3, 0x54, 0x4e, 0x89, 0x0e, 0x00, 0x00
+};
+
+// /app.js -- 254 bytes, 178 gzipped
+static const uint8_t WEB_APP_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0xcd, 0xbd, 0x0a, 0xc2, 0x30,
+  0x1c, 0x04, 0xf0, 0xdd, 0xa7, 0xa8, 0x4b, 0x93, 0x2c, 0x01, 0x51, 0x51, 0xd4, 0x56, 0x50, 0x1c,
+  0x44, 0x70, 0xf1, 0x09, 0xda, 0xe4, 0x5f, 0x13, 0x9a, 0x26, 0x25, 0x1f, 0x95, 0xd0, 0xf6, 0xdd,
+  0xa5, 0xa0, 0xe0, 0xee, 0x74, 0x37, 0x1c, 0xbf, 0xab, 0x82, 0x66, 0x5e, 0x1a, 0x9d, 0x98, 0x16,
+  0xf4, 0x43, 0x72, 0x28, 0x0b, 0x8b, 0x49, 0xcf, 0x0d, 0x0b, 0x0d, 0x68, 0x4f, 0x9f, 0xe0, 0x2f,
+  0x0a, 0xa6, 0x7a, 0x8a, 0x57, 0x8e, 0x51, 0x13, 0x3f, 0x23, 0x44, 0xa8, 0xf3, 0x51, 0x01, 0xe5,
+  0xd2, 0xb5, 0xaa, 0x88, 0x19, 0x2a, 0x95, 0x61, 0x35, 0x1a, 0x67, 0xd5, 0x97, 0x64, 0xca, 0x38,
+  0xf8, 0xcf, 0xd4, 0x46, 0xc3, 0x2f, 0x29, 0xdd, 0x3d, 0x34, 0x25, 0xd8, 0x1b, 0x44, 0x0c, 0xa4,
+  0xef, 0x0a, 0x9b, 0x88, 0x0c, 0xe8, 0x4b, 0x48, 0x26, 0x8e, 0x9f, 0xdc, 0x41, 0x37, 0xbd, 0xd4,
+  0x10, 0xcf, 0x86, 0xc3, 0xde, 0x82, 0x0f, 0x56, 0xcf, 0xb1, 0xc8, 0x97, 0x8b, 0x34, 0xc5, 0xe2,
+  0xb0, 0xda, 0x0e, 0x83, 0xc8, 0xd7, 0x1b, 0x42, 0xc6, 0x37, 0xd8, 0x7a, 0x77, 0xa2, 0xfe, 0x00,
+  0x00, 0x00
+};
+
+// /sources.json -- 2696 bytes, 830 gzipped
+static const uint8_t WEB_SOURCES_JSON[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x56, 0xc1, 0x92, 0xdb, 0x30,
+  0x08, 0xfd, 0x97, 0x9c, 0xcb, 0xa5, 0xed, 0xa9, 0xbf, 0xd2, 0xe9, 0x01, 0xcb, 0x44, 0x66, 0x23,
+  0x23, 0x17, 0x49, 0xc9, 0x26, 0x9d, 0xfe, 0x7b, 0x71, 0x76, 0x3a, 0x8b, 0x94, 0xe4, 0xe2, 0x31,
+  0x0f, 0x10, 0x08, 0xa1, 0x87, 0xfe, 0x1c, 0x4a, 0x6e, 0x1a, 0xa8, 0x1c, 0x7e, 0xfc, 0xfc, 0x73,
+  0xe0, 0xf9, 0xf0, 0xe3, 0x80, 0x53, 0x00, 0xa1, 0x4b, 0x39, 0xfc, 0xfd, 0x32, 0x20, 0x80, 0xcd,
+  0x81, 0xc7, 0x4a, 0xb2, 0xe5, 0x62, 0x5f, 0x07, 0x26, 0x78, 0xc3, 0x1b, 0x91, 0x22, 0x90, 0xc4,
+  0xc4, 0x65, 0x71, 0x3a, 0x29, 0xe8, 0x24, 0x8d, 0x88, 0xab, 0x97, 0x0b, 0x54, 0x0a, 0x8b, 0x70,
+  0xe8, 0xac, 0xae, 0x63, 0x2e, 0xa5, 0xe4, 0xc0, 0x58, 0x69, 0x86, 0x4d, 0xa9, 0x78, 0x4d, 0x2b,
+  0x55, 0x31, 0x31, 0x0a, 0x1c, 0x59, 0x50, 0xcc, 0x2a, 0x81, 0xd2, 0x99, 0xe9, 0xe2, 0x8c, 0xde,
+  0x39, 0x3b, 0x9f, 0xe9, 0x61, 0xaf, 0x3b, 0x52, 0xb6, 0xac, 0xd5, 0x41, 0x9c, 0x66, 0x27, 0x25,
+  0x2c, 0x95, 0x25, 0x7e, 0x54, 0x64, 0x52, 0xaf, 0x21, 0x0c, 0x0b, 0xa9, 0x05, 0x1d, 0x16, 0x48,
+  0x39, 0xaf, 0x13, 0x69, 0x74, 0x90, 0x12, 0xd7, 0x09, 0xb5, 0x8e, 0xe1, 0x5b, 0x61, 0xb1, 0x6d,
+  0x01, 0x4b, 0xe1, 0x99, 0xf4, 0xb5, 0x06, 0xda, 0xc9, 0x2b, 0x6f, 0xb7, 0x23, 0x91, 0x4b, 0x33,
+  0x3c, 0xec, 0x2c, 0x4c, 0x65, 0x44, 0x44, 0x3a, 0x01, 0xc8, 0x2b, 0xf5, 0xba, 0xd5, 0x0c, 0x21,
+  0x5b, 0xbc, 0xc1, 0x6f, 0x8f, 0x5e, 0x31, 0x5a, 0x32, 0x1b, 0x53, 0xa4, 0xe4, 0x34, 0x4c, 0x70,
+  0xb3, 0x9d, 0x7d, 0x22, 0x94, 0x60, 0x6d, 0x32, 0x67, 0x87, 0x48, 0xc4, 0x39, 0x92, 0xb7, 0x91,
+  0x4a, 0x5a, 0x91, 0x65, 0xb5, 0x3f, 0xb8, 0x10, 0x9d, 0xd2, 0xd5, 0x69, 0xcb, 0x26, 0xbd, 0x04,
+  0x41, 0x39, 0x58, 0x1d, 0x8e, 0x6e, 0xd5, 0xcf, 0x23, 0xdf, 0x7b, 0xd2, 0xe1, 0x39, 0xb4, 0xe2,
+  0xc5, 0x6c, 0x65, 0x4f, 0x09, 0xb8, 0xee, 0xad, 0xe2, 0x15, 0x5a, 0x9b, 0x90, 0x07, 0x9a, 0xc2,
+  0xfd, 0x53, 0x2f, 0x3e, 0x4e, 0x7e, 0x1f, 0xaa, 0xb1, 0x23, 0xf7, 0x8e, 0x71, 0x58, 0x4c, 0x79,
+  0x72, 0x4e, 0x31, 0xe7, 0x98, 0x68, 0xf0, 0x73, 0x20, 0xa0, 0xbe, 0xc0, 0xdb, 0x73, 0x7c, 0x7a,
+  0x61, 0xef, 0xef, 0x8e, 0xc7, 0x8f, 0x2f, 0xec, 0x59, 0x5e, 0xe0, 0x2f, 0xf2, 0xf4, 0x27, 0xeb,
+  0x71, 0x7d, 0x91, 0x67, 0x79, 0x91, 0x8f, 0xef, 0xdd, 0x98, 0x2b, 0x4d, 0x59, 0x63, 0x81, 0x91,
+  0x4d, 0xa2, 0x36, 0x12, 0x6b, 0xb6, 0x72, 0x23, 0x7f, 0x32, 0x0b, 0x86, 0x93, 0x75, 0x60, 0x5f,
+  0xcd, 0x05, 0xcd, 0x32, 0x15, 0xbb, 0x9d, 0xd5, 0xe5, 0xc8, 0xd1, 0x2d, 0xc7, 0x09, 0x4a, 0xb6,
+  0x0c, 0xbe, 0x7e, 0x87, 0xac, 0x6e, 0x3d, 0x36, 0xcf, 0x6d, 0x0f, 0x24, 0xde, 0xd3, 0xba, 0x6b,
+  0x42, 0xea, 0x01, 0x58, 0xb3, 0x90, 0x6b, 0xcd, 0x84, 0x10, 0x31, 0x50, 0xc5, 0x0e, 0x12, 0x0c,
+  0x9c, 0xa5, 0x83, 0x8c, 0x11, 0xda, 0x34, 0xa5, 0x8e, 0xdb, 0x2c, 0x13, 0x5b, 0x6e, 0x26, 0x8f,
+  0x48, 0xb7, 0x14, 0xfd, 0x6e, 0xbc, 0x75, 0xfa, 0x02, 0x46, 0x91, 0x9e, 0xc0, 0x12, 0x1b, 0xaf,
+  0x60, 0xed, 0xe2, 0xad, 0xa8, 0x3e, 0xce, 0x8a, 0x65, 0x41, 0xe3, 0x26, 0x87, 0xd0, 0x6c, 0x99,
+  0xa4, 0x8f, 0xa3, 0xa8, 0x79, 0x46, 0xb7, 0xa5, 0xb5, 0xc8, 0x14, 0x9c, 0x58, 0xcf, 0x43, 0xa1,
+  0xff, 0x23, 0xdd, 0x19, 0xca, 0x3d, 0x05, 0x5b, 0x32, 0x52, 0x8e, 0x8a, 0xdb, 0xc2, 0xe1, 0x89,
+  0x72, 0x24, 0x63, 0x79, 0xe0, 0xa8, 0x5d, 0xfa, 0xfa, 0xbd, 0x93, 0xa1, 0x04, 0xb6, 0xba, 0xb0,
+  0xbf, 0xd4, 0x1f, 0xbd, 0x9e, 0xd7, 0xee, 0x7e, 0xec, 0xe0, 0xce, 0x1d, 0xbd, 0xf7, 0x35, 0xeb,
+  0x09, 0x56, 0x8c, 0x78, 0x63, 0xdf, 0x43, 0x42, 0xef, 0x15, 0x26, 0x8e, 0x70, 0x6c, 0xb5, 0xf9,
+  0x66, 0x90, 0x63, 0x1a, 0x73, 0x5a, 0x1e, 0x10, 0x75, 0x41, 0xb6, 0x9c, 0xb8, 0x72, 0xc8, 0x1d,
+  0x72, 0x8d, 0xfe, 0x40, 0xd4, 0x57, 0x54, 0x29, 0x64, 0x7f, 0xe8, 0x4a, 0xf3, 0xcc, 0x15, 0x14,
+  0x8c, 0x95, 0x3c, 0xda, 0x8c, 0x13, 0x5d, 0x4c, 0x3f, 0x4f, 0xb4, 0x7a, 0xff, 0x6a, 0xe9, 0x31,
+  0x35, 0x9f, 0x60, 0xc1, 0xe9, 0xb7, 0x93, 0x3e, 0x58, 0x1a, 0xb2, 0xa4, 0xae, 0x06, 0xe5, 0x4c,
+  0x52, 0x4e, 0x08, 0x33, 0x46, 0xbb, 0x36, 0xb3, 0x67, 0xe4, 0xfa, 0xcd, 0xa5, 0x6f, 0x4c, 0x79,
+  0x1a, 0x46, 0xe2, 0x3e, 0xa9, 0x83, 0x36, 0x09, 0xcb, 0x33, 0x0c, 0x82, 0xf4, 0xb0, 0xe2, 0xec,
+  0x19, 0xae, 0x2e, 0x04, 0xb8, 0x92, 0x91, 0xb8, 0xcd, 0xea, 0x90, 0xa5, 0x90, 0x9e, 0xad, 0x47,
+  0xce, 0xd4, 0x9b, 0xec, 0x24, 0x6a, 0x86, 0x32, 0xdb, 0xf9, 0x71, 0xea, 0x75, 0x0b, 0xa7, 0x07,
+  0x44, 0xe6, 0x36, 0x40, 0xed, 0x68, 0x63, 0x21, 0xd6, 0x2c, 0xc3, 0x50, 0xd8, 0x95, 0xac, 0xf6,
+  0x3a, 0x81, 0xca, 0xab, 0x1f, 0x7a, 0xbb, 0xe2, 0x8d, 0xb4, 0x15, 0x4c, 0xb4, 0x3e, 0x71, 0xb2,
+  0x32, 0x59, 0xd7, 0x74, 0x97, 0x69, 0x87, 0xef, 0xdd, 0x74, 0xa1, 0xa9, 0x47, 0xef, 0x35, 0x7b,
+  0x66, 0x7e, 0x0f, 0x0a, 0xf9, 0x68, 0xf4, 0x3b, 0xfb, 0x19, 0xb4, 0xeb, 0xce, 0xf6, 0x4c, 0x18,
+  0xcc, 0x2f, 0xfb, 0xbc, 0xb2, 0xb7, 0x0d, 0x51, 0x85, 0x37, 0x1b, 0x48, 0x76, 0x95, 0x46, 0x83,
+  0xb2, 0xbc, 0xdc, 0xa7, 0x53, 0x8e, 0x9b, 0x35, 0xf1, 0x53, 0xb2, 0x3d, 0x8f, 0x5c, 0x70, 0xe6,
+  0x30, 0x0e, 0xad, 0x0b, 0xab, 0x7f, 0x65, 0xdc, 0x45, 0xf0, 0xed, 0x6c, 0x48, 0x2d, 0x61, 0xb1,
+  0xd7, 0x61, 0x81, 0x4b, 0xb6, 0xe7, 0xd0, 0xa7, 0xea, 0x9d, 0x65, 0x69, 0x46, 0x8f, 0xbe, 0xd1,
+  0xae, 0x77, 0xe9, 0xd7, 0xdf, 0x7f, 0x29, 0x19, 0x45, 0x02, 0x88, 0x0a, 0x00, 0x00
+};
+
+typedef struct {
+  char path[16];
+  char type[24];
+  char tag[16];
+  const uint8_t *data;
+  uint32_t length;      // gzipped
+} WebAsset;
+
+static const WebAsset WEB_ASSETS[WEB_ASSET_COUNT] PROGMEM = {
+  { "/app.css", "text/css", WEB_APP_CSS_TAG, WEB_APP_CSS, 1176 },
+  { "/app.js", "application/javascript", WEB_APP_JS_TAG, WEB_APP_JS, 178 },
+  { "/sources.json", "application/json", WEB_SOURCES_JSON_TAG, WEB_SOURCES_JSON, 830 }
+};
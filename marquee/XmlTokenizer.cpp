@@ -0,0 +1,310 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "XmlTokenizer.h"
+
+static const char CDATA_START[] = "[CDATA[";
+
+void XmlTokenizer::setListener(XmlListener* listener) {
+  this->listener = listener;
+}
+
+void XmlTokenizer::reset() {
+  state = TEXT;
+  nameLength = 0;
+  attributeNameLength = 0;
+  attributeValueLength = 0;
+  entityLength = 0;
+  matched = 0;
+}
+
+boolean XmlTokenizer::isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+void XmlTokenizer::append(char* buffer, uint8_t &length, size_t size, char c) {
+  if (length < size - 1) {
+    buffer[length++] = c;
+  }
+  buffer[length] = '\0';
+}
+
+// Text goes to the listener, attribute values into the buffer
+void XmlTokenizer::emit(char c) {
+  if (entityReturn == ATTRIBUTE_VALUE) {
+    append(attributeValue, attributeValueLength, sizeof(attributeValue), c);
+  } else {
+    listener->characters(c);
+  }
+}
+
+void XmlTokenizer::emitEntity() {
+  entity[entityLength] = '\0';
+  uint32_t code = 0;
+  if (entity[0] == '#') {
+    code = (entity[1] == 'x' || entity[1] == 'X') ? strtoul(entity + 2, nullptr, 16) : strtoul(entity + 1, nullptr, 10);
+  } else if (strcmp(entity, "amp") == 0) {
+    code = '&';
+  } else if (strcmp(entity, "lt") == 0) {
+    code = '<';
+  } else if (strcmp(entity, "gt") == 0) {
+    code = '>';
+  } else if (strcmp(entity, "quot") == 0) {
+    code = '"';
+  } else if (strcmp(entity, "apos") == 0) {
+    code = '\'';
+  } else if (strcmp(entity, "nbsp") == 0) {
+    code = ' ';
+  }
+  if (code == 0) {
+    // unknown -- pass it through untouched
+    emit('&');
+    for (uint8_t inx = 0; inx < entityLength; inx++) {
+      emit(entity[inx]);
+    }
+    emit(';');
+  } else if (code < 0x80) {
+    emit(code);
+  } else if (code < 0x800) {
+    emit(0xC0 | (code >> 6));
+    emit(0x80 | (code & 0x3F));
+  } else if (code < 0x10000) {
+    emit(0xE0 | (code >> 12));
+    emit(0x80 | ((code >> 6) & 0x3F));
+    emit(0x80 | (code & 0x3F));
+  } else {
+    emit(0xF0 | (code >> 18));
+    emit(0x80 | ((code >> 12) & 0x3F));
+    emit(0x80 | ((code >> 6) & 0x3F));
+    emit(0x80 | (code & 0x3F));
+  }
+  state = entityReturn;
+}
+
+void XmlTokenizer::parse(char c) {
+  if (listener == nullptr) {
+    return;
+  }
+  switch (state) {
+    case TEXT:
+      if (c == '<') {
+        state = TAG_START;
+      } else if (c == '&') {
+        entityLength = 0;
+        entityReturn = TEXT;
+        state = ENTITY;
+      } else {
+        listener->characters(c);
+      }
+      break;
+
+    case ENTITY:
+      if (c == ';') {
+        emitEntity();
+      } else if (entityLength >= sizeof(entity) - 1 || isSpace(c) || c == '<' || c == '&' || c == '"' || c == '\'') {
+        // a stray '&' -- give back what we held and look at c again
+        state = entityReturn;
+        emit('&');
+        for (uint8_t inx = 0; inx < entityLength; inx++) {
+          emit(entity[inx]);
+        }
+        parse(c);
+      } else {
+        entity[entityLength++] = c;
+      }
+      break;
+
+    case TAG_START:
+      nameLength = 0;
+      name[0] = '\0';
+      endTag = false;
+      if (c == '/') {
+        endTag = true;
+        state = TAG_NAME;
+      } else if (c == '!') {
+        matched = 0;
+        state = BANG;
+      } else if (c == '?') {
+        matched = 0;
+        state = PROCESSING;
+      } else {
+        append(name, nameLength, sizeof(name), c);
+        state = TAG_NAME;
+      }
+      break;
+
+    case TAG_NAME:
+      if (isSpace(c)) {
+        if (endTag) {
+          state = END_TAG_WAIT;
+        } else {
+          listener->startElement(name);
+          state = IN_TAG;
+        }
+      } else if (c == '>') {
+        if (endTag) {
+          listener->endElement(name);
+        } else {
+          listener->startElement(name);
+        }
+        state = TEXT;
+      } else if (c == '/' && !endTag) {
+        listener->startElement(name);
+        state = TAG_SLASH;
+      } else {
+        append(name, nameLength, sizeof(name), c);
+      }
+      break;
+
+    case IN_TAG:
+      if (c == '>') {
+        state = TEXT;
+      } else if (c == '/') {
+        state = TAG_SLASH;
+      } else if (!isSpace(c)) {
+        attributeNameLength = 0;
+        append(attributeName, attributeNameLength, sizeof(attributeName), c);
+        state = ATTRIBUTE_NAME;
+      }
+      break;
+
+    case ATTRIBUTE_NAME:
+      if (c == '=' || isSpace(c)) {
+        state = ATTRIBUTE_EQUALS;
+      } else if (c == '>') {
+        state = TEXT;
+      } else if (c == '/') {
+        state = TAG_SLASH;
+      } else {
+        append(attributeName, attributeNameLength, sizeof(attributeName), c);
+      }
+      break;
+
+    case ATTRIBUTE_EQUALS:
+      if (c == '"' || c == '\'') {
+        quote = c;
+        attributeValueLength = 0;
+        attributeValue[0] = '\0';
+        state = ATTRIBUTE_VALUE;
+      } else if (c == '>') {
+        state = TEXT;
+      } else if (c == '/') {
+        state = TAG_SLASH;
+      } else if (c != '=' && !isSpace(c)) {
+        // attribute without a value -- this is the next one
+        attributeNameLength = 0;
+        append(attributeName, attributeNameLength, sizeof(attributeName), c);
+        state = ATTRIBUTE_NAME;
+      }
+      break;
+
+    case ATTRIBUTE_VALUE:
+      if (c == quote) {
+        listener->attribute(attributeName, attributeValue);
+        state = IN_TAG;
+      } else if (c == '&') {
+        entityLength = 0;
+        entityReturn = ATTRIBUTE_VALUE;
+        state = ENTITY;
+      } else {
+        append(attributeValue, attributeValueLength, sizeof(attributeValue), c);
+      }
+      break;
+
+    case TAG_SLASH:
+      if (c == '>') {
+        listener->endElement(name);
+        state = TEXT;
+      }
+      break;
+
+    case END_TAG_WAIT:
+      if (c == '>') {
+        listener->endElement(name);
+        state = TEXT;
+      }
+      break;
+
+    case BANG:
+      // <!-- comment -->, <![CDATA[ ... ]]> or a declaration such as <!DOCTYPE ...>
+      if (c == '-' && matched == 0) {
+        matched = 1;
+      } else if (c == '-' && matched == 1) {
+        matched = 0;
+        state = COMMENT;
+      } else if (matched < sizeof(CDATA_START) - 1 && c == CDATA_START[matched]) {
+        if (++matched == sizeof(CDATA_START) - 1) {
+          matched = 0;
+          state = CDATA;
+        }
+      } else {
+        matched = 0;
+        state = c == '>' ? TEXT : DECLARATION;
+      }
+      break;
+
+    case COMMENT:
+      if (c == '>' && matched >= 2) {
+        state = TEXT;
+      }
+      matched = (c == '-') ? matched + 1 : 0;
+      break;
+
+    case CDATA:
+      if (c == ']') {
+        if (matched == 2) {
+          listener->characters(']'); // "]]]" -- the first one is text
+        } else {
+          matched++;
+        }
+      } else if (c == '>' && matched == 2) {
+        matched = 0;
+        state = TEXT;
+      } else {
+        for (; matched > 0; matched--) {
+          listener->characters(']');
+        }
+        listener->characters(c);
+      }
+      break;
+
+    case DECLARATION:
+      // skip to the closing '>', stepping over an internal [ ... ] subset
+      if (c == '[') {
+        matched++;
+      } else if (c == ']' && matched > 0) {
+        matched--;
+      } else if (c == '>' && matched == 0) {
+        state = TEXT;
+      }
+      break;
+
+    case PROCESSING:
+      if (c == '>' && matched == 1) {
+        state = TEXT;
+      }
+      matched = (c == '?') ? 1 : 0;
+      break;
+  }
+}
@@ -0,0 +1,78 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <Arduino.h>
+
+#define XML_NAME_LEN 32
+#define XML_ATTRIBUTE_LEN 160 // longer attribute values are cut
+
+// SAX-style callbacks. Element names keep their namespace prefix ("atom:link").
+class XmlListener {
+public:
+  virtual void startElement(const char* name) = 0;
+  virtual void attribute(const char* name, const char* value) = 0;
+  virtual void endElement(const char* name) = 0;
+  virtual void characters(char c) = 0;
+};
+
+/* Streaming XML tokenizer, fed one character at a time. It keeps only the
+   current tag name, one attribute and a partial entity, so memory use is the
+   same whatever the document size. Text is handed over character by
+   character with entities (&amp; &#8217; ...) decoded to UTF-8 and CDATA
+   passed through as is. Comments, processing instructions and DOCTYPE
+   declarations are skipped. It is forgiving rather than validating: it
+   never fails, malformed input just produces odd events.
+*/
+class XmlTokenizer {
+
+public:
+  void setListener(XmlListener* listener);
+  void reset();
+  void parse(char c);
+
+private:
+  enum State { TEXT, TAG_START, TAG_NAME, IN_TAG, ATTRIBUTE_NAME, ATTRIBUTE_EQUALS, ATTRIBUTE_VALUE,
+               TAG_SLASH, END_TAG_WAIT, BANG, COMMENT, CDATA, DECLARATION, PROCESSING, ENTITY };
+
+  XmlListener* listener = nullptr;
+  State state = TEXT;
+  State entityReturn = TEXT;   // TEXT or ATTRIBUTE_VALUE
+  boolean endTag = false;
+  char name[XML_NAME_LEN];
+  uint8_t nameLength = 0;
+  char attributeName[XML_NAME_LEN];
+  uint8_t attributeNameLength = 0;
+  char attributeValue[XML_ATTRIBUTE_LEN];
+  uint8_t attributeValueLength = 0;
+  char quote = '"';
+  char entity[10];
+  uint8_t entityLength = 0;
+  uint8_t matched = 0;         // progress through "--", "[CDATA[", "-->" or "]]>"
+
+  static boolean isSpace(char c);
+  void append(char* buffer, uint8_t &length, size_t size, char c);
+  void emit(char c);
+  void emitEntity();
+};
@@ -32,6 +32,7 @@
 #define HOSTNAME "CLOCK-"
 #define CONFIG "/conf.txt"
 #define BUZZER_PIN  D2
+#define arr_len( x )  ( sizeof( x ) / sizeof( *x ) )
 
 /* Useful Constants */
 // #define SECS_PER_MIN  (60UL)
@@ -61,18 +62,59 @@ float UtcOffset;  //time zone offsets that correspond with the CityID above (off
 // Time
 TimeDB TimeDB("");
 String lastMinute = "xx";
-int displayRefreshCount = 1;
 long lastEpoch = 0;
 long firstEpoch = 0;
 long displayOffEpoch = 0;
 boolean displayOn = true;
+String timeDbLat = "";  // the first city's position, saved so TimeZoneDB can be asked before the weather answers
+String timeDbLon = "";
+unsigned long timeDbTriedAt = 0; // millis() of the last TimeZoneDB request, 0 = retry now
+const unsigned long TIMEDB_RETRY_MS = 60000UL;
+
+SntpClock sntpClock;
+
+// What goes into each scroll -- items are added in configureScheduler()
+ContentScheduler scheduler;
+int scheduleWeather = -1;
+int scheduleMessage = -1;
+int scheduleNews = -1;
+int schedulePrinters = -1;
+int schedulePrintDone = -1;
+int schedulePihole = -1;
+int scheduleJson = -1;
+const int PIHOLE_GRAPH_DWELL = 10; // seconds the graph stays up after the Pi-hole stats
+const int PRINT_DONE_TTL = 600;    // seconds a "print done" may wait for the display
+unsigned long piholeRefreshedAt = 0; // millis() of the last Pi-hole fetch, 0 = never
+int finishedPrinters = 0;          // bit per printer whose print just ran to the end
+boolean wasPrinting[MAX_PRINTERS] = { false };
+
+// The ticker -- segments pulled a character at a time while scrolling
+MarqueeText ticker;
+uint32_t scrollHeapLow = 0;  // least free heap seen while scrolling
+uint32_t tickerHeapPeak = 0; // heap the last ticker scroll took beyond what was free when it started
+unsigned long pageStarted = 0;   // millis() when the page being served was started
+unsigned long assetRequests = 0;
+unsigned long assetNotModified = 0; // answered 304 -- the browser's copy was current
+unsigned long assetBytes = 0;
+uint32_t pageHeapPeak = 0;   // most heap a config page took while streaming its form
+const char *pageHeapPeakName = "";
+
+// Pushed messages (POST /api/message and UDP)
+WiFiUDP messageUdp;
+uint32_t pendingFirstPixel = 0; // queued message waiting for its first frame
+boolean showingMessage = false;
+
+// Custom JSON sources
+JsonPathSource jsonSources[MAX_JSON_SOURCES];
 
 // News Client
 NewsApiClient newsClient(NEWS_API_KEY, NEWS_SOURCE);
-int newsIndex = 0;
+RssClient rssClient;
 
 // Weather Client
-OpenWeatherMapClient weatherClient(APIKEY, CityIDs, 1, IS_METRIC);
+OpenWeatherMapClient weatherClient(APIKEY, CityIDs, MAX_CITIES, IS_METRIC);
+int weatherIndex = 0; // city the next ticker shows -- rotates each time the ticker scrolls
+int shownWeatherIndex = 0; // city the last ticker showed, for the wide clock's temperature
 // (some) Default Weather Settings
 boolean SHOW_DATE = false;
 boolean SHOW_CITY = true;
@@ -84,8 +126,7 @@ boolean SHOW_PRESSURE = false;
 boolean SHOW_HIGHLOW = true;
 
 // OctoPrint Client
-OctoPrintClient printerClient(OctoPrintApiKey, OctoPrintServer, OctoPrintPort, OctoAuthUser, OctoAuthPass);
-int printerCount = 0;
+OctoPrintClient printerClient(OctoPrintApiKey[0], OctoPrintServer[0], OctoPrintPort[0], OctoAuthUser, OctoAuthPass);
 
 // Pi-hole Client
 PiHoleClient piholeClient;
@@ -99,6 +140,7 @@ static const char WEB_ACTIONS1[] PROGMEM = "<a class='w3-bar-item w3-button' hre
                         "<a class='w3-bar-item w3-button' href='/configureoctoprint'><i class='fas fa-cube'></i> OctoPrint</a>";
 
 static const char WEB_ACTIONS2[] PROGMEM = "<a class='w3-bar-item w3-button' href='/configurepihole'><i class='fas fa-network-wired'></i> Pi-hole</a>"
+                        "<a class='w3-bar-item w3-button' href='/configurejson'><i class='fas fa-code'></i> JSON Sources</a>"
                         "<a class='w3-bar-item w3-button' href='/pull'><i class='fas fa-cloud-download-alt'></i> Refresh Data</a>"
                         "<a class='w3-bar-item w3-button' href='/display'>";
 
@@ -112,8 +154,14 @@ static const char CHANGE_FORM1[] PROGMEM = "<form class='w3-container' action='/
                       "<input class='w3-input w3-border w3-margin-bottom' type='text' name='TimeZoneDB' value='%TIMEDBKEY%' maxlength='60'>"
                       "<label>OpenWeatherMap API Key (get from <a href='https://openweathermap.org/' target='_BLANK'>here</a>)</label>"
                       "<input class='w3-input w3-border w3-margin-bottom' type='text' name='openWeatherMapApiKey' value='%WEATHERKEY%' maxlength='70'>"
-                      "<p><label>%CITYNAME1% (<a href='http://openweathermap.org/find' target='_BLANK'><i class='fas fa-search'></i> Search for City ID</a>)</label>"
-                      "<input class='w3-input w3-border w3-margin-bottom' type='text' name='city1' value='%CITY1%' onkeypress='return isNumberKey(event)'></p>"
+                      "<p><label>City IDs -- up to 5, fetched together and shown in turn (<a href='http://openweathermap.org/find' target='_BLANK'><i class='fas fa-search'></i> Search for City ID</a>)</label>"
+                      "%CITYINPUTS%</p>"
+                      "<p><input name='ntpenabled' class='w3-check' type='checkbox' %NTPCHECKED%> Keep time with SNTP (host or host:port)</p>"
+                      "<input class='w3-input w3-border w3-margin-bottom' type='text' name='ntpserver' value='%NTPSERVER%' maxlength='60'>"
+                      "<label>Time Zone Rule -- optional POSIX TZ string, DST is then worked out on the device (e.g. <i>CET-1CEST,M3.5.0,M10.5.0/3</i>)</label>"
+                      "<input class='w3-input w3-border w3-margin-bottom' type='text' name='tzrule' value='%TZRULE%' maxlength='60'>"
+                      "<p><input name='weathertls' class='w3-check' type='checkbox' %WEATHERTLSCHECKED%> Use HTTPS for OpenWeatherMap "
+                      "<input name='timedbtls' class='w3-check' type='checkbox' %TIMEDBTLSCHECKED%> Use HTTPS for TimeZoneDB<br><i>Certificates are checked against the root CAs built in (fingerprints in Settings.h override them)</i></p>"
                       "<p><input name='metric' class='w3-check w3-margin-top' type='checkbox' %CHECKED%> Use Metric (Celsius)</p>"
                       "<p><input name='showdate' class='w3-check w3-margin-top' type='checkbox' %DATE_CHECKED%> Display Date</p>"
                       "<p><input name='showcity' class='w3-check w3-margin-top' type='checkbox' %CITY_CHECKED%> Display City Name</p>"
@@ -138,8 +186,7 @@ static const char CHANGE_FORM2[] PROGMEM = "<p><input name='isPM' class='w3-chec
 static const char CHANGE_FORM3[] PROGMEM = "<hr><p><input name='isBasicAuth' class='w3-check w3-margin-top' type='checkbox' %IS_BASICAUTH_CHECKED%> Use Security Credentials for Configuration Changes</p>"
                       "<p><label>Marquee User ID (for this web interface)</label><input class='w3-input w3-border w3-margin-bottom' type='text' name='userid' value='%USERID%' maxlength='20'></p>"
                       "<p><label>Marquee Password </label><input class='w3-input w3-border w3-margin-bottom' type='password' name='stationpassword' value='%STATIONPASSWORD%'></p>"
-                      "<p><button class='w3-button w3-block w3-green w3-section w3-padding' type='submit'>Save</button></p></form>"
-                      "<script>function isNumberKey(e){var h=e.which?e.which:event.keyCode;return!(h>31&&(h<48||h>57))}</script>";
+                      "<p><button class='w3-button w3-block w3-green w3-section w3-padding' type='submit'>Save</button></p></form>";
 
 static const char WIDECLOCK_FORM[] PROGMEM = "<form class='w3-container' action='/savewideclock' method='get'><h2>Wide Clock Configuration:</h2>"
                           "<p>Wide Clock Display Format <select class='w3-option w3-padding' name='wideclockformat'>%WIDECLOCKOPTIONS%</select></p>"
@@ -152,20 +199,34 @@ static const char PIHOLE_FORM[] PROGMEM = "<form class='w3-container' action='/s
                         "<label>Pi-hole API Token (from Pi-hole &rarr; Settings &rarr; API/Web interface)</label>"
                         "<input class='w3-input w3-border w3-margin-bottom' type='text' name='piApiToken' id='piApiToken' value='%PIAPITOKEN%' maxlength='65'>"
                         "<input type='button' value='Test Connection and JSON Response' onclick='testPiHole()'><p id='PiHoleTest'></p>"
-                        "<button class='w3-button w3-block w3-green w3-section w3-padding' type='submit'>Save</button></form>"
-                        "<script>function isNumberKey(e){var h=e.which?e.which:event.keyCode;return!(h>31&&(h<48||h>57))}</script>";
+                        "%PIHOLEINPUTS%"
+                        "<button class='w3-button w3-block w3-green w3-section w3-padding' type='submit'>Save</button></form>";
 
 static const char PIHOLE_TEST[] PROGMEM = "<script>function testPiHole(){var e=document.getElementById(\"PiHoleTest\"),t=document.getElementById(\"piholeAddress\").value,"
                        "n=document.getElementById(\"piholePort\").value,api=document.getElementById(\"piApiToken\").value;;"
                        "if(e.innerHTML=\"\",\"\"==t||\"\"==n)return e.innerHTML=\"* Address and Port are required\","
                        "void(e.style.background=\"\");var r=\"http://\"+t+\":\"+n;r+=\"/api/stats/summary?sid=\"+api,window.open(r,\"_blank\").focus()}</script>";
 
+// Counts the print time left down in the browser between page loads
+static const char ETA_COUNTDOWN[] PROGMEM = "<script>setInterval(function(){document.querySelectorAll('.eta').forEach(function(e){var s=Math.max(0,--e.dataset.left);"
+                       "e.textContent=('0'+Math.floor(s/3600)).slice(-2)+':'+('0'+Math.floor(s%3600/60)).slice(-2)+':'+('0'+s%60).slice(-2)})},1000)</script>";
+
+static const char JSON_FORM[] PROGMEM = "<form class='w3-container' action='/savejson' method='get'><h2>JSON Sources:</h2>"
+                        "<p><input name='displayjson' class='w3-check w3-margin-top' type='checkbox' %JSONCHECKED%> Show values from JSON sources</p>"
+                        "<p>Any local http:// endpoint that returns JSON. Paths are separated by ; (e.g. <i>state;attributes.unit_of_measurement</i> or "
+                        "<i>data.result[0].value[1]</i>) and fill {0}..{3} in the format.</p>"
+                        "%JSONSOURCEINPUTS%"
+                        "<button class='w3-button w3-block w3-green w3-section w3-padding' type='submit'>Save</button></form>";
+
 static const char NEWS_FORM1[] PROGMEM =   "<form class='w3-container' action='/savenews' method='get'><h2>News Configuration:</h2>"
                         "<p><input name='displaynews' class='w3-check w3-margin-top' type='checkbox' %NEWSCHECKED%> Display News Headlines</p>"
                         "<label>News API Key (get from <a href='https://newsapi.org/' target='_BLANK'>here</a>)</label>"
                         "<input class='w3-input w3-border w3-margin-bottom' type='text' name='newsApiKey' value='%NEWSKEY%' maxlength='60'>"
+                        "<p><input name='newstls' class='w3-check' type='checkbox' %NEWSTLSCHECKED%> Use HTTPS (checked against the built in root CAs, or NEWS_FINGERPRINT and RSS_FINGERPRINT_1..4 in Settings.h)</p>"
+                        "<label>RSS or Atom Feed URLs (optional, up to 4, one per line -- merged with News API, the same story is shown once)</label>"
+                        "<textarea class='w3-input w3-border w3-margin-bottom' name='newsRssUrl' rows='4' maxlength='640'>%NEWSRSSURL%</textarea>"
                         "<p>Select News Source <select class='w3-option w3-padding' name='newssource' id='newssource'></select></p>"
-                        "<script>var s='%NEWSSOURCE%';var tt;var xmlhttp=new XMLHttpRequest();xmlhttp.open('GET','https://raw.githubusercontent.com/Qrome/marquee-scroller/master/sources.json',!0);"
+                        "<script>var s='%NEWSSOURCE%';var tt;var xmlhttp=new XMLHttpRequest();xmlhttp.open('GET','/sources.json?v=" WEB_SOURCES_JSON_TAG "',!0);"
                         "xmlhttp.onreadystatechange=function(){if(xmlhttp.readyState==4){if(xmlhttp.status==200){var obj=JSON.parse(xmlhttp.responseText);"
                         "obj.sources.forEach(t)}}};xmlhttp.send();function t(it){if(it!=null){if(s==it.id){se=' selected'}else{se=''}tt+='<option'+se+'>'+it.id+'</option>';"
                         "document.getElementById('newssource').innerHTML=tt}}</script>"
@@ -174,37 +235,48 @@ static const char NEWS_FORM1[] PROGMEM =   "<form class='w3-container' action='/
 static const char OCTO_FORM[] PROGMEM = "<form class='w3-container' action='/saveoctoprint' method='get'><h2>OctoPrint Configuration:</h2>"
                         "<p><input name='displayoctoprint' class='w3-check w3-margin-top' type='checkbox' %OCTOCHECKED%> Show OctoPrint Status</p>"
                         "<p><input name='octoprintprogress' class='w3-check w3-margin-top' type='checkbox' %OCTOPROGRESSCHECKED%> Show OctoPrint progress with clock</p>"
+                        "<p><input name='octoprintpush' class='w3-check w3-margin-top' type='checkbox' %OCTOPUSHCHECKED%> Live updates from OctoPrint (push instead of polling)</p>"
                         "<label>OctoPrint API Key (get from your server)</label><input class='w3-input w3-border w3-margin-bottom' type='text' name='octoPrintApiKey' value='%OCTOKEY%' maxlength='60'>"
                         "<label>OctoPrint Address (do not include http://)</label><input class='w3-input w3-border w3-margin-bottom' type='text' name='octoPrintAddress' value='%OCTOADDRESS%' maxlength='60'>"
                         "<label>OctoPrint Port</label><input class='w3-input w3-border w3-margin-bottom' type='text' name='octoPrintPort' value='%OCTOPORT%' maxlength='5'  onkeypress='return isNumberKey(event)'>"
                         "<label>OctoPrint User (only needed if you have haproxy or basic auth turned on)</label><input class='w3-input w3-border w3-margin-bottom' type='text' name='octoUser' value='%OCTOUSER%' maxlength='30'>"
                         "<label>OctoPrint Password </label><input class='w3-input w3-border w3-margin-bottom' type='password' name='octoPass' value='%OCTOPASS%'>"
-                        "<button class='w3-button w3-block w3-green w3-section w3-padding' type='submit'>Save</button></form>"
-                        "<script>function isNumberKey(e){var h=e.which?e.which:event.keyCode;return!(h>31&&(h<48||h>57))}</script>";
-
-static const char COLOR_THEMES[] PROGMEM = "<option>red</option>"
-                      "<option>pink</option>"
-                      "<option>purple</option>"
-                      "<option>deep-purple</option>"
-                      "<option>indigo</option>"
-                      "<option>blue</option>"
-                      "<option>light-blue</option>"
-                      "<option>cyan</option>"
-                      "<option>teal</option>"
-                      "<option>green</option>"
-                      "<option>light-green</option>"
-                      "<option>lime</option>"
-                      "<option>khaki</option>"
-                      "<option>yellow</option>"
-                      "<option>amber</option>"
-                      "<option>orange</option>"
-                      "<option>deep-orange</option>"
-                      "<option>blue-grey</option>"
-                      "<option>brown</option>"
-                      "<option>grey</option>"
-                      "<option>dark-grey</option>"
-                      "<option>black</option>"
-                      "<option>w3schools</option>";
+                        "%OCTOPRINTERINPUTS%"
+                        "<button class='w3-button w3-block w3-green w3-section w3-padding' type='submit'>Save</button></form>";
+
+// Base color, darker shade and text color of each w3-theme
+typedef struct {
+  char name[12];
+  char color[8];
+  char dark[8];
+  char text[5];
+} ThemeColor;
+
+static const ThemeColor THEME_COLORS[] PROGMEM = {
+  { "red", "#f44336", "#cd180b", "#fff" },
+  { "pink", "#e91e63", "#a51043", "#fff" },
+  { "purple", "#9c27b0", "#61186d", "#fff" },
+  { "deep-purple", "#673ab7", "#442679", "#fff" },
+  { "indigo", "#3f51b5", "#2a3678", "#fff" },
+  { "blue", "#2196f3", "#0a6bb8", "#fff" },
+  { "light-blue", "#87ceeb", "#41b1df", "#000" },
+  { "cyan", "#00bcd4", "#007482", "#fff" },
+  { "teal", "#009688", "#00443e", "#fff" },
+  { "green", "#4caf50", "#337636", "#fff" },
+  { "light-green", "#8bc34a", "#618d2f", "#000" },
+  { "lime", "#cddc39", "#99a61d", "#000" },
+  { "khaki", "#f0e68c", "#e7d644", "#000" },
+  { "yellow", "#ffeb3b", "#e8d100", "#000" },
+  { "amber", "#ffc107", "#b48700", "#000" },
+  { "orange", "#ff9800", "#ad6700", "#000" },
+  { "deep-orange", "#ff5722", "#cf3200", "#fff" },
+  { "blue-grey", "#607d8b", "#3f525b", "#fff" },
+  { "brown", "#795548", "#46312a", "#fff" },
+  { "grey", "#9e9e9e", "#757575", "#000" },
+  { "dark-grey", "#616161", "#383838", "#fff" },
+  { "black", "#000000", "#333333", "#fff" },
+  { "w3schools", "#04aa6d", "#025a3a", "#fff" }
+};
 
 
 const int TIMEOUT = 500; // 500 = 1/2 second
@@ -226,6 +298,8 @@ void setup() {
   Serial.println();
 
   readCityIds();  // This reads all configuraiton data from LittleFS
+  TimeDB.setClock(&sntpClock);
+  TlsSession::setClock([]() { return TimeDB.isSynced() ? TimeDB.getUtc() : (time_t) 0; }); // certificate dates
 
   Serial.println("Number of LED Displays: " + String(numberOfHorizontalDisplays));
   // initialize dispaly
@@ -241,7 +315,7 @@ void setup() {
   matrix.fillScreen(LOW); // show black
   centerPrint("hello");
 
-  piholeClient = PiHoleClient(PiHoleServer, PiHolePort, PiHoleApiKey); // Data read from LittleFS
+  configurePiholes(); // Data read from LittleFS
 
   tone(BUZZER_PIN, 415, 500);
   delay(500 * 1.3);
@@ -321,6 +395,9 @@ void setup() {
     server.on("/savenews", handleSaveNews);
     server.on("/saveoctoprint", handleSaveOctoprint);
     server.on("/savepihole", handleSavePihole);
+    server.on("/savejson", handleSaveJson);
+    server.on("/api/message", HTTP_POST, handleApiMessage);
+    server.on("/debug/scheduler", handleDebugScheduler);
     server.on("/systemreset", handleSystemReset);
     server.on("/forgetwifi", handleForgetWifi);
     server.on("/configure", handleConfigure);
@@ -328,8 +405,14 @@ void setup() {
     server.on("/configurenews", handleNewsConfigure);
     server.on("/configureoctoprint", handleOctoprintConfigure);
     server.on("/configurepihole", handlePiholeConfigure);
+    server.on("/configurejson", handleJsonConfigure);
     server.on("/display", handleDisplay);
+    for (int inx = 0; inx < WEB_ASSET_COUNT; inx++) {
+      server.on(String(FPSTR(WEB_ASSETS[inx].path)), HTTP_GET, handleWebAsset);
+    }
     server.onNotFound(redirectHome);
+    static const char *assetHeaders[] = { "If-None-Match" };
+    server.collectHeaders(assetHeaders, arr_len(assetHeaders));
     serverUpdater.setup(&server, "/update", www_username, www_password);
     // Start the server
     server.begin();
@@ -343,6 +426,11 @@ void setup() {
     scrollMessage("Web Interface is Disabled");
   }
 
+  if (MESSAGE_UDP_PORT > 0) {
+    messageUdp.begin(MESSAGE_UDP_PORT);
+    Serial.println("Listening for messages on UDP port " + String(MESSAGE_UDP_PORT));
+  }
+
   flashLED(1, 500);
 }
 
@@ -350,11 +438,40 @@ void setup() {
 // Main Looop
 //************************************************************
 void loop() {
+  updateTimeZone(); // ahead of the weather -- its refresh is timed from this clock
   //Get some Weather Data to serve
   if ((getMinutesFromLastRefresh() >= minutesBetweenDataRefresh) || lastEpoch == 0) {
     getWeatherData();
   }
   checkDisplay(); // this will see if we need to turn it on or off for night mode.
+  dnsCache.refresh(); // keep the API host addresses fresh outside of the data requests
+  if (NTP_ENABLED && sntpClock.isDue()) {
+    sntpClock.sync();
+  }
+  if (JSON_SOURCES_ENABLED) {
+    for (int inx = 0; inx < MAX_JSON_SOURCES; inx++) {
+      if (jsonSources[inx].isDue()) {
+        jsonSources[inx].update();
+      }
+    }
+  }
+  if (OCTOPRINT_ENABLED) {
+    printerClient.maintainPush(); // connect or log in again here, not in the middle of a scroll
+  }
+  if (OCTOPRINT_ENABLED && displayOn && printerClient.isDue()) {
+    // each printer is on its own schedule -- often while printing, seldom while idle
+    printerClient.getPrinterJobResults();
+  }
+  if (USE_PIHOLE && displayOn && (piholeRefreshedAt == 0 || millis() - piholeRefreshedAt >= max(minutesBetweenScrolling, 1) * 60000UL)) {
+    // on its own clock, once per scroll interval -- not in front of whatever scroll comes next
+    piholeClient.getPiHoleData();
+    piholeClient.getGraphData();
+    piholeRefreshedAt = millis();
+  }
+
+  if (displayOn && messageQueue.hasMessage()) {
+    showQueuedMessage();
+  }
 
   if (lastMinute != TimeDB.zeroPad(minute())) {
     lastMinute = TimeDB.zeroPad(minute());
@@ -368,80 +485,16 @@ void loop() {
       matrix.shutdown(false);
     }
     matrix.fillScreen(LOW); // show black
-    if (OCTOPRINT_ENABLED) {
-      if (displayOn && ((printerClient.isOperational() || printerClient.isPrinting()) || printerCount == 0)) {
-        // This should only get called if the printer is actually running or if it has been 2 minutes since last check
-        printerClient.getPrinterJobResults();
-      }
-      printerCount += 1;
-      if (printerCount > 2) {
-        printerCount = 0;
-      }
-    }
-
-    displayRefreshCount --;
-    // Check to see if we need to Scroll some Data
-    if (displayRefreshCount <= 0) {
-      displayRefreshCount = minutesBetweenScrolling;
-      String temperature = weatherClient.getTempRounded(0);
-      String description = weatherClient.getDescription(0);
-      description.toUpperCase();
-      String msg;
-      msg += " ";
-
-      if (SHOW_DATE) {
-        msg += TimeDB.getDayName() + ", ";
-        msg += TimeDB.getMonthName() + " " + day() + "  ";
-      }
-      if (SHOW_CITY) {
-        msg += weatherClient.getCity(0) + "  ";
-      }
-      msg += temperature + getTempSymbol() + "  ";
 
-      //show high/low temperature
-      if (SHOW_HIGHLOW) {
-        msg += "High/Low:" + weatherClient.getHigh(0) + "/" + weatherClient.getLow(0) + " " + getTempSymbol() + "  ";
-      }
-      
-      if (SHOW_CONDITION) {
-        msg += description + "  ";
-      }
-      if (SHOW_HUMIDITY) {
-        msg += "Humidity:" + weatherClient.getHumidityRounded(0) + "%  ";
-      }
-      if (SHOW_WIND) {
-        msg += "Wind: " + weatherClient.getDirectionText(0) + " @ " + weatherClient.getWindRounded(0) + " " + getSpeedSymbol() + "  ";
-      }
-      //line to show barometric pressure
-      if (SHOW_PRESSURE) {
-        msg += "Pressure:" + weatherClient.getPressure(0) + getPressureSymbol() + "  ";
-      }
-     
-      msg += marqueeMessage + " ";
-      
-      if (NEWS_ENABLED) {
-        msg += "  " + NEWS_SOURCE + ": " + newsClient.getTitle(newsIndex) + "  ";
-        newsIndex += 1;
-        if (newsIndex > 9) {
-          newsIndex = 0;
-        }
-      }
-      if (OCTOPRINT_ENABLED && printerClient.isPrinting()) {
-        msg += "  " + printerClient.getFileName() + " ";
-        msg += "(" + printerClient.getProgressCompletion() + "%)  ";
-      }
-      if (USE_PIHOLE) {
-        piholeClient.getPiHoleData();
-        piholeClient.getGraphData();
-        if (piholeClient.getPiHoleStatus() != "") {
-          // msg += "    Pi-hole (" + piholeClient.getPiHoleStatus() + "): " + piholeClient.getAdsPercentageToday() + "% "; 
-          msg += "    Pi-hole (" + piholeClient.getPiHoleStatus() + "): " + piholeClient.getAdsPercentageToday() + "% "; 
-        }
-      }
+    runTicker(false); // whatever the scheduler has due
+  } else if (displayOn && scheduler.hasPreempting()) {
+    runTicker(true);  // e.g. a print just finished -- don't wait for the minute
+  }
 
-      scrollMessage(msg);
-      drawPiholeGraph();
-    }
+  if (scheduler.isHolding()) {
+    // the last scroll's items keep the display a while (the Pi-hole graph)
+    handleBackgroundTasks();
+    return;
   }
 
   String currentTime = hourMinutes(false);
@@ -449,7 +502,8 @@ void loop() {
   if (numberOfHorizontalDisplays >= 8) {
     if (Wide_Clock_Style == "1") {
       // On Wide Display -- show the current temperature as well
-      String currentTemp = weatherClient.getTempRounded(0);
+      // follows the city last shown in the ticker
+      String currentTemp = weatherClient.getTempRounded(shownWeatherIndex);
       currentTime += " " + currentTemp + getTempSymbol();
     }
     if (Wide_Clock_Style == "2") {
@@ -463,12 +517,240 @@ void loop() {
   matrix.fillScreen(LOW);
   centerPrint(currentTime, true);
 
+  handleBackgroundTasks();
+}
+
+// One scroll of the items the scheduler picks -- all that are due, or only the preempting ones
+void runTicker(boolean preemptingOnly) {
+  scheduler.setReady(scheduleWeather, true);
+  scheduler.setReady(scheduleMessage, marqueeMessage != "");
+  scheduler.setReady(scheduleNews, NEWS_ENABLED && headlines.getCount() > 0);
+  scheduler.setReady(schedulePrinters, OCTOPRINT_ENABLED && printerClient.getPrintingCount() > 0);
+  scheduler.setReady(schedulePihole, USE_PIHOLE && piholeClient.getPiHoleStatus() != "");
+  boolean jsonFound = false;
+  for (int inx = 0; inx < MAX_JSON_SOURCES; inx++) {
+    jsonFound |= jsonSources[inx].isConfigured() && jsonSources[inx].getFoundCount() > 0;
+  }
+  scheduler.setReady(scheduleJson, JSON_SOURCES_ENABLED && jsonFound);
+
+  int chosen[SCHEDULE_MAX_PER_SCROLL];
+  int picked = scheduler.select(chosen, SCHEDULE_MAX_PER_SCROLL, preemptingOnly);
+  if (picked == 0) {
+    return;
+  }
+  int cityCount = weatherClient.getCityCount();
+  if (weatherIndex >= cityCount) {
+    weatherIndex = 0;
+  }
+  if (shownWeatherIndex >= cityCount) {
+    shownWeatherIndex = 0;
+  }
+  boolean weatherShown = false;
+  boolean piholeShown = false;
+  int newsShown = -1;
+  int printDoneShown = 0;
+
+  // the segments are formatted as they scroll into view, the message is never built
+  uint32_t heapBefore = ESP.getFreeHeap();
+  scrollHeapLow = heapBefore;
+  ticker.clear();
+  ticker.add(" ");
+  for (int pick = 0; pick < picked; pick++) {
+    int item = chosen[pick];
+    if (item == scheduleWeather) {
+      if (SHOW_DATE) {
+        ticker.add(formatDateSegment);
+      }
+      ticker.add(formatWeatherLine, weatherIndex);
+      shownWeatherIndex = weatherIndex;
+      weatherShown = true;
+    } else if (item == scheduleMessage) {
+      ticker.add(formatMessageSegment);
+    } else if (item == scheduleNews) {
+      newsShown = headlines.next(); // newest not yet shown
+      if (newsShown >= 0) {
+        ticker.add(formatNewsSegment, newsShown);
+      }
+    } else if (item == schedulePrinters) {
+      for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+        if (printerClient.isPrinting(inx)) {
+          ticker.add(formatPrinterSegment, inx);
+        }
+      }
+    } else if (item == schedulePrintDone) {
+      ticker.add(formatPrintDoneSegment, finishedPrinters);
+      printDoneShown = finishedPrinters;
+      finishedPrinters = 0;
+    } else if (item == schedulePihole) {
+      ticker.add(formatPiholeSegment);
+      piholeShown = true;
+    } else if (item == scheduleJson) {
+      for (int inx = 0; inx < MAX_JSON_SOURCES; inx++) {
+        if (jsonSources[inx].isConfigured() && jsonSources[inx].getFoundCount() > 0) {
+          ticker.add(formatJsonSegment, inx);
+        }
+      }
+    }
+  }
+
+  matrix.fillScreen(LOW);
+  boolean completed = scrollMessage(ticker);
+  scheduler.finished(!completed);
+  tickerHeapPeak = heapBefore - scrollHeapLow;
+  Serial.println("Ticker: " + String(ticker.length()) + " characters from " + String(ticker.getSegmentCount()) + " segments, heap peak " + String(tickerHeapPeak) + " bytes");
+  if (piholeShown && completed && !drawPiholeGraph()) {
+    scheduler.release(); // no graph to hold the display for
+  }
+  if (!completed) {
+    // the scheduler puts the items back; what they had moved on goes back with them
+    headlines.unshow(newsShown);
+    finishedPrinters |= printDoneShown;
+    return;
+  }
+  if (weatherShown && cityCount > 1) {
+    weatherIndex = (weatherIndex + 1) % cityCount;
+  }
+}
+
+// A print that ran to the end posts the "print done" item, which cuts into whatever
+// is scrolling. Called every frame -- printer 0 may be updated by push meanwhile.
+void checkFinishedPrints() {
+  for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+    boolean printing = printerClient.isPrinting(inx);
+    if (printing) {
+      finishedPrinters &= ~(1 << inx);
+    } else if (wasPrinting[inx] && printerClient.isOperational(inx) && printerClient.getProgressCompletion(inx).toFloat() >= 99) {
+      finishedPrinters |= 1 << inx;
+      scheduler.post(schedulePrintDone);
+    }
+    wasPrinting[inx] = printing;
+  }
+}
+
+// Scheduler items, added once; the intervals follow the settings
+void configureScheduler() {
+  unsigned long scroll = max(minutesBetweenScrolling, 1) * 60UL;
+  if (scheduleWeather < 0) {
+    scheduleWeather = scheduler.add("weather", 1, scroll, 0, 0);
+    scheduleMessage = scheduler.add("message", 1, scroll, 0, 0);
+    scheduleNews = scheduler.add("news", 0, scroll, 0, 0);
+    schedulePrinters = scheduler.add("printers", 2, scroll, 0, 0);
+    schedulePrintDone = scheduler.add("print done", SCHEDULE_PRIORITY_PREEMPT, 0, PRINT_DONE_TTL, 0);
+    schedulePihole = scheduler.add("pihole", 0, scroll, 0, PIHOLE_GRAPH_DWELL);
+    scheduleJson = scheduler.add("json", 1, scroll, 0, 0);
+  }
+  scheduler.setInterval(scheduleWeather, scroll);
+  scheduler.setInterval(scheduleMessage, scroll);
+  scheduler.setInterval(scheduleNews, scroll);
+  scheduler.setInterval(schedulePrinters, scroll);
+  scheduler.setInterval(schedulePihole, scroll);
+  scheduler.setInterval(scheduleJson, scroll);
+}
+
+// GET /debug/scheduler -- the items and the latest decisions
+void handleDebugScheduler() {
+  server.send(200, "text/plain", scheduler.getReport());
+}
+
+// Work that has to keep going while the display is busy scrolling or drawing
+void handleBackgroundTasks() {
+  syncLocalTime();
   if (WEBSERVER_ENABLED) {
     server.handleClient();
   }
   if (ENABLE_OTA) {
     ArduinoOTA.handle();
   }
+  if (OCTOPRINT_ENABLED) {
+    printerClient.handlePush();
+    checkFinishedPrints();
+  }
+  checkUdpMessages();
+}
+
+void showQueuedMessage() {
+  char text[MESSAGE_TEXT_LEN];
+  uint32_t id;
+  if (!messageQueue.next(text, sizeof(text), id)) {
+    return;
+  }
+  matrix.fillScreen(LOW);
+  showingMessage = true;
+  pendingFirstPixel = id;
+  scrollMessage(" " + String(text));
+  showingMessage = false;
+  messageQueue.displayed(id);
+}
+
+// UDP packet: plain text, "priority,ttl,repeat|text" (each number optional),
+// or form encoded like the POST body: "text=...&priority=2&ttl=60&repeat=1"
+void checkUdpMessages() {
+  if (MESSAGE_UDP_PORT == 0 || messageUdp.parsePacket() <= 0) {
+    return;
+  }
+  char packet[MESSAGE_TEXT_LEN + 48];
+  int length = messageUdp.read(packet, sizeof(packet) - 1);
+  packet[max(length, 0)] = '\0';
+  long values[3] = { MESSAGE_DEFAULT_PRIORITY, MESSAGE_DEFAULT_TTL, 1 };
+  char formText[MESSAGE_TEXT_LEN];
+  if (DisplayText::getFormArg(packet, "text", formText, sizeof(formText))) {
+    const char* names[3] = { "priority", "ttl", "repeat" };
+    char number[12];
+    for (int inx = 0; inx < 3; inx++) {
+      if (DisplayText::getFormArg(packet, names[inx], number, sizeof(number))) {
+        values[inx] = atol(number);
+      }
+    }
+    values[1] = constrain(values[1], 0L, (long) MESSAGE_MAX_TTL);
+    if (formText[0] != '\0') {
+      messageQueue.push(formText, values[0], values[1], values[2]);
+    }
+    return;
+  }
+  char* text = packet;
+  char* bar = strchr(packet, '|');
+  if (bar != nullptr && strspn(packet, "0123456789,") == (size_t)(bar - packet)) {
+    char* field = packet;
+    for (int inx = 0; inx < 3 && field < bar; inx++) {
+      char* end;
+      long value = strtol(field, &end, 10);
+      if (end != field) {
+        values[inx] = value;
+      }
+      field = end + 1; // past the comma
+    }
+    text = bar + 1;
+  }
+  values[1] = constrain(values[1], 0L, (long) MESSAGE_MAX_TTL);
+  if (text[0] != '\0') {
+    messageQueue.push(Headlines::cleanText(text).c_str(), values[0], values[1], values[2]);
+  }
+}
+
+// Keep TimeLib on the disciplined clock. It is set just as the clock's second
+// changes, so the seconds TimeLib counts stay in phase with UTC.
+// The clock and DST rule run on the device -- TimeZoneDB is only asked once a
+// day, after a config change, or every TIMEDB_RETRY_MS until it has answered
+void updateTimeZone() {
+  TimeDB.updateConfig(TIMEDBKEY, timeDbLat, timeDbLon);
+  if (!TimeDB.needsUpdate() || (timeDbTriedAt != 0 && millis() - timeDbTriedAt < TIMEDB_RETRY_MS)) {
+    return;
+  }
+  timeDbTriedAt = millis();
+  Serial.println("Updating Time...");
+  if (!TimeDB.updateTime()) {
+    Serial.println("Time update unsuccessful!");
+  }
+  syncLocalTime();
+}
+
+void syncLocalTime() {
+  static time_t lastLocal = 0;
+  time_t local = TimeDB.getLocalTime();
+  if (local != 0 && local != lastLocal) {
+    lastLocal = local;
+    setTime(local);
+  }
 }
 
 String zeroPad(int value) {
@@ -526,9 +808,16 @@ void handleSaveNews() {
   NEWS_ENABLED = server.hasArg("displaynews");
   NEWS_API_KEY = server.arg("newsApiKey");
   NEWS_SOURCE = server.arg("newssource");
+  NEWS_RSS_URL = server.arg("newsRssUrl");
+  NEWS_RSS_URL.replace("\r", "");
+  NEWS_RSS_URL.replace("\n", " "); // kept on one line in the config file
+  NEWS_RSS_URL.trim();
+  rssClient.setUrls(NEWS_RSS_URL);
+  NEWS_USE_TLS = server.hasArg("newstls");
+  newsClient.setTls(NEWS_USE_TLS, NEWS_FINGERPRINT);
   matrix.fillScreen(LOW); // show black
   writeCityIds();
-  newsClient.updateNews();
+  updateNews();
   redirectHome();
 }
 
@@ -538,9 +827,16 @@ void handleSaveOctoprint() {
   }
   OCTOPRINT_ENABLED = server.hasArg("displayoctoprint");
   OCTOPRINT_PROGRESS = server.hasArg("octoprintprogress");
-  OctoPrintApiKey = server.arg("octoPrintApiKey");
-  OctoPrintServer = server.arg("octoPrintAddress");
-  OctoPrintPort = server.arg("octoPrintPort").toInt();
+  OCTOPRINT_PUSH = server.hasArg("octoprintpush");
+  OctoPrintApiKey[0] = server.arg("octoPrintApiKey");
+  OctoPrintServer[0] = server.arg("octoPrintAddress");
+  OctoPrintPort[0] = server.arg("octoPrintPort").toInt();
+  for (int inx = 1; inx < MAX_PRINTERS; inx++) {
+    String number = String(inx + 1);
+    OctoPrintApiKey[inx] = server.arg("octoPrintApiKey" + number);
+    OctoPrintServer[inx] = server.arg("octoPrintAddress" + number);
+    OctoPrintPort[inx] = server.hasArg("octoPrintPort" + number) ? server.arg("octoPrintPort" + number).toInt() : 80;
+  }
   OctoAuthUser = server.arg("octoUser");
   OctoAuthPass = server.arg("octoPass");
   matrix.fillScreen(LOW); // show black
@@ -556,12 +852,18 @@ void handleSavePihole() {
     return server.requestAuthentication();
   }
   USE_PIHOLE = server.hasArg("displaypihole");
-  PiHoleServer = server.arg("piholeAddress");
-  PiHolePort = server.arg("piholePort").toInt();
-  PiHoleApiKey = server.arg("piApiToken");
-  Serial.println("PiHoleApiKey from save: " + PiHoleApiKey);
+  PiHoleServer[0] = server.arg("piholeAddress");
+  PiHolePort[0] = server.arg("piholePort").toInt();
+  PiHoleApiKey[0] = server.arg("piApiToken");
+  for (int inx = 1; inx < MAX_PIHOLES; inx++) {
+    String number = String(inx + 1);
+    PiHoleServer[inx] = server.arg("piholeAddress" + number);
+    PiHolePort[inx] = server.hasArg("piholePort" + number) ? server.arg("piholePort" + number).toInt() : 80;
+    PiHoleApiKey[inx] = server.arg("piApiToken" + number);
+  }
+  Serial.println("PiHoleApiKey from save: " + PiHoleApiKey[0]);
   writeCityIds();
-  piholeClient = PiHoleClient(PiHoleServer, PiHolePort, PiHoleApiKey);
+  configurePiholes();
   if (USE_PIHOLE) {
     piholeClient.getPiHoleData();
     // piholeClient.getGraphData(PiHoleServer, PiHolePort, PiHoleApiKey);
@@ -569,13 +871,75 @@ void handleSavePihole() {
   redirectHome();
 }
 
+// POST /api/message -- text (or a plain text body), priority 0-3 (default 2, cuts in), ttl in seconds, repeat
+void handleApiMessage() {
+  if (!athentication()) {
+    return server.requestAuthentication();
+  }
+  String text = server.hasArg("text") ? server.arg("text") : server.arg("plain");
+  text.trim();
+  if (text == "") {
+    server.send(400, "application/json", "{\"error\":\"text is required\"}");
+    return;
+  }
+  int priority = server.hasArg("priority") ? server.arg("priority").toInt() : MESSAGE_DEFAULT_PRIORITY;
+  // a negative ttl would wrap to years once it is unsigned
+  long ttl = server.hasArg("ttl") ? constrain(server.arg("ttl").toInt(), 0L, (long) MESSAGE_MAX_TTL) : MESSAGE_DEFAULT_TTL;
+  int repeat = server.hasArg("repeat") ? server.arg("repeat").toInt() : 1;
+  uint32_t id = messageQueue.push(Headlines::cleanText(text).c_str(), priority, ttl, repeat);
+  if (id == 0) {
+    server.send(503, "application/json", "{\"error\":\"queue is full\"}");
+    return;
+  }
+  server.send(202, "application/json", "{\"id\":" + String(id) + ",\"queued\":" + String(messageQueue.getCount()) + "}");
+}
+
+void handleSaveJson() {
+  if (!athentication()) {
+    return server.requestAuthentication();
+  }
+  JSON_SOURCES_ENABLED = server.hasArg("displayjson");
+  for (int inx = 0; inx < MAX_JSON_SOURCES; inx++) {
+    String number = String(inx + 1);
+    JsonSourceName[inx] = server.arg("jsonName" + number);
+    JsonSourceUrl[inx] = server.arg("jsonUrl" + number);
+    JsonSourceHeader[inx] = server.arg("jsonHeader" + number);
+    JsonSourcePaths[inx] = server.arg("jsonPaths" + number);
+    JsonSourceFormat[inx] = server.arg("jsonFormat" + number);
+    JsonSourceRefresh[inx] = server.arg("jsonRefresh" + number).toInt();
+  }
+  writeCityIds();
+  configureJsonSources();
+  redirectHome();
+}
+
+void configurePiholes() {
+  for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+    piholeClient.setInstance(inx, PiHoleServer[inx], PiHolePort[inx], PiHoleApiKey[inx]);
+  }
+}
+
+void configureJsonSources() {
+  for (int inx = 0; inx < MAX_JSON_SOURCES; inx++) {
+    jsonSources[inx].configure(JsonSourceName[inx], JsonSourceUrl[inx], JsonSourceHeader[inx], JsonSourcePaths[inx], JsonSourceFormat[inx], JsonSourceRefresh[inx]);
+  }
+}
+
 void handleLocations() {
   if (!athentication()) {
     return server.requestAuthentication();
   }
+  String previousRequest = TIMEDBKEY + APIKEY + getCityIdList();
   TIMEDBKEY = server.arg("TimeZoneDB");
   APIKEY = server.arg("openWeatherMapApiKey");
-  CityIDs[0] = server.arg("city1").toInt();
+  int cityInx = 0;
+  for (int inx = 0; inx < MAX_CITIES; inx++) {
+    CityIDs[inx] = 0;
+    int cityId = server.arg("city" + String(inx + 1)).toInt();
+    if (cityId > 0) {
+      CityIDs[cityInx++] = cityId; // keep the list packed so it lines up with the weather results
+    }
+  }
   flashOnSeconds = server.hasArg("flashseconds");
   IS_24HOUR = server.hasArg("is24hour");
   IS_PM = server.hasArg("isPM");
@@ -587,6 +951,13 @@ void handleLocations() {
   SHOW_PRESSURE = server.hasArg("showpressure");
   SHOW_HIGHLOW = server.hasArg("showhighlow");
   IS_METRIC = server.hasArg("metric");
+  WEATHER_USE_TLS = server.hasArg("weathertls");
+  TIMEDB_USE_TLS = server.hasArg("timedbtls");
+  NTP_ENABLED = server.hasArg("ntpenabled");
+  NTP_SERVER = server.arg("ntpserver");
+  NTP_SERVER.trim();
+  TIMEZONE_RULE = server.arg("tzrule");
+  TIMEZONE_RULE.trim();
   marqueeMessage = decodeHtmlString(server.arg("marqueeMsg"));
   timeDisplayTurnsOn = decodeHtmlString(server.arg("startTime"));
   timeDisplayTurnsOff = decodeHtmlString(server.arg("endTime"));
@@ -601,9 +972,18 @@ void handleLocations() {
   temp = server.arg("stationpassword");
   temp.toCharArray(www_password, sizeof(temp));
   weatherClient.setMetric(IS_METRIC);
+  weatherClient.setTls(WEATHER_USE_TLS, WEATHER_FINGERPRINT);
+  TimeDB.setTls(TIMEDB_USE_TLS, TIMEDB_FINGERPRINT);
+  TimeDB.setTimeZoneRule(TIMEZONE_RULE);
+  sntpClock.setServer(NTP_ENABLED ? NTP_SERVER : "");
   matrix.fillScreen(LOW); // show black
   writeCityIds();
-  getWeatherData(); // this will force a data pull for new weather
+  timeDbTriedAt = 0; // try a new TimeZoneDB key straight away
+  if (previousRequest != TIMEDBKEY + APIKEY + getCityIdList()) {
+    getWeatherData(); // this will force a data pull for new weather
+  } else {
+    scheduler.makeDue(scheduleWeather); // units are applied on display -- just show the weather again
+  }
   redirectHome();
 }
 
@@ -630,6 +1010,43 @@ void handleForgetWifi() {
   ESP.restart();
 }
 
+// Every config page streams its form -- the heap each one took is logged,
+// and the worst is shown on the home page
+void endPage(PageTemplate &page, const char *name) {
+  page.flush();
+  uint32_t used = page.getHeapUsed();
+  Serial.println("Page " + String(name) + ": heap peak " + String(used) + " bytes");
+  if (used >= pageHeapPeak) {
+    pageHeapPeak = used;
+    pageHeapPeakName = name;
+  }
+}
+
+// <label> and a text input for the setting name<number> -- numeric ones only take digits
+void printInput(PageTemplate &page, const __FlashStringHelper *label, const __FlashStringHelper *name, int number,
+                const String &value, int maxLength, boolean numeric) {
+  page.print(F("<label>"));
+  page.print(label);
+  page.print(F("</label><input class='w3-input w3-border w3-margin-bottom' type='text' name='"));
+  page.print(name);
+  page.print(number);
+  page.print(F("' value='"));
+  page.printAttribute(value);
+  page.print(F("' maxlength='"));
+  page.print(maxLength);
+  page.print(numeric ? F("' onkeypress='return isNumberKey(event)'>") : F("'>"));
+}
+
+void writeWideClockOptions(PageTemplate &page) {
+  page.printOption("1", "HH:MM Temperature", Wide_Clock_Style == "1");
+  page.printOption("2", "HH:MM:SS", Wide_Clock_Style == "2");
+  page.printOption("3", "HH:MM", Wide_Clock_Style == "3");
+}
+
+static const PageToken WIDECLOCK_TOKENS[] PROGMEM = {
+  { "WIDECLOCKOPTIONS", writeWideClockOptions }
+};
+
 void handleWideClockConfigure() {
   if (!athentication()) {
     return server.requestAuthentication();
@@ -646,11 +1063,9 @@ void handleWideClockConfigure() {
 
   if (numberOfHorizontalDisplays >= 8) {
     // Wide display options
-    String form = FPSTR(WIDECLOCK_FORM);
-    String clockOptions = "<option value='1'>HH:MM Temperature</option><option value='2'>HH:MM:SS</option><option value='3'>HH:MM</option>";
-    clockOptions.replace(Wide_Clock_Style + "'", Wide_Clock_Style + "' selected");
-    form.replace("%WIDECLOCKOPTIONS%", clockOptions);
-    server.sendContent(form);
+    PageTemplate page(server);
+    page.render(WIDECLOCK_FORM, WIDECLOCK_TOKENS, arr_len(WIDECLOCK_TOKENS));
+    endPage(page, "/configurewideclock");
   }
 
   sendFooter();
@@ -660,6 +1075,39 @@ void handleWideClockConfigure() {
   digitalWrite(externalLight, HIGH);
 }
 
+void writeNewsChecked(PageTemplate &page) {
+  page.printChecked(NEWS_ENABLED);
+}
+
+void writeNewsKey(PageTemplate &page) {
+  page.printAttribute(NEWS_API_KEY);
+}
+
+void writeNewsTlsChecked(PageTemplate &page) {
+  page.printChecked(NEWS_USE_TLS);
+}
+
+void writeNewsSource(PageTemplate &page) {
+  page.printAttribute(NEWS_SOURCE);
+}
+
+// The feeds are kept space separated and edited one per line
+void writeNewsRssUrl(PageTemplate &page) {
+  char one[2] = { '\0', '\0' };
+  for (unsigned int inx = 0; inx < NEWS_RSS_URL.length(); inx++) {
+    one[0] = NEWS_RSS_URL[inx] == ' ' ? '\n' : NEWS_RSS_URL[inx];
+    page.printAttribute(one);
+  }
+}
+
+static const PageToken NEWS_TOKENS[] PROGMEM = {
+  { "NEWSCHECKED", writeNewsChecked },
+  { "NEWSKEY", writeNewsKey },
+  { "NEWSTLSCHECKED", writeNewsTlsChecked },
+  { "NEWSSOURCE", writeNewsSource },
+  { "NEWSRSSURL", writeNewsRssUrl }
+};
+
 void handleNewsConfigure() {
   if (!athentication()) {
     return server.requestAuthentication();
@@ -674,15 +1122,9 @@ void handleNewsConfigure() {
 
   sendHeader();
 
-  String form = FPSTR(NEWS_FORM1);
-  String isNewsDisplayedChecked = "";
-  if (NEWS_ENABLED) {
-    isNewsDisplayedChecked = "checked='checked'";
-  }
-  form.replace("%NEWSCHECKED%", isNewsDisplayedChecked);
-  form.replace("%NEWSKEY%", NEWS_API_KEY);
-  form.replace("%NEWSSOURCE%", NEWS_SOURCE);
-  server.sendContent(form); //Send news form
+  PageTemplate page(server);
+  page.render(NEWS_FORM1, NEWS_TOKENS, arr_len(NEWS_TOKENS)); //Send news form
+  endPage(page, "/configurenews");
 
   sendFooter();
 
@@ -691,6 +1133,61 @@ void handleNewsConfigure() {
   digitalWrite(externalLight, HIGH);
 }
 
+void writeOctoChecked(PageTemplate &page) {
+  page.printChecked(OCTOPRINT_ENABLED);
+}
+
+void writeOctoProgressChecked(PageTemplate &page) {
+  page.printChecked(OCTOPRINT_PROGRESS);
+}
+
+void writeOctoPushChecked(PageTemplate &page) {
+  page.printChecked(OCTOPRINT_PUSH);
+}
+
+void writeOctoKey(PageTemplate &page) {
+  page.printAttribute(OctoPrintApiKey[0]);
+}
+
+void writeOctoAddress(PageTemplate &page) {
+  page.printAttribute(OctoPrintServer[0]);
+}
+
+void writeOctoPort(PageTemplate &page) {
+  page.print(OctoPrintPort[0]);
+}
+
+void writeOctoUser(PageTemplate &page) {
+  page.printAttribute(OctoAuthUser);
+}
+
+void writeOctoPass(PageTemplate &page) {
+  page.printAttribute(OctoAuthPass);
+}
+
+void writeOctoPrinterInputs(PageTemplate &page) {
+  for (int inx = 1; inx < MAX_PRINTERS; inx++) {
+    page.print(F("<h3>Printer "));
+    page.print(inx + 1);
+    page.print(F(" (optional, polled only)</h3>"));
+    printInput(page, F("API Key"), F("octoPrintApiKey"), inx + 1, OctoPrintApiKey[inx], 47, false);
+    printInput(page, F("Address"), F("octoPrintAddress"), inx + 1, OctoPrintServer[inx], 47, false);
+    printInput(page, F("Port"), F("octoPrintPort"), inx + 1, String(OctoPrintPort[inx]), 5, true);
+  }
+}
+
+static const PageToken OCTO_TOKENS[] PROGMEM = {
+  { "OCTOCHECKED", writeOctoChecked },
+  { "OCTOPROGRESSCHECKED", writeOctoProgressChecked },
+  { "OCTOPUSHCHECKED", writeOctoPushChecked },
+  { "OCTOKEY", writeOctoKey },
+  { "OCTOADDRESS", writeOctoAddress },
+  { "OCTOPORT", writeOctoPort },
+  { "OCTOUSER", writeOctoUser },
+  { "OCTOPASS", writeOctoPass },
+  { "OCTOPRINTERINPUTS", writeOctoPrinterInputs }
+};
+
 void handleOctoprintConfigure() {
   if (!athentication()) {
     return server.requestAuthentication();
@@ -705,23 +1202,9 @@ void handleOctoprintConfigure() {
 
   sendHeader();
 
-  String form = FPSTR(OCTO_FORM);
-  String isOctoPrintDisplayedChecked = "";
-  if (OCTOPRINT_ENABLED) {
-    isOctoPrintDisplayedChecked = "checked='checked'";
-  }
-  form.replace("%OCTOCHECKED%", isOctoPrintDisplayedChecked);
-  String isOctoPrintProgressChecked = "";
-  if (OCTOPRINT_PROGRESS) {
-    isOctoPrintProgressChecked = "checked='checked'";
-  }
-  form.replace("%OCTOPROGRESSCHECKED%", isOctoPrintProgressChecked);
-  form.replace("%OCTOKEY%", OctoPrintApiKey);
-  form.replace("%OCTOADDRESS%", OctoPrintServer);
-  form.replace("%OCTOPORT%", String(OctoPrintPort));
-  form.replace("%OCTOUSER%", OctoAuthUser);
-  form.replace("%OCTOPASS%", OctoAuthPass);
-  server.sendContent(form);
+  PageTemplate page(server);
+  page.render(OCTO_FORM, OCTO_TOKENS, arr_len(OCTO_TOKENS));
+  endPage(page, "/configureoctoprint");
 
   sendFooter();
 
@@ -730,6 +1213,41 @@ void handleOctoprintConfigure() {
   digitalWrite(externalLight, HIGH);
 }
 
+void writePiholeChecked(PageTemplate &page) {
+  page.printChecked(USE_PIHOLE);
+}
+
+void writePiholeAddress(PageTemplate &page) {
+  page.printAttribute(PiHoleServer[0]);
+}
+
+void writePiholePort(PageTemplate &page) {
+  page.print(PiHolePort[0]);
+}
+
+void writePiholeApiToken(PageTemplate &page) {
+  page.printAttribute(PiHoleApiKey[0]);
+}
+
+void writePiholeInputs(PageTemplate &page) {
+  for (int inx = 1; inx < MAX_PIHOLES; inx++) {
+    page.print(F("<h3>Pi-hole "));
+    page.print(inx + 1);
+    page.print(F(" (optional, stats are combined)</h3>"));
+    printInput(page, F("Address"), F("piholeAddress"), inx + 1, PiHoleServer[inx], 60, false);
+    printInput(page, F("Port"), F("piholePort"), inx + 1, String(PiHolePort[inx]), 5, true);
+    printInput(page, F("API Token"), F("piApiToken"), inx + 1, PiHoleApiKey[inx], 65, false);
+  }
+}
+
+static const PageToken PIHOLE_TOKENS[] PROGMEM = {
+  { "PIHOLECHECKED", writePiholeChecked },
+  { "PIHOLEADDRESS", writePiholeAddress },
+  { "PIHOLEPORT", writePiholePort },
+  { "PIAPITOKEN", writePiholeApiToken },
+  { "PIHOLEINPUTS", writePiholeInputs }
+};
+
 void handlePiholeConfigure() {
   if (!athentication()) {
     return server.requestAuthentication();
@@ -744,21 +1262,10 @@ void handlePiholeConfigure() {
 
   sendHeader();
 
-  server.sendContent(FPSTR(PIHOLE_TEST));
-
-  String form = FPSTR(PIHOLE_FORM);
-  String isPiholeDisplayedChecked = "";
-  if (USE_PIHOLE) {
-    isPiholeDisplayedChecked = "checked='checked'";
-  }
-  form.replace("%PIHOLECHECKED%", isPiholeDisplayedChecked);
-  form.replace("%PIHOLEADDRESS%", PiHoleServer);
-  form.replace("%PIHOLEPORT%", String(PiHolePort));
-  form.replace("%PIAPITOKEN%", PiHoleApiKey);
-
-
-  server.sendContent(form);
-  form = "";
+  PageTemplate page(server);
+  page.print_P(PIHOLE_TEST);
+  page.render(PIHOLE_FORM, PIHOLE_TOKENS, arr_len(PIHOLE_TOKENS));
+  endPage(page, "/configurepihole");
           
   sendFooter();
 
@@ -767,12 +1274,40 @@ void handlePiholeConfigure() {
   digitalWrite(externalLight, HIGH);
 }
 
-void handleConfigure() {
+void writeJsonChecked(PageTemplate &page) {
+  page.printChecked(JSON_SOURCES_ENABLED);
+}
+
+void writeJsonSourceInputs(PageTemplate &page) {
+  for (int inx = 0; inx < MAX_JSON_SOURCES; inx++) {
+    int number = inx + 1;
+    page.print(F("<h3>Source "));
+    page.print(number);
+    page.print(F("</h3>"));
+    printInput(page, F("Name"), F("jsonName"), number, JsonSourceName[inx], 15, false);
+    printInput(page, F("URL (http://host:port/path)"), F("jsonUrl"), number, JsonSourceUrl[inx], 120, false);
+    printInput(page, F("Extra Header (optional, e.g. Authorization: Bearer ...)"), F("jsonHeader"), number, JsonSourceHeader[inx], 250, false);
+    printInput(page, F("JSON Paths"), F("jsonPaths"), number, JsonSourcePaths[inx], 190, false);
+    printInput(page, F("Format"), F("jsonFormat"), number, JsonSourceFormat[inx], 80, false);
+    printInput(page, F("Refresh (minutes)"), F("jsonRefresh"), number, String(JsonSourceRefresh[inx]), 4, true);
+    if (jsonSources[inx].isConfigured()) {
+      page.print(F("<p class='w3-small'>Now showing: "));
+      page.printText(jsonSources[inx].getText()); // whatever the endpoint sent -- never markup
+      page.print(F("</p>"));
+    }
+  }
+}
+
+static const PageToken JSON_TOKENS[] PROGMEM = {
+  { "JSONCHECKED", writeJsonChecked },
+  { "JSONSOURCEINPUTS", writeJsonSourceInputs }
+};
+
+void handleJsonConfigure() {
   if (!athentication()) {
     return server.requestAuthentication();
   }
   digitalWrite(externalLight, LOW);
-  String html = "";
 
   server.sendHeader("Cache-Control", "no-cache, no-store");
   server.sendHeader("Pragma", "no-cache");
@@ -782,107 +1317,220 @@ void handleConfigure() {
 
   sendHeader();
 
-  String form = FPSTR(CHANGE_FORM1);
-  form.replace("%TIMEDBKEY%", TIMEDBKEY);
-  form.replace("%WEATHERKEY%", APIKEY);
+  PageTemplate page(server);
+  page.render(JSON_FORM, JSON_TOKENS, arr_len(JSON_TOKENS));
+  endPage(page, "/configurejson");
 
+  sendFooter();
 
-  String cityName = "";
-  if (weatherClient.getCity(0) != "") {
-    cityName = weatherClient.getCity(0) + ", " + weatherClient.getCountry(0);
-  }
-  form.replace("%CITYNAME1%", cityName);
-  form.replace("%CITY1%", String(CityIDs[0]));
-  String isDateChecked = "";
-  if (SHOW_DATE) {
-    isDateChecked = "checked='checked'";
-  }
-  form.replace("%DATE_CHECKED%", isDateChecked);
-  String isCityChecked = "";
-  if (SHOW_CITY) {
-    isCityChecked = "checked='checked'";
-  }
-  form.replace("%CITY_CHECKED%", isCityChecked);
-  String isConditionChecked = "";
-  if (SHOW_CONDITION) {
-    isConditionChecked = "checked='checked'";
-  }
-  form.replace("%CONDITION_CHECKED%", isConditionChecked);
-  String isHumidityChecked = "";
-  if (SHOW_HUMIDITY) {
-    isHumidityChecked = "checked='checked'";
-  }
-  form.replace("%HUMIDITY_CHECKED%", isHumidityChecked);
-  String isWindChecked = "";
-  if (SHOW_WIND) {
-    isWindChecked = "checked='checked'";
-  }
-  form.replace("%WIND_CHECKED%", isWindChecked);
-  String isPressureChecked = "";
-  if (SHOW_PRESSURE) {
-    isPressureChecked = "checked='checked'";
+  server.sendContent("");
+  server.client().stop();
+  digitalWrite(externalLight, HIGH);
+}
+
+void writeTimeDbKey(PageTemplate &page) {
+  page.printAttribute(TIMEDBKEY);
+}
+
+void writeWeatherKey(PageTemplate &page) {
+  page.printAttribute(APIKEY);
+}
+
+void writeTzRule(PageTemplate &page) {
+  page.printAttribute(TIMEZONE_RULE);
+}
+
+void writeNtpChecked(PageTemplate &page) {
+  page.printChecked(NTP_ENABLED);
+}
+
+void writeNtpServer(PageTemplate &page) {
+  page.printAttribute(NTP_SERVER);
+}
+
+void writeCityInputs(PageTemplate &page) {
+  for (int inx = 0; inx < MAX_CITIES; inx++) {
+    String cityName = "";
+    if (inx < weatherClient.getCityCount() && weatherClient.getCity(inx) != "") {
+      cityName = weatherClient.getCity(inx) + ", " + weatherClient.getCountry(inx);
+    }
+    page.print(F("<input class='w3-input w3-border' type='text' name='city"));
+    page.print(inx + 1);
+    page.print(F("' value='"));
+    if (CityIDs[inx] > 0) {
+      page.print(CityIDs[inx]);
+    }
+    page.print(F("' placeholder='"));
+    page.printAttribute(cityName);
+    page.print(F("' onkeypress='return isNumberKey(event)'>"));
+    if (cityName != "") {
+      page.print(F("<span class='w3-small'>"));
+      page.print(cityName);
+      page.print(F("</span>"));
+    }
   }
-  form.replace("%PRESSURE_CHECKED%", isPressureChecked);
+}
 
-  String isHighlowChecked = "";
-  if (SHOW_HIGHLOW) {
-    isHighlowChecked = "checked='checked'";
+void writeDateChecked(PageTemplate &page) {
+  page.printChecked(SHOW_DATE);
+}
+
+void writeCityChecked(PageTemplate &page) {
+  page.printChecked(SHOW_CITY);
+}
+
+void writeConditionChecked(PageTemplate &page) {
+  page.printChecked(SHOW_CONDITION);
+}
+
+void writeHumidityChecked(PageTemplate &page) {
+  page.printChecked(SHOW_HUMIDITY);
+}
+
+void writeWindChecked(PageTemplate &page) {
+  page.printChecked(SHOW_WIND);
+}
+
+void writePressureChecked(PageTemplate &page) {
+  page.printChecked(SHOW_PRESSURE);
+}
+
+void writeHighlowChecked(PageTemplate &page) {
+  page.printChecked(SHOW_HIGHLOW);
+}
+
+void writeIs24HourChecked(PageTemplate &page) {
+  page.printChecked(IS_24HOUR);
+}
+
+void writeMetricChecked(PageTemplate &page) {
+  page.printChecked(IS_METRIC);
+}
+
+void writeWeatherTlsChecked(PageTemplate &page) {
+  page.printChecked(WEATHER_USE_TLS);
+}
+
+void writeTimeDbTlsChecked(PageTemplate &page) {
+  page.printChecked(TIMEDB_USE_TLS);
+}
+
+void writeIsPmChecked(PageTemplate &page) {
+  page.printChecked(IS_PM);
+}
+
+void writeFlashSeconds(PageTemplate &page) {
+  page.printChecked(flashOnSeconds);
+}
+
+void writeMessage(PageTemplate &page) {
+  page.printAttribute(marqueeMessage);
+}
+
+void writeStartTime(PageTemplate &page) {
+  page.printAttribute(timeDisplayTurnsOn);
+}
+
+void writeEndTime(PageTemplate &page) {
+  page.printAttribute(timeDisplayTurnsOff);
+}
+
+void writeIntensity(PageTemplate &page) {
+  page.print(displayIntensity);
+}
+
+void writeScrollOptions(PageTemplate &page) {
+  page.printOption("35", "Slow", displayScrollSpeed == 35);
+  page.printOption("25", "Normal", displayScrollSpeed == 25);
+  page.printOption("15", "Fast", displayScrollSpeed == 15);
+  page.printOption("10", "Very Fast", displayScrollSpeed == 10);
+}
+
+void writeRefreshOptions(PageTemplate &page) {
+  static const int minutes[] = { 5, 10, 15, 20, 30, 60 };
+  for (unsigned int inx = 0; inx < arr_len(minutes); inx++) {
+    String value = String(minutes[inx]);
+    page.printOption(value.c_str(), value.c_str(), minutesBetweenDataRefresh == minutes[inx]);
   }
-  form.replace("%HIGHLOW_CHECKED%", isHighlowChecked);
+}
 
-  
-  String is24hourChecked = "";
-  if (IS_24HOUR) {
-    is24hourChecked = "checked='checked'";
+void writeRefreshDisplay(PageTemplate &page) {
+  page.print(minutesBetweenScrolling);
+}
+
+void writeThemeOptions(PageTemplate &page) {
+  char name[sizeof(THEME_COLORS[0].name)];
+  for (unsigned int inx = 0; inx < arr_len(THEME_COLORS); inx++) {
+    strncpy_P(name, THEME_COLORS[inx].name, sizeof(name));
+    page.printOption(name, name, themeColor == name);
   }
-  form.replace("%IS_24HOUR_CHECKED%", is24hourChecked);
-  String checked = "";
-  if (IS_METRIC) {
-    checked = "checked='checked'";
-  }
-  form.replace("%CHECKED%", checked);
-  server.sendContent(form);
-
-  form = FPSTR(CHANGE_FORM2);
-  String isPmChecked = "";
-  if (IS_PM) {
-    isPmChecked = "checked='checked'";
-  }
-  form.replace("%IS_PM_CHECKED%", isPmChecked);
-  String isFlashSecondsChecked = "";
-  if (flashOnSeconds) {
-    isFlashSecondsChecked = "checked='checked'";
-  }
-  form.replace("%FLASHSECONDS%", isFlashSecondsChecked);
-  form.replace("%MSG%", marqueeMessage);
-  form.replace("%STARTTIME%", timeDisplayTurnsOn);
-  form.replace("%ENDTIME%", timeDisplayTurnsOff);
-  form.replace("%INTENSITYOPTIONS%", String(displayIntensity));
-  String dSpeed = String(displayScrollSpeed);
-  String scrollOptions = "<option value='35'>Slow</option><option value='25'>Normal</option><option value='15'>Fast</option><option value='10'>Very Fast</option>";
-  scrollOptions.replace(dSpeed + "'", dSpeed + "' selected" );
-  form.replace("%SCROLLOPTIONS%", scrollOptions);
-  String minutes = String(minutesBetweenDataRefresh);
-  String options = "<option>5</option><option>10</option><option>15</option><option>20</option><option>30</option><option>60</option>";
-  options.replace(">" + minutes + "<", " selected>" + minutes + "<");
-  form.replace("%OPTIONS%", options);
-  form.replace("%REFRESH_DISPLAY%", String(minutesBetweenScrolling));
-  String themeOptions = FPSTR(COLOR_THEMES);
-  themeOptions.replace(">" + String(themeColor) + "<", " selected>" + String(themeColor) + "<");
-  form.replace("%THEME_OPTIONS%", themeOptions);
-
-  server.sendContent(form); //Send another chunk of the form
-
-  form = FPSTR(CHANGE_FORM3);
-  String isUseSecurityChecked = "";
-  if (IS_BASIC_AUTH) {
-    isUseSecurityChecked = "checked='checked'";
+}
+
+void writeBasicAuthChecked(PageTemplate &page) {
+  page.printChecked(IS_BASIC_AUTH);
+}
+
+void writeUserId(PageTemplate &page) {
+  page.printAttribute(www_username);
+}
+
+void writeStationPassword(PageTemplate &page) {
+  page.printAttribute(www_password);
+}
+
+// Shared by the three parts of the form
+static const PageToken CONFIGURE_TOKENS[] PROGMEM = {
+  { "TIMEDBKEY", writeTimeDbKey },
+  { "WEATHERKEY", writeWeatherKey },
+  { "TZRULE", writeTzRule },
+  { "NTPCHECKED", writeNtpChecked },
+  { "NTPSERVER", writeNtpServer },
+  { "CITYINPUTS", writeCityInputs },
+  { "DATE_CHECKED", writeDateChecked },
+  { "CITY_CHECKED", writeCityChecked },
+  { "CONDITION_CHECKED", writeConditionChecked },
+  { "HUMIDITY_CHECKED", writeHumidityChecked },
+  { "WIND_CHECKED", writeWindChecked },
+  { "PRESSURE_CHECKED", writePressureChecked },
+  { "HIGHLOW_CHECKED", writeHighlowChecked },
+  { "IS_24HOUR_CHECKED", writeIs24HourChecked },
+  { "CHECKED", writeMetricChecked },
+  { "WEATHERTLSCHECKED", writeWeatherTlsChecked },
+  { "TIMEDBTLSCHECKED", writeTimeDbTlsChecked },
+  { "IS_PM_CHECKED", writeIsPmChecked },
+  { "FLASHSECONDS", writeFlashSeconds },
+  { "MSG", writeMessage },
+  { "STARTTIME", writeStartTime },
+  { "ENDTIME", writeEndTime },
+  { "INTENSITYOPTIONS", writeIntensity },
+  { "SCROLLOPTIONS", writeScrollOptions },
+  { "OPTIONS", writeRefreshOptions },
+  { "REFRESH_DISPLAY", writeRefreshDisplay },
+  { "THEME_OPTIONS", writeThemeOptions },
+  { "IS_BASICAUTH_CHECKED", writeBasicAuthChecked },
+  { "USERID", writeUserId },
+  { "STATIONPASSWORD", writeStationPassword }
+};
+
+void handleConfigure() {
+  if (!athentication()) {
+    return server.requestAuthentication();
   }
-  form.replace("%IS_BASICAUTH_CHECKED%", isUseSecurityChecked);
-  form.replace("%USERID%", String(www_username));
-  form.replace("%STATIONPASSWORD%", String(www_password));
+  digitalWrite(externalLight, LOW);
+
+  server.sendHeader("Cache-Control", "no-cache, no-store");
+  server.sendHeader("Pragma", "no-cache");
+  server.sendHeader("Expires", "-1");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/html", "");
+
+  sendHeader();
 
-  server.sendContent(form); // Send the second chunk of Data
+  PageTemplate page(server);
+  page.render(CHANGE_FORM1, CONFIGURE_TOKENS, arr_len(CONFIGURE_TOKENS));
+  page.render(CHANGE_FORM2, CONFIGURE_TOKENS, arr_len(CONFIGURE_TOKENS));
+  page.render(CHANGE_FORM3, CONFIGURE_TOKENS, arr_len(CONFIGURE_TOKENS));
+  endPage(page, "/configure");
 
   sendFooter();
 
@@ -928,21 +1576,16 @@ void getWeatherData() //client function to send/receive GET request data.
     }
   }
 
-  Serial.println("Updating Time...");
-  //Update the Time
-  matrix.drawPixel(0, 4, HIGH);
-  matrix.drawPixel(0, 3, HIGH);
-  matrix.drawPixel(0, 2, HIGH);
-  Serial.println("matrix Width:" + matrix.width());
-  matrix.write();
-  TimeDB.updateConfig(TIMEDBKEY, weatherClient.getLat(0), weatherClient.getLon(0));
-  time_t currentTime = TimeDB.getTime();
-  if(currentTime > 5000 || firstEpoch == 0) {
-    setTime(currentTime);
-  } else {
-    Serial.println("Time update unsuccessful!");
+  if (weatherClient.getCityCount() > 0 && (weatherClient.getLat(0) != timeDbLat || weatherClient.getLon(0) != timeDbLon)) {
+    // a new first city -- keep its position and ask TimeZoneDB about it now
+    timeDbLat = weatherClient.getLat(0);
+    timeDbLon = weatherClient.getLon(0);
+    timeDbTriedAt = 0;
+    writeCityIds();
+    updateTimeZone();
   }
-  lastEpoch = now();
+  syncLocalTime();
+  lastEpoch = TimeDB.getUtc();
   if (firstEpoch == 0) {
     firstEpoch = now();
     Serial.println("firstEpoch is: " + String(firstEpoch));
@@ -953,8 +1596,7 @@ void getWeatherData() //client function to send/receive GET request data.
     matrix.drawPixel(0, 1, HIGH);
     matrix.drawPixel(0, 0, HIGH);
     matrix.write();
-    Serial.println("Getting News Data for " + NEWS_SOURCE);
-    newsClient.updateNews();
+    updateNews();
   }
 
   Serial.println("Version: " + String(VERSION));
@@ -979,6 +1621,51 @@ void displayMessage(String message) {
   digitalWrite(externalLight, HIGH);
 }
 
+// The stylesheet, script and news sources are built into the firmware, gzipped
+// (see tools/make_web_assets.py). Pages link them with their tag in the URL,
+// so they can be cached for good -- a reload only costs a 304.
+void handleWebAsset() {
+  const WebAsset *asset = nullptr;
+  for (int inx = 0; inx < WEB_ASSET_COUNT; inx++) {
+    if (strcmp_P(server.uri().c_str(), WEB_ASSETS[inx].path) == 0) {
+      asset = &WEB_ASSETS[inx];
+    }
+  }
+  if (asset == nullptr) {
+    redirectHome();
+    return;
+  }
+  assetRequests++;
+  String etag = "\"" + String(FPSTR(asset->tag)) + "\"";
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", "public, max-age=31536000");
+  if (server.header("If-None-Match") == etag) {
+    assetNotModified++;
+    server.send(304);
+    return;
+  }
+  uint32_t length = pgm_read_dword(&asset->length);
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset->type, (PGM_P) pgm_read_ptr(&asset->data), length);
+  assetBytes += length;
+}
+
+// Colors of the chosen theme for the stylesheet -- blue-grey if it isn't known
+String getThemeStyle() {
+  int found = 0;
+  for (unsigned int inx = 0; inx < arr_len(THEME_COLORS); inx++) {
+    if (strcmp_P(themeColor.c_str(), THEME_COLORS[inx].name) == 0) {
+      found = inx;
+      break;
+    }
+    if (strcmp_P("blue-grey", THEME_COLORS[inx].name) == 0) {
+      found = inx;
+    }
+  }
+  const ThemeColor &theme = THEME_COLORS[found];
+  return "--t:" + String(FPSTR(theme.color)) + ";--d:" + String(FPSTR(theme.dark)) + ";--tc:" + String(FPSTR(theme.text));
+}
+
 void redirectHome() {
   // Send them back to the Root Directory
   server.sendHeader("Location", String("/"), true);
@@ -991,19 +1678,20 @@ void redirectHome() {
 }
 
 void sendHeader() {
+  pageStarted = millis();
   String html = "<!DOCTYPE HTML>";
   html += "<html><head><title>Marquee Scroller</title><link rel='icon' href='data:;base64,='>";
   html += "<meta http-equiv='Content-Type' content='text/html; charset=UTF-8' />";
   html += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
-  html += "<link rel='stylesheet' href='https://www.w3schools.com/w3css/4/w3.css'>";
-  html += "<link rel='stylesheet' href='https://www.w3schools.com/lib/w3-theme-" + themeColor + ".css'>";
-  html += "<link rel='stylesheet' href='https://cdnjs.cloudflare.com/ajax/libs/font-awesome/5.8.1/css/all.min.css'>";
+  html += "<link rel='stylesheet' href='/app.css?v=" WEB_APP_CSS_TAG "'>";
+  html += "<style>:root{" + getThemeStyle() + "}</style>";
+  html += "<script src='/app.js?v=" WEB_APP_JS_TAG "'></script>";
   html += "</head><body>";
   server.sendContent(html);
   html = "<nav class='w3-sidebar w3-bar-block w3-card' style='margin-top:88px' id='mySidebar'>";
   html += "<div class='w3-container w3-theme-d2'>";
   html += "<span onclick='closeSidebar()' class='w3-button w3-display-topright w3-large'><i class='fas fa-times'></i></span>";
-  html += "<div class='w3-left'><img src='http://openweathermap.org/img/w/" + weatherClient.getIcon(0) + ".png' alt='" + weatherClient.getDescription(0) + "'></div>";
+  html += "<div class='w3-left'>" + getWeatherIconHtml(0) + "</div>";
   html += "<div class='w3-padding'>Menu</div></div>";
   server.sendContent(html);
 
@@ -1022,9 +1710,7 @@ void sendHeader() {
 
   html = "</nav>";
   html += "<header class='w3-top w3-bar w3-theme'><button class='w3-bar-item w3-button w3-xxxlarge w3-hover-theme' onclick='openSidebar()'><i class='fas fa-bars'></i></button><h2 class='w3-bar-item'>Weather Marquee</h2></header>";
-  html += "<script>";
-  html += "function openSidebar(){document.getElementById('mySidebar').style.display='block'}function closeSidebar(){document.getElementById('mySidebar').style.display='none'}closeSidebar();";
-  html += "</script>";
+  html += "<script>closeSidebar();</script>";
   html += "<br><div class='w3-container w3-large' style='margin-top:88px'>";
   server.sendContent(html);
 }
@@ -1044,6 +1730,7 @@ void sendFooter() {
   html += "</footer>";
   html += "</body></html>";
   server.sendContent(html);
+  Serial.println("Page " + server.uri() + " served in " + String(millis() - pageStarted) + " ms");
 }
 
 void displayWeatherData() {
@@ -1083,7 +1770,7 @@ void displayWeatherData() {
   } else {
     html += "<div class='w3-cell-row' style='width:100%'><h2>" + weatherClient.getCity(0) + ", " + weatherClient.getCountry(0) + "</h2></div><div class='w3-cell-row'>";
     html += "<div class='w3-cell w3-left w3-medium' style='width:120px'>";
-    html += "<img src='http://openweathermap.org/img/w/" + weatherClient.getIcon(0) + ".png' alt='" + weatherClient.getDescription(0) + "'><br>";
+    html += getWeatherIconHtml(0) + "<br>";
     html += weatherClient.getHumidity(0) + "% Humidity<br>";
     html += weatherClient.getDirectionText(0) + " / " + weatherClient.getWind(0) + " <span class='w3-tiny'>" + getSpeedSymbol() + "</span> Wind<br>";
     html += weatherClient.getPressure(0) + " Pressure<br>";
@@ -1095,6 +1782,13 @@ void displayWeatherData() {
     html += time + "<br>";
     html += "<a href='https://www.google.com/maps/@" + weatherClient.getLat(0) + "," + weatherClient.getLon(0) + ",10000m/data=!3m1!1e3' target='_BLANK'><i class='fas fa-map-marker' style='color:red'></i> Map It!</a><br>";
     html += "</p></div></div><hr>";
+    if (weatherClient.getCityCount() > 1) {
+      html += "<div class='w3-cell-row'>";
+      for (int inx = 1; inx < weatherClient.getCityCount(); inx++) {
+        html += getWeatherIconHtml(inx) + " <b>" + weatherClient.getCity(inx) + ", " + weatherClient.getCountry(inx) + "</b> " + weatherClient.getTempRounded(inx) + " " + getTempSymbol(true) + ", " + weatherClient.getDescription(inx) + "<br>";
+      }
+      html += "</div><hr>";
+    }
   }
 
 
@@ -1103,32 +1797,14 @@ void displayWeatherData() {
 
 
   if (OCTOPRINT_ENABLED) {
-    html = "<div class='w3-cell-row'><b>OctoPrint Status:</b> ";
-    if (printerClient.isPrinting()) {
-      int val = printerClient.getProgressPrintTimeLeft().toInt();
-      int hours = numberOfHours(val);
-      int minutes = numberOfMinutes(val);
-      int seconds = numberOfSeconds(val);
-      html += "Online and Printing</br>Est. Print Time Left: " + zeroPad(hours) + ":" + zeroPad(minutes) + ":" + zeroPad(seconds) + "<br>";
-    
-      val = printerClient.getProgressPrintTime().toInt();
-      hours = numberOfHours(val);
-      minutes = numberOfMinutes(val);
-      seconds = numberOfSeconds(val);
-      html += "Printing Time: " + zeroPad(hours) + ":" + zeroPad(minutes) + ":" + zeroPad(seconds) + "<br>";
-      html += printerClient.getState() + " " + printerClient.getFileName() + "</br>";
-      html += "<style>#myProgress {width: 100%;background-color: #ddd;}#myBar {width: " + printerClient.getProgressCompletion() + "%;height: 30px;background-color: #4CAF50;}</style>";
-      html += "<div id=\"myProgress\"><div id=\"myBar\" class=\"w3-medium w3-center\">" + printerClient.getProgressCompletion() + "%</div></div>";
-    } else if (printerClient.isOperational()) {
-      html += printerClient.getState();
-    } else if (printerClient.getError() != "") {
-      html += printerClient.getError();
-    } else {
-      html += "Not Connected";
+    for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+      if (inx == 0 || printerClient.isConfigured(inx)) {
+        server.sendContent(getPrinterHtml(inx));
+      }
+    }
+    if (printerClient.getPrintingCount() > 0) {
+      server.sendContent(FPSTR(ETA_COUNTDOWN));
     }
-    html += "</div><br><hr>";
-    server.sendContent(String(html));
-    html = "";
   }
 
   if (USE_PIHOLE) {
@@ -1138,8 +1814,11 @@ void displayWeatherData() {
              "Queries Blocked: <b>" + piholeClient.getAdsBlockedToday() + "</b><br>"
              "Percent Blocked: <b>" + piholeClient.getAdsPercentageToday() + "%</b><br>"
              "Domains on Blocklist: <b>" + piholeClient.getDomainsBeingBlocked() + "</b><br>"
-             "Status: <b>" + piholeClient.getPiHoleStatus() + "</b><br>"
-             "</div><br><hr>";
+             "Status: <b>" + piholeClient.getPiHoleStatus() + "</b>";
+      if (piholeClient.getInstanceCount() > 1) {
+        html += " (" + String(piholeClient.getAnsweringCount()) + "/" + String(piholeClient.getInstanceCount()) + " answering)";
+      }
+      html += "<br></div><br><hr>";
     } else {
       html = "<div class='w3-cell-row'>Pi-hole Error";
       html += "Please <a href='/configurepihole' title='Configure'>Configure</a> for Pi-hole <a href='/configurepihole' title='Configure'><i class='fas fa-cog'></i></a><br>";
@@ -1150,16 +1829,124 @@ void displayWeatherData() {
     html = "";
   }
 
+  html = "<div class='w3-cell-row'><b>Data Sources</b><br>";
+  if (OCTOPRINT_ENABLED) {
+    for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+      if (printerClient.isConfigured(inx)) {
+        html += getSourceHealthHtml(printerClient.getHealth(inx));
+        if (printerClient.getSecondsSinceProgressChange(inx) >= 0) {
+          html += printerClient.getServer(inx) + " progress last changed " + String(printerClient.getSecondsSinceProgressChange(inx)) + "s ago, next poll in "
+                  + String(printerClient.getSecondsToNextPoll(inx)) + "s";
+          if (printerClient.getEstimateSamples(inx) > 0) {
+            html += ", local estimate off by " + String(printerClient.getEstimateError(inx), 2) + "% on average";
+          }
+          html += "<br>";
+        }
+      }
+    }
+    if (printerClient.getPrinterCount() > 1) {
+      html += "OctoPrint last poll round: <b>" + String(printerClient.getLastBatchMillis()) + " ms</b> (" + String(PRINTER_PIPELINE) + " requests at a time)<br>";
+    }
+    if (OCTOPRINT_PUSH) {
+      html += "OctoPrint Push: <b>" + String(printerClient.isPushActive() ? "Live" : "Polling") + "</b> (" + String(printerClient.getPushMessages()) + " messages, "
+              + String(printerClient.getPushBytesPerMinute()) + " bytes/min)<br>";
+    }
+  }
+  if (USE_PIHOLE) {
+    for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+      if (PiHoleServer[inx] != "") {
+        html += getSourceHealthHtml(piholeClient.getHealth(inx));
+      }
+    }
+  }
+  if (JSON_SOURCES_ENABLED) {
+    for (int inx = 0; inx < MAX_JSON_SOURCES; inx++) {
+      if (jsonSources[inx].isConfigured()) {
+        html += getSourceHealthHtml(jsonSources[inx].getHealth());
+        html += jsonSources[inx].getName() + ": " + String(jsonSources[inx].getFoundCount()) + "/" + String(jsonSources[inx].getPathCount()) + " paths from "
+                + String(jsonSources[inx].getLastBytes()) + " bytes, parsed in <b>" + String(jsonSources[inx].getLastParseMicros()) + " us</b>";
+        if (jsonSources[inx].getError() != "") {
+          html += " (" + jsonSources[inx].getError() + ")";
+        }
+        html += "<br>";
+      }
+    }
+  }
+  if (messageQueue.getReceived() > 0) {
+    html += "Messages: " + String(messageQueue.getCount()) + " queued, " + String(messageQueue.getReceived()) + " received, "
+            + String(messageQueue.getDropped()) + " dropped, " + String(messageQueue.getExpired()) + " expired; "
+            "enqueue to first pixel last <b>" + String(messageQueue.getLastLatencyMs()) + " ms</b>, avg " + String(messageQueue.getAverageLatencyMs())
+            + " ms, max " + String(messageQueue.getMaxLatencyMs()) + " ms<br>";
+  }
+  html += getClockHtml();
+  html += "DNS Cache: <b>" + String(dnsCache.getHitRate()) + "%</b> hits (" + String(dnsCache.getHits()) + "/" + String(dnsCache.getHits() + dnsCache.getMisses()) + "), "
+          "lookup avg " + String(dnsCache.getAverageLookupMs()) + " ms / max " + String(dnsCache.getMaxLookupMs()) + " ms, "
+          + String(dnsCache.getStaleServed()) + " stale, " + String(dnsCache.getFailures()) + " failed<br>";
+  html += "JSON parse peak: " + getJsonBudgetHtml(weatherClient.getJsonBudget()) + ", " + getJsonBudgetHtml(TimeDB.getJsonBudget());
+  if (OCTOPRINT_ENABLED) {
+    html += ", " + getJsonBudgetHtml(printerClient.getJsonBudget());
+  }
+  if (USE_PIHOLE) {
+    html += ", " + getJsonBudgetHtml(piholeClient.getJsonBudget());
+  }
+  html += "<br>";
+  if (WEATHER_USE_TLS) {
+    html += getTlsHtml(weatherClient.getTls());
+  }
+  if (TIMEDB_USE_TLS) {
+    html += getTlsHtml(TimeDB.getTls());
+  }
+  if (NEWS_ENABLED && NEWS_USE_TLS && NEWS_API_KEY != "") {
+    html += getTlsHtml(newsClient.getTls());
+  }
+  for (int inx = 0; NEWS_ENABLED && inx < rssClient.getFeedCount(); inx++) {
+    if (rssClient.getTls(inx).getHandshakes() > 0 || rssClient.getTls(inx).getRefused() > 0) {
+      html += getTlsHtml(rssClient.getTls(inx));
+    }
+  }
+  if (NEWS_ENABLED && rssClient.isConfigured()) {
+    html += "RSS: <b>" + String(rssClient.getLastBytes()) + " bytes</b> in " + String(rssClient.getLastMillis()) + " ms ("
+            + String(rssClient.getBytesPerSecond()) + " bytes/s, parsed in " + String(rssClient.getLastParseMicros() / 1000) + " ms)"
+            + (rssClient.wasStoppedEarly() ? ", rest of a feed skipped" : "");
+    if (rssClient.getError() != "") {
+      html += " -- " + rssClient.getError();
+    }
+    html += "<br>";
+  }
+  if (NEWS_ENABLED) {
+    html += "News: " + String(headlines.getCount()) + " headlines (" + String(headlines.getTitlesOnly()) + " trimmed to the title) in "
+            + String(headlines.getBytesUsed()) + "/" + String(HEADLINE_ARENA_BYTES) + " bytes, " + String(headlines.getDuplicates()) + " repeats dropped<br>";
+  }
+  html += "Ticker: " + String(ticker.length()) + " characters from " + String(ticker.getSegmentCount()) + " segments, heap peak "
+          + String(tickerHeapPeak) + " bytes while scrolling<br>";
+  html += "Web assets: " + String(assetRequests) + " requests, " + String(assetNotModified) + " answered from the browser cache (304), "
+          + String(assetBytes) + " bytes sent<br>";
+  if (pageHeapPeakName[0] != '\0') {
+    html += "Config pages: heap peak " + String(pageHeapPeak) + " bytes (" + String(pageHeapPeakName) + ")<br>";
+  }
+  html += "JSON Arena: high water <b>" + String(jsonArena.getHighWater()) + "</b>/" + String(jsonArena.getCapacity()) + " bytes, "
+          + String(jsonArena.getResets()) + " resets, " + String(jsonArena.getFailures()) + " full<br>";
+  html += "</div><br><hr>";
+  server.sendContent(html);
+  html = "";
+
   if (NEWS_ENABLED) {
-    html = "<div class='w3-cell-row' style='width:100%'><h2>News (" + NEWS_SOURCE + ")</h2></div>";
-    if (newsClient.getTitle(0) == "") {
+    html = "<div class='w3-cell-row' style='width:100%'><h2>News (" + getNewsSourceName() + ")</h2></div>";
+    if (headlines.getCount() == 0) {
       html += "<p>Please <a href='/configurenews'>Configure News</a> API</p>";
       server.sendContent(html);
       html = "";
     } else {
-      for (int inx = 0; inx < 10; inx++) {
-        html = "<div class='w3-cell-row'><a href='" + newsClient.getUrl(inx) + "' target='_BLANK'>" + newsClient.getTitle(inx) + "</a></div>";
-        html += newsClient.getDescription(inx) + "<br/><br/>";
+      for (int inx = 0; inx < headlines.getCount(); inx++) {
+        // feed text arrives with its entities decoded -- it goes back out escaped, and only web links are linked
+        String url = headlines.getUrl(inx);
+        String title = htmlEscape(headlines.getTitle(inx));
+        if (!url.startsWith("http://") && !url.startsWith("https://")) {
+          html = "<div class='w3-cell-row'>" + title + "</div>";
+        } else {
+          html = "<div class='w3-cell-row'><a href='" + htmlEscape(url) + "' target='_BLANK'>" + title + "</a></div>";
+        }
+        html += htmlEscape(headlines.getDescription(inx)) + "<br/><br/>";
         server.sendContent(html);
         html = "";
       }
@@ -1172,6 +1959,55 @@ void displayWeatherData() {
   digitalWrite(externalLight, HIGH);
 }
 
+String getSourceHealthHtml(SourceHealth &health) {
+  String html = String(health.getName()) + ": <b>" + health.getStateText() + "</b>";
+  if (health.getState() == SourceHealth::OPEN) {
+    html += " (" + String(health.getFailureCount()) + " failures, next probe in " + String(health.getSecondsToNextProbe()) + "s)";
+  }
+  return html + "<br>";
+}
+
+// & < > " ' escaped -- good for text and for attribute values in '...'
+String htmlEscape(const String &text) {
+  String escaped;
+  escaped.reserve(text.length() + 16);
+  for (unsigned int inx = 0; inx < text.length(); inx++) {
+    char c = text.charAt(inx);
+    switch (c) {
+      case '&': escaped += "&amp;"; break;
+      case '<': escaped += "&lt;"; break;
+      case '>': escaped += "&gt;"; break;
+      case '"': escaped += "&quot;"; break;
+      case '\'': escaped += "&#39;"; break;
+      default: escaped += c;
+    }
+  }
+  return escaped;
+}
+
+// From the bundled stylesheet, so the pages load without the internet
+String getWeatherIconHtml(int index) {
+  return "<i class='wi wi-" + weatherClient.getIcon(index) + "' title='" + weatherClient.getDescription(index) + "'></i>";
+}
+
+String getTlsHtml(TlsSession &tls) {
+  String html = String(tls.getName()) + " HTTPS: " + String(tls.getHandshakes()) + " connections, <b>"
+                + String(tls.getResumptionRate()) + "%</b> resumed, handshake last " + String(tls.getLastHandshakeMs()) + " ms / avg " + String(tls.getAverageHandshakeMs()) + " ms, "
+                + "heap peak " + String(tls.getPeakHeapUse()) + " bytes, rx buffer " + String(tls.getRxBufferSize());
+  if (tls.getLastError() != "") {
+    html += " -- <span class='w3-text-red'>" + tls.getLastError() + "</span>";
+  }
+  return html + "<br>";
+}
+
+String getJsonBudgetHtml(JsonBudget &budget) {
+  String html = String(budget.getName()) + " <b>" + String(budget.getPeak()) + "</b>/" + String(budget.getCeiling()) + " bytes";
+  if (budget.getOverruns() > 0) {
+    html += " (" + String(budget.getOverruns()) + " over budget)";
+  }
+  return html;
+}
+
 void configModeCallback (WiFiManager *myWiFiManager) {
   Serial.println("Entered config mode");
   Serial.println(WiFi.softAPIP());
@@ -1213,6 +2049,45 @@ String getTempSymbol(bool forWeb) {
 }
 
 
+// Weather part of the ticker, formatted straight from the numeric values
+// into the caller's buffer (units follow IS_METRIC at the time of display)
+void formatWeatherLine(int index, char *buf, size_t size) {
+  const char tempSymbol[] = { (char)247, IS_METRIC ? 'C' : 'F', '\0' };
+  size_t len = 0;
+  buf[0] = '\0';
+  if (SHOW_CITY) {
+    len += snprintf(buf + len, size - len, "%s  ", weatherClient.getCityName(index));
+  }
+  if (len < size) {
+    len += snprintf(buf + len, size - len, "%ld%s  ", lroundf(weatherClient.getTempValue(index)), tempSymbol);
+  }
+  //show high/low temperature
+  if (SHOW_HIGHLOW && len < size) {
+    len += snprintf(buf + len, size - len, "High/Low:%ld/%ld %s  ", lroundf(weatherClient.getHighValue(index)), lroundf(weatherClient.getLowValue(index)), tempSymbol);
+  }
+  if (SHOW_CONDITION && len < size) {
+    size_t start = len;
+    len += snprintf(buf + len, size - len, "%s  ", weatherClient.getDescriptionText(index));
+    for (size_t inx = start; inx < len && inx < size; inx++) {
+      buf[inx] = toupper(buf[inx]);
+    }
+  }
+  if (SHOW_HUMIDITY && len < size) {
+    len += snprintf(buf + len, size - len, "Humidity:%d%%  ", weatherClient.getHumidityValue(index));
+  }
+  if (SHOW_WIND && len < size) {
+    len += snprintf(buf + len, size - len, "Wind: %s @ %ld %s  ", weatherClient.getDirectionAbbrev(index), lroundf(weatherClient.getWindValue(index)), IS_METRIC ? "kph" : "mph");
+  }
+  //line to show barometric pressure
+  if (SHOW_PRESSURE && len < size) {
+    if (IS_METRIC) {
+      snprintf(buf + len, size - len, "Pressure:%.0fmb  ", weatherClient.getPressureValue(index));
+    } else {
+      snprintf(buf + len, size - len, "Pressure:%.2f  ", weatherClient.getPressureValue(index));
+    }
+  }
+}
+
 String getSpeedSymbol() {
   String rtnValue = "mph";
   if (IS_METRIC) {
@@ -1243,10 +2118,134 @@ int8_t getWifiQuality() {
   }
 }
 
+// Every configured source adds to one set of headlines -- repeats are dropped, newest first
+void updateNews() {
+  headlines.clear();
+  if (rssClient.isConfigured()) {
+    rssClient.updateNews();
+  }
+  if (NEWS_API_KEY != "" || !rssClient.isConfigured()) {
+    Serial.println("Getting News Data for " + NEWS_SOURCE);
+    newsClient.updateNews();
+  }
+  Serial.println("News: " + String(headlines.getCount()) + " headlines, " + String(headlines.getDuplicates()) + " repeats dropped so far");
+}
+
+// Ticker segments -- each writes its part when it scrolls into view
+void formatDateSegment(int arg, char *buf, size_t size) {
+  snprintf(buf, size, "%s, %s %d  ", TimeDB.getDayName().c_str(), TimeDB.getMonthName().c_str(), day());
+}
+
+void formatMessageSegment(int arg, char *buf, size_t size) {
+  snprintf(buf, size, "%s ", marqueeMessage.c_str());
+}
+
+void formatNewsSegment(int index, char *buf, size_t size) {
+  size_t len = snprintf(buf, size, "  %s: ", getNewsSourceName().c_str());
+  if (len < size) {
+    len += headlines.getTitle(index, buf + len, size - len);
+  }
+  strlcat(buf, "  ", size);
+}
+
+void formatPrinterSegment(int index, char *buf, size_t size) {
+  int timeLeft = printerClient.getProgressPrintTimeLeft(index).toInt();
+  size_t len = snprintf(buf, size, "  %s (%s%%", printerClient.getFileName(index).c_str(), printerClient.getProgressCompletion(index).c_str());
+  if (timeLeft > 0 && len < size) {
+    snprintf(buf + len, size - len, ", %d:%02d left", timeLeft / 3600, (int)numberOfMinutes(timeLeft));
+  }
+  strlcat(buf, ")  ", size);
+}
+
+void formatPrintDoneSegment(int printers, char *buf, size_t size) {
+  size_t len = 0;
+  buf[0] = '\0';
+  for (int inx = 0; inx < MAX_PRINTERS && len < size; inx++) {
+    if (printers & (1 << inx)) {
+      len += snprintf(buf + len, size - len, "  Print done: %s  ", printerClient.getFileName(inx).c_str());
+    }
+  }
+}
+
+void formatPiholeSegment(int arg, char *buf, size_t size) {
+  snprintf(buf, size, "    Pi-hole (%s): %s%% ", piholeClient.getPiHoleStatus().c_str(), piholeClient.getAdsPercentageToday().c_str());
+}
+
+void formatJsonSegment(int index, char *buf, size_t size) {
+  snprintf(buf, size, "    %s ", jsonSources[index].getText().c_str());
+}
+
+String getNewsSourceName() {
+  if (!rssClient.isConfigured()) {
+    return NEWS_SOURCE;
+  }
+  if (NEWS_API_KEY != "" || NEWS_RSS_URL.indexOf(' ') > 0) {
+    return "News"; // more than one source
+  }
+  return rssClient.getFeedTitle() != "" ? rssClient.getFeedTitle() : "News";
+}
+
+String getPrinterHtml(int index) {
+  String html = "<div class='w3-cell-row'><b>OctoPrint Status:</b> ";
+  if (printerClient.getPrinterCount() > 1) {
+    html = "<div class='w3-cell-row'><b>OctoPrint " + printerClient.getServer(index) + ":</b> ";
+  }
+  if (printerClient.isPrinting(index)) {
+    int val = printerClient.getProgressPrintTimeLeft(index).toInt();
+    int hours = numberOfHours(val);
+    int minutes = numberOfMinutes(val);
+    int seconds = numberOfSeconds(val);
+    html += "Online and Printing</br>Est. Print Time Left: <span class='eta' data-left='" + String(val) + "'>" + zeroPad(hours) + ":" + zeroPad(minutes) + ":" + zeroPad(seconds) + "</span><br>";
+  
+    val = printerClient.getProgressPrintTime(index).toInt();
+    hours = numberOfHours(val);
+    minutes = numberOfMinutes(val);
+    seconds = numberOfSeconds(val);
+    html += "Printing Time: " + zeroPad(hours) + ":" + zeroPad(minutes) + ":" + zeroPad(seconds) + "<br>";
+    html += printerClient.getState(index) + " " + printerClient.getFileName(index) + "</br>";
+    html += "<div style='width:100%;background-color:#ddd'><div class='w3-medium w3-center' style='width:" + printerClient.getProgressCompletion(index) + "%;height:30px;background-color:#4CAF50'>"
+            + printerClient.getProgressCompletion(index) + "%</div></div>";
+  } else if (printerClient.isOperational(index)) {
+    html += printerClient.getState(index);
+  } else if (printerClient.getError(index) != "") {
+    html += printerClient.getError(index);
+  } else {
+    html += "Not Connected";
+  }
+  html += "</div><br><hr>";
+  return html;
+}
+
+String getClockHtml() {
+  if (!TimeDB.isSynced()) {
+    return "Clock: <b>not synced</b><br>";
+  }
+  long offset = TimeDB.getOffset();
+  String html = "Clock: UTC" + String(offset < 0 ? "-" : "+") + String(abs(offset) / 3600) + ":" + TimeDB.zeroPad((abs(offset) % 3600) / 60);
+  html += TimeDB.isDst() ? " (DST)" : "";
+  html += TimeDB.isRuleActive() ? ", from the time zone rule" : ", from TimeZoneDB";
+  time_t change = TimeDB.getNextChange();
+  if (change != 0) {
+    time_t localChange = change + TimeDB.getOffset();
+    html += ", next change " + String(day(localChange)) + " " + monthShortStr(month(localChange)) + " " + String(year(localChange))
+            + " " + TimeDB.zeroPad(hour(localChange)) + ":" + TimeDB.zeroPad(minute(localChange));
+  }
+  if (TimeDB.getSecondsSinceUpdate() >= 0) {
+    html += ", TimeZoneDB checked " + String(TimeDB.getSecondsSinceUpdate() / 60) + " min ago";
+  }
+  html += "<br>";
+  if (NTP_ENABLED && sntpClock.isSynced()) {
+    html += "SNTP (" + sntpClock.getServer() + "): offset <b>" + String(sntpClock.getOffsetMs()) + " ms</b>, delay " + String(sntpClock.getDelayMs()) + " ms, "
+            "drift " + String(sntpClock.getDriftPpm(), 1) + " ppm, sync every " + String(sntpClock.getIntervalSeconds()) + " s, "
+            + String(sntpClock.getSyncs()) + " syncs, " + String(sntpClock.getFailures()) + " failed<br>";
+  }
+  return html;
+}
+
 String getTimeTillUpdate() {
   String rtnValue = "";
 
-  long timeToUpdate = (((minutesBetweenDataRefresh * 60) + lastEpoch) - now());
+  long timeToUpdate = (((minutesBetweenDataRefresh * 60) + lastEpoch) - TimeDB.getUtc());
 
   int hours = numberOfHours(timeToUpdate);
   int minutes = numberOfMinutes(timeToUpdate);
@@ -1266,12 +2265,12 @@ String getTimeTillUpdate() {
 }
 
 int getMinutesFromLastRefresh() {
-  int minutes = (now() - lastEpoch) / 60;
+  int minutes = (TimeDB.getUtc() - lastEpoch) / 60; // UTC, so a DST change doesn't skew refreshes
   return minutes;
 }
 
 int getMinutesFromLastDisplay() {
-  int minutes = (now() - displayOffEpoch) / 60;
+  int minutes = (TimeDB.getUtc() - displayOffEpoch) / 60;
   return minutes;
 }
 
@@ -1322,9 +2321,10 @@ String writeCityIds() {
     Serial.println("Saving settings now...");
     f.println("TIMEDBKEY=" + TIMEDBKEY);
     f.println("APIKEY=" + APIKEY);
-    f.println("CityID=" + String(CityIDs[0]));
+    f.println("CityID=" + getCityIdList());
     f.println("marqueeMessage=" + marqueeMessage);
     f.println("newsSource=" + NEWS_SOURCE);
+    f.println("newsRssUrl=" + NEWS_RSS_URL);
     f.println("timeDisplayTurnsOn=" + timeDisplayTurnsOn);
     f.println("timeDisplayTurnsOff=" + timeDisplayTurnsOff);
     f.println("ledIntensity=" + String(displayIntensity));
@@ -1336,13 +2336,35 @@ String writeCityIds() {
     f.println("isPM=" + String(IS_PM));
     f.println("wideclockformat=" + Wide_Clock_Style);
     f.println("isMetric=" + String(IS_METRIC));
+    f.println("weatherTls=" + String(WEATHER_USE_TLS));
+    f.println("timeDbTls=" + String(TIMEDB_USE_TLS));
+    f.println("tzRule=" + TIMEZONE_RULE);
+    f.println("timeDbLat=" + timeDbLat);
+    f.println("timeDbLon=" + timeDbLon);
+    f.println("isJson=" + String(JSON_SOURCES_ENABLED));
+    for (int inx = 0; inx < MAX_JSON_SOURCES; inx++) {
+      String number = String(inx + 1);
+      f.println("jsonName" + number + "=" + JsonSourceName[inx]);
+      f.println("jsonUrl" + number + "=" + JsonSourceUrl[inx]);
+      f.println("jsonHeader" + number + "=" + JsonSourceHeader[inx]);
+      f.println("jsonPaths" + number + "=" + JsonSourcePaths[inx]);
+      f.println("jsonFormat" + number + "=" + JsonSourceFormat[inx]);
+      f.println("jsonRefresh" + number + "=" + String(JsonSourceRefresh[inx]));
+    }
+    f.println("ntpEnabled=" + String(NTP_ENABLED));
+    f.println("ntpServer=" + NTP_SERVER);
+    f.println("newsTls=" + String(NEWS_USE_TLS));
     f.println("refreshRate=" + String(minutesBetweenDataRefresh));
     f.println("minutesBetweenScrolling=" + String(minutesBetweenScrolling));
     f.println("isOctoPrint=" + String(OCTOPRINT_ENABLED));
     f.println("isOctoProgress=" + String(OCTOPRINT_PROGRESS));
-    f.println("octoKey=" + OctoPrintApiKey);
-    f.println("octoServer=" + OctoPrintServer);
-    f.println("octoPort=" + String(OctoPrintPort));
+    f.println("isOctoPush=" + String(OCTOPRINT_PUSH));
+    for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+      String number = inx == 0 ? "" : String(inx + 1); // the first keeps the keys it always had
+      f.println("octoKey" + number + "=" + OctoPrintApiKey[inx]);
+      f.println("octoServer" + number + "=" + OctoPrintServer[inx]);
+      f.println("octoPort" + number + "=" + String(OctoPrintPort[inx]));
+    }
     f.println("octoUser=" + OctoAuthUser);
     f.println("octoPass=" + OctoAuthPass);
     f.println("www_username=" + String(www_username));
@@ -1356,18 +2378,63 @@ String writeCityIds() {
     f.println("SHOW_HIGHLOW=" + String(SHOW_HIGHLOW));
     f.println("SHOW_DATE=" + String(SHOW_DATE));
     f.println("USE_PIHOLE=" + String(USE_PIHOLE));
-    f.println("PiHoleServer=" + PiHoleServer);
-    f.println("PiHolePort=" + String(PiHolePort));
-    f.println("PiHoleApiKey=" + String(PiHoleApiKey));
+    for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+      String number = inx == 0 ? "" : String(inx + 1); // the first keeps the keys it always had
+      f.println("PiHoleServer" + number + "=" + PiHoleServer[inx]);
+      f.println("PiHolePort" + number + "=" + String(PiHolePort[inx]));
+      f.println("PiHoleApiKey" + number + "=" + PiHoleApiKey[inx]);
+    }
     f.println("themeColor=" + themeColor);
   }
   f.close();
   readCityIds();
-  weatherClient.updateCityIdList(CityIDs, 1);
+  weatherClient.updateCityIdList(CityIDs, MAX_CITIES);
   String cityIds = weatherClient.getMyCityIDs();
   return cityIds;
 }
 
+String getCityIdList() {
+  String ids = "";
+  for (int inx = 0; inx < MAX_CITIES; inx++) {
+    if (CityIDs[inx] > 0) {
+      if (ids != "") {
+        ids += ",";
+      }
+      ids += String(CityIDs[inx]);
+    }
+  }
+  return ids;
+}
+
+// jsonName1=..., jsonUrl1=... -- the value may itself contain '=' (tokens)
+void readJsonSourceSetting(String line) {
+  int equals = line.indexOf('=');
+  if (equals < 6) {
+    return;
+  }
+  int inx = line.charAt(equals - 1) - '1';
+  if (inx < 0 || inx >= MAX_JSON_SOURCES) {
+    return;
+  }
+  String key = line.substring(0, equals - 1);
+  String value = line.substring(equals + 1);
+  value.trim();
+  if (key == "jsonName") {
+    JsonSourceName[inx] = value;
+  } else if (key == "jsonUrl") {
+    JsonSourceUrl[inx] = value;
+  } else if (key == "jsonHeader") {
+    JsonSourceHeader[inx] = value;
+  } else if (key == "jsonPaths") {
+    JsonSourcePaths[inx] = value;
+  } else if (key == "jsonFormat") {
+    JsonSourceFormat[inx] = value;
+  } else if (key == "jsonRefresh") {
+    JsonSourceRefresh[inx] = value.toInt();
+  }
+  Serial.println(line.substring(0, equals) + "=" + value);
+}
+
 void readCityIds() {
   if (LittleFS.exists(CONFIG) == false) {
     Serial.println("Settings File does not yet exists.");
@@ -1389,8 +2456,31 @@ void readCityIds() {
       Serial.println("APIKEY: " + APIKEY);
     }
     if (line.indexOf("CityID=") >= 0) {
-      CityIDs[0] = line.substring(line.lastIndexOf("CityID=") + 7).toInt();
-      Serial.println("CityID: " + String(CityIDs[0]));
+      // comma separated list (a single ID in older config files)
+      String ids = line.substring(line.lastIndexOf("CityID=") + 7);
+      ids.trim();
+      for (int inx = 0; inx < MAX_CITIES; inx++) {
+        CityIDs[inx] = 0;
+      }
+      int cityInx = 0;
+      int start = 0;
+      while (start < (int)ids.length() && cityInx < MAX_CITIES) {
+        int comma = ids.indexOf(',', start);
+        if (comma < 0) {
+          comma = ids.length();
+        }
+        CityIDs[cityInx] = ids.substring(start, comma).toInt();
+        if (CityIDs[cityInx] > 0) {
+          cityInx++;
+        }
+        start = comma + 1;
+      }
+      Serial.println("CityID: " + getCityIdList());
+    }
+    if (line.indexOf("newsRssUrl=") >= 0) {
+      NEWS_RSS_URL = line.substring(line.lastIndexOf("newsRssUrl=") + 11);
+      NEWS_RSS_URL.trim();
+      Serial.println("NEWS_RSS_URL=" + NEWS_RSS_URL);
     }
     if (line.indexOf("newsSource=") >= 0) {
       NEWS_SOURCE = line.substring(line.lastIndexOf("newsSource=") + 11);
@@ -1423,6 +2513,49 @@ void readCityIds() {
       Wide_Clock_Style.trim();
       Serial.println("Wide_Clock_Style=" + Wide_Clock_Style);
     }
+    if (line.indexOf("weatherTls=") >= 0) {
+      WEATHER_USE_TLS = line.substring(line.lastIndexOf("weatherTls=") + 11).toInt();
+      Serial.println("WEATHER_USE_TLS=" + String(WEATHER_USE_TLS));
+    }
+    if (line.indexOf("timeDbTls=") >= 0) {
+      TIMEDB_USE_TLS = line.substring(line.lastIndexOf("timeDbTls=") + 10).toInt();
+      Serial.println("TIMEDB_USE_TLS=" + String(TIMEDB_USE_TLS));
+    }
+    if (line.indexOf("ntpEnabled=") >= 0) {
+      NTP_ENABLED = line.substring(line.lastIndexOf("ntpEnabled=") + 11).toInt();
+      Serial.println("NTP_ENABLED=" + String(NTP_ENABLED));
+    }
+    if (line.indexOf("ntpServer=") >= 0) {
+      NTP_SERVER = line.substring(line.lastIndexOf("ntpServer=") + 10);
+      NTP_SERVER.trim();
+      Serial.println("NTP_SERVER=" + NTP_SERVER);
+    }
+    if (line.indexOf("isJson=") >= 0) {
+      JSON_SOURCES_ENABLED = line.substring(line.lastIndexOf("isJson=") + 7).toInt();
+      Serial.println("JSON_SOURCES_ENABLED=" + String(JSON_SOURCES_ENABLED));
+    }
+    if (line.startsWith("json")) {
+      readJsonSourceSetting(line);
+    }
+    if (line.indexOf("tzRule=") >= 0) {
+      TIMEZONE_RULE = line.substring(line.lastIndexOf("tzRule=") + 7);
+      TIMEZONE_RULE.trim();
+      Serial.println("TIMEZONE_RULE=" + TIMEZONE_RULE);
+    }
+    if (line.indexOf("timeDbLat=") >= 0) {
+      timeDbLat = line.substring(line.lastIndexOf("timeDbLat=") + 10);
+      timeDbLat.trim();
+      Serial.println("timeDbLat=" + timeDbLat);
+    }
+    if (line.indexOf("timeDbLon=") >= 0) {
+      timeDbLon = line.substring(line.lastIndexOf("timeDbLon=") + 10);
+      timeDbLon.trim();
+      Serial.println("timeDbLon=" + timeDbLon);
+    }
+    if (line.indexOf("newsTls=") >= 0) {
+      NEWS_USE_TLS = line.substring(line.lastIndexOf("newsTls=") + 8).toInt();
+      Serial.println("NEWS_USE_TLS=" + String(NEWS_USE_TLS));
+    }
     if (line.indexOf("isMetric=") >= 0) {
       IS_METRIC = line.substring(line.lastIndexOf("isMetric=") + 9).toInt();
       Serial.println("IS_METRIC=" + String(IS_METRIC));
@@ -1435,7 +2568,6 @@ void readCityIds() {
       Serial.println("minutesBetweenDataRefresh=" + String(minutesBetweenDataRefresh));
     }
     if (line.indexOf("minutesBetweenScrolling=") >= 0) {
-      displayRefreshCount = 1;
       minutesBetweenScrolling = line.substring(line.lastIndexOf("minutesBetweenScrolling=") + 24).toInt();
       Serial.println("minutesBetweenScrolling=" + String(minutesBetweenScrolling));
     }
@@ -1470,19 +2602,29 @@ void readCityIds() {
       OCTOPRINT_PROGRESS = line.substring(line.lastIndexOf("isOctoProgress=") + 15).toInt();
       Serial.println("OCTOPRINT_PROGRESS=" + String(OCTOPRINT_PROGRESS));
     }
-    if (line.indexOf("octoKey=") >= 0) {
-      OctoPrintApiKey = line.substring(line.lastIndexOf("octoKey=") + 8);
-      OctoPrintApiKey.trim();
-      Serial.println("OctoPrintApiKey=" + OctoPrintApiKey);
+    if (line.indexOf("isOctoPush=") >= 0) {
+      OCTOPRINT_PUSH = line.substring(line.lastIndexOf("isOctoPush=") + 11).toInt();
+      Serial.println("OCTOPRINT_PUSH=" + String(OCTOPRINT_PUSH));
     }
-    if (line.indexOf("octoServer=") >= 0) {
-      OctoPrintServer = line.substring(line.lastIndexOf("octoServer=") + 11);
-      OctoPrintServer.trim();
-      Serial.println("OctoPrintServer=" + OctoPrintServer);
-    }
-    if (line.indexOf("octoPort=") >= 0) {
-      OctoPrintPort = line.substring(line.lastIndexOf("octoPort=") + 9).toInt();
-      Serial.println("OctoPrintPort=" + String(OctoPrintPort));
+    for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+      String number = inx == 0 ? "" : String(inx + 1);
+      String key = "octoKey" + number + "=";
+      if (line.indexOf(key) == 0) {
+        OctoPrintApiKey[inx] = line.substring(key.length());
+        OctoPrintApiKey[inx].trim();
+        Serial.println(key + OctoPrintApiKey[inx]);
+      }
+      key = "octoServer" + number + "=";
+      if (line.indexOf(key) == 0) {
+        OctoPrintServer[inx] = line.substring(key.length());
+        OctoPrintServer[inx].trim();
+        Serial.println(key + OctoPrintServer[inx]);
+      }
+      key = "octoPort" + number + "=";
+      if (line.indexOf(key) == 0) {
+        OctoPrintPort[inx] = line.substring(key.length()).toInt();
+        Serial.println(key + String(OctoPrintPort[inx]));
+      }
     }
     if (line.indexOf("octoUser=") >= 0) {
       OctoAuthUser = line.substring(line.lastIndexOf("octoUser=") + 9);
@@ -1542,19 +2684,25 @@ void readCityIds() {
       USE_PIHOLE = line.substring(line.lastIndexOf("USE_PIHOLE=") + 11).toInt();
       Serial.println("USE_PIHOLE=" + String(USE_PIHOLE));
     }
-    if (line.indexOf("PiHoleServer=") >= 0) {
-      PiHoleServer = line.substring(line.lastIndexOf("PiHoleServer=") + 13);
-      PiHoleServer.trim();
-      Serial.println("PiHoleServer=" + String(PiHoleServer));
-    }
-    if (line.indexOf("PiHolePort=") >= 0) {
-      PiHolePort = line.substring(line.lastIndexOf("PiHolePort=") + 11).toInt();
-      Serial.println("PiHolePort=" + String(PiHolePort));
-    }
-    if (line.indexOf("PiHoleApiKey=") >= 0) {
-      PiHoleApiKey = line.substring(line.lastIndexOf("PiHoleApiKey=") + 13);
-      PiHoleApiKey.trim();
-      Serial.println("PiHoleApiKey=" + String(PiHoleApiKey));
+    for (int inx = 0; inx < MAX_PIHOLES; inx++) {
+      String number = inx == 0 ? "" : String(inx + 1);
+      String key = "PiHoleServer" + number + "=";
+      if (line.indexOf(key) == 0) {
+        PiHoleServer[inx] = line.substring(key.length());
+        PiHoleServer[inx].trim();
+        Serial.println(key + PiHoleServer[inx]);
+      }
+      key = "PiHolePort" + number + "=";
+      if (line.indexOf(key) == 0) {
+        PiHolePort[inx] = line.substring(key.length()).toInt();
+        Serial.println(key + String(PiHolePort[inx]));
+      }
+      key = "PiHoleApiKey" + number + "=";
+      if (line.indexOf(key) == 0) {
+        PiHoleApiKey[inx] = line.substring(key.length());
+        PiHoleApiKey[inx].trim();
+        Serial.println(key + PiHoleApiKey[inx]);
+      }
     }
     if (line.indexOf("themeColor=") >= 0) {
       themeColor = line.substring(line.lastIndexOf("themeColor=") + 11);
@@ -1565,20 +2713,42 @@ void readCityIds() {
   fr.close();
   matrix.setIntensity(displayIntensity);
   newsClient.updateNewsClient(NEWS_API_KEY, NEWS_SOURCE);
+  rssClient.setUrls(NEWS_RSS_URL);
+  rssClient.setFingerprint(0, RSS_FINGERPRINT_1);
+  rssClient.setFingerprint(1, RSS_FINGERPRINT_2);
+  rssClient.setFingerprint(2, RSS_FINGERPRINT_3);
+  rssClient.setFingerprint(3, RSS_FINGERPRINT_4);
+  newsClient.setTls(NEWS_USE_TLS, NEWS_FINGERPRINT);
+  TimeDB.setTls(TIMEDB_USE_TLS, TIMEDB_FINGERPRINT);
+  TimeDB.setTimeZoneRule(TIMEZONE_RULE);
+  sntpClock.setServer(NTP_ENABLED ? NTP_SERVER : "");
+  configureJsonSources();
+  weatherClient.setTls(WEATHER_USE_TLS, WEATHER_FINGERPRINT);
   weatherClient.updateWeatherApiKey(APIKEY);
   weatherClient.setMetric(IS_METRIC);
-  weatherClient.updateCityIdList(CityIDs, 1);
-  printerClient.updateOctoPrintClient(OctoPrintApiKey, OctoPrintServer, OctoPrintPort, OctoAuthUser, OctoAuthPass);
+  weatherClient.updateCityIdList(CityIDs, MAX_CITIES);
+  for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+    printerClient.setPrinter(inx, OctoPrintApiKey[inx], OctoPrintServer[inx], OctoPrintPort[inx]);
+  }
+  printerClient.setAuth(OctoAuthUser, OctoAuthPass);
+  printerClient.setPushEnabled(OCTOPRINT_ENABLED && OCTOPRINT_PUSH);
+  configureScheduler();
 }
 
 void scrollMessage(String msg) {
-  msg += " "; // add a space at the end
-  for ( unsigned int i = 0 ; i < width * msg.length() + matrix.width() - 1 - spacer; i++ ) {
-    if (WEBSERVER_ENABLED) {
-      server.handleClient();
-    }
-    if (ENABLE_OTA) {
-      ArduinoOTA.handle();
+  MarqueeText text;
+  text.add(msg.c_str());
+  scrollMessage(text);
+}
+
+// False when it was cut short for something urgent
+boolean scrollMessage(MarqueeText &text) {
+  text.add(" "); // add a space at the end
+  unsigned int length = text.length();
+  for ( unsigned int i = 0 ; i < width * length + matrix.width() - 1 - spacer; i++ ) {
+    handleBackgroundTasks();
+    if (!showingMessage && (messageQueue.hasUrgent() || scheduler.shouldPreempt())) {
+      return false; // an urgent pushed message or item goes on right away, loop() shows it next
     }
     if (refresh == 1) i = 0;
     refresh = 0;
@@ -1589,8 +2759,8 @@ void scrollMessage(String msg) {
     int y = (matrix.height() - 8) / 2; // center the text vertically
 
     while ( x + width - spacer >= 0 ) {
-      if ( letter < msg.length() ) {
-        matrix.drawChar(x, y, msg[letter], HIGH, LOW, 1);
+      if ( letter < length ) {
+        matrix.drawChar(x, y, text.charAt(letter), HIGH, LOW, 1);
       }
 
       letter--;
@@ -1598,14 +2768,21 @@ void scrollMessage(String msg) {
     }
 
     matrix.write(); // Send bitmap to display
+    if (pendingFirstPixel != 0) {
+      messageQueue.firstPixel(pendingFirstPixel);
+      pendingFirstPixel = 0;
+    }
+    scrollHeapLow = min(scrollHeapLow, ESP.getFreeHeap());
     delay(displayScrollSpeed);
   }
   matrix.setCursor(0, 0);
+  return true;
 }
 
-void drawPiholeGraph() {
+// Drawn for the Pi-hole item's dwell; false when there is no graph
+boolean drawPiholeGraph() {
   if (!USE_PIHOLE || piholeClient.getBlockedCount() == 0) {
-    return;
+    return false;
   }
   int count = piholeClient.getBlockedCount();
   int high = piholeClient.getBlockedHigh();
@@ -1638,14 +2815,31 @@ void drawPiholeGraph() {
     row--;
   }
   matrix.write();
-  for (int wait = 0; wait < 500; wait++) {
-    if (WEBSERVER_ENABLED) {
-      server.handleClient();
+  return true;
+}
+
+// One bar per printing printer, stacked up from the bottom when the display has rows to
+// spare below the clock; when there are more printers than bars they take turns
+void drawPrinterProgress() {
+  int printing = printerClient.getPrintingCount();
+  if (printing == 0) {
+    return;
+  }
+  int bars = (matrix.height() - 8) / 2 + 1;
+  int shown = min(printing, bars);
+  int first = printing > bars ? (millis() / 5000) % printing : 0;
+  int nth = 0;
+  for (int inx = 0; inx < MAX_PRINTERS; inx++) {
+    if (!printerClient.isPrinting(inx)) {
+      continue;
     }
-    if (ENABLE_OTA) {
-      ArduinoOTA.handle();
+    int position = (nth - first + printing) % printing;
+    nth++;
+    if (position >= shown) {
+      continue;
     }
-    delay(20);
+    int numberOfLightPixels = (printerClient.getProgressCompletionValue(inx) / float(100)) * (matrix.width() - 1);
+    matrix.drawFastHLine(0, matrix.height() - 1 - position * 2, numberOfLightPixels, HIGH);
   }
 }
 
@@ -1662,9 +2856,8 @@ void centerPrint(String msg, boolean extraStuff) {
       matrix.drawPixel(matrix.width() - 1, 6, HIGH);
     }
 
-    if (OCTOPRINT_ENABLED && OCTOPRINT_PROGRESS && printerClient.isPrinting()) {
-      int numberOfLightPixels = (printerClient.getProgressCompletion().toFloat() / float(100)) * (matrix.width() - 1);
-      matrix.drawFastHLine(0, 7, numberOfLightPixels, HIGH);
+    if (OCTOPRINT_ENABLED && OCTOPRINT_PROGRESS) {
+      drawPrinterProgress();
     }
     
   }
@@ -1675,31 +2868,12 @@ void centerPrint(String msg, boolean extraStuff) {
   matrix.write();
 }
 
+// A form value for the display. server.arg() has already undone the %XX and
+// '+' escapes, so only the UTF-8 is left to map -- decoding again would turn
+// "C++" into "C  " and "100%41" into "100A".
 String decodeHtmlString(String msg) {
-  String decodedMsg = msg;
-  // Restore special characters that are misformed to %char by the client browser
-  decodedMsg.replace("+", " ");
-  decodedMsg.replace("%21", "!");
-  decodedMsg.replace("%22", "");
-  decodedMsg.replace("%23", "#");
-  decodedMsg.replace("%24", "$");
-  decodedMsg.replace("%25", "%");
-  decodedMsg.replace("%26", "&");
-  decodedMsg.replace("%27", "'");
-  decodedMsg.replace("%28", "(");
-  decodedMsg.replace("%29", ")");
-  decodedMsg.replace("%2A", "*");
-  decodedMsg.replace("%2B", "+");
-  decodedMsg.replace("%2C", ",");
-  decodedMsg.replace("%2F", "/");
-  decodedMsg.replace("%3A", ":");
-  decodedMsg.replace("%3B", ";");
-  decodedMsg.replace("%3C", "<");
-  decodedMsg.replace("%3D", "=");
-  decodedMsg.replace("%3E", ">");
-  decodedMsg.replace("%3F", "?");
-  decodedMsg.replace("%40", "@");
-  decodedMsg.toUpperCase();
-  decodedMsg.trim();
-  return decodedMsg;
+  msg.remove(DisplayText::clean(msg.begin()));
+  msg.toUpperCase();
+  msg.trim();
+  return msg;
 }
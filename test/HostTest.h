@@ -0,0 +1,66 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+#pragma once
+#include <Arduino.h>
+#include <chrono>
+
+// Tiny check helpers shared by the host tests -- each test is its own program
+// and exits non-zero when a check failed
+
+static int checks = 0;
+static int failures = 0;
+
+#define CHECK(condition) do { \
+    checks++; \
+    if (!(condition)) { \
+      failures++; \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+    } \
+  } while (0)
+
+#define CHECK_TEXT(got, want) do { \
+    checks++; \
+    std::string gotText = (got); \
+    if (gotText != (want)) { \
+      failures++; \
+      printf("FAIL %s:%d: [%s] want [%s]\n", __FILE__, __LINE__, gotText.c_str(), (want)); \
+    } \
+  } while (0)
+
+inline int testResult(const char* name) {
+  printf("%s: %d checks, %d failed\n", name, checks, failures);
+  return failures == 0 ? 0 : 1;
+}
+
+// Microseconds per call of fn over count runs
+template <typename Fn> double timePerCall(int count, Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (int inx = 0; inx < count; inx++) {
+    fn(inx);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / count;
+}
@@ -0,0 +1,590 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Heap allocations of one data refresh, with the String-per-field models the
+// weather, Pi-hole and OctoPrint clients had before against the typed ones
+// they keep now. The recorded replies in data/ are read into a small tree
+// here, so the clients' field-by-field code runs as written without
+// ArduinoJson; what is counted is the heap blocks the ESP8266 String would
+// take (see the String stub), not the parser's.
+//
+// data/weather.json is the metric reply the client asks for now; the old
+// client asked in the display units, so its ticker shows other numbers from
+// the same recording, but builds them the same way.
+
+#include "HostTest.h"
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <vector>
+
+static const int MAX_CITIES = 5;
+static const bool IS_METRIC = false; // the default in Settings.h -- imperial converts at parse time in the old model
+
+// ---- the recorded reply as a tree, read the way the clients read ArduinoJson
+
+struct Node {
+  enum { NUL, NUMBER, STRING, BOOL, ARRAY, OBJECT } type = NUL;
+  std::string text;
+  std::vector<std::pair<std::string, Node>> members;
+  std::vector<Node> items;
+};
+
+static void skipSpace(const char* &in) {
+  while (*in == ' ' || *in == '\n' || *in == '\r' || *in == '\t') in++;
+}
+
+static Node parseNode(const char* &in) {
+  Node node;
+  skipSpace(in);
+  if (*in == '{' || *in == '[') {
+    boolean object = *in++ == '{';
+    node.type = object ? Node::OBJECT : Node::ARRAY;
+    skipSpace(in);
+    while (*in != '\0' && *in != (object ? '}' : ']')) {
+      if (object) {
+        std::string key = parseNode(in).text;
+        skipSpace(in);
+        in++; // ':'
+        node.members.push_back({key, parseNode(in)});
+      } else {
+        node.items.push_back(parseNode(in));
+      }
+      skipSpace(in);
+      if (*in == ',') in++;
+      skipSpace(in);
+    }
+    in++;
+  } else if (*in == '"') {
+    node.type = Node::STRING;
+    for (in++; *in != '\0' && *in != '"'; in++) {
+      if (*in == '\\') in++; // the recordings only escape quotes and slashes
+      node.text += *in;
+    }
+    in++;
+  } else {
+    const char* start = in;
+    while (*in != '\0' && *in != ',' && *in != '}' && *in != ']' && *in != ' ' && *in != '\n') in++;
+    node.text.assign(start, in);
+    node.type = node.text == "null" ? Node::NUL : (node.text == "true" || node.text == "false") ? Node::BOOL : Node::NUMBER;
+  }
+  return node;
+}
+
+// Just the JsonVariant calls the clients make
+class Field {
+public:
+  Field(const Node* node = nullptr) : node(node) {}
+  Field operator[](const char* key) const {
+    if (node != nullptr && node->type == Node::OBJECT) {
+      for (auto &member : node->members) {
+        if (member.first == key) return Field(&member.second);
+      }
+    }
+    return Field();
+  }
+  Field operator[](int index) const {
+    return node != nullptr && node->type == Node::ARRAY && index < (int) node->items.size() ? Field(&node->items[index]) : Field();
+  }
+  bool isNull() const { return node == nullptr || node->type == Node::NUL; }
+  size_t size() const { return node == nullptr ? 0 : (node->type == Node::ARRAY ? node->items.size() : node->members.size()); }
+  template <typename T> T as() const { return isNull() ? T() : (T) strtod(node->text.c_str(), nullptr); }
+  template <typename T> operator T() const { return as<T>(); }
+  const char* operator|(const char* fallback) const { return node != nullptr && node->type == Node::STRING ? node->text.c_str() : fallback; }
+  template <typename T> T operator|(T fallback) const { return node != nullptr && node->type == Node::NUMBER ? as<T>() : fallback; }
+  std::vector<Field> items() const {
+    std::vector<Field> fields;
+    for (auto &item : node->items) fields.push_back(Field(&item));
+    return fields;
+  }
+  std::vector<Field> values() const {
+    std::vector<Field> fields;
+    for (auto &member : node->members) fields.push_back(Field(&member.second));
+    return fields;
+  }
+
+private:
+  const Node* node;
+};
+
+// ArduinoJson's as<String>() -- a new String, "null" for a missing field
+template <> String Field::as<String>() const { return isNull() ? String("null") : String(node->text.c_str()); }
+
+static Node readReply(const char* name) {
+  std::ifstream file(std::string("data/") + name);
+  std::stringstream text;
+  text << file.rdbuf();
+  std::string json = text.str();
+  const char* in = json.c_str();
+  return parseNode(in);
+}
+
+// ---- weather
+
+namespace before {
+
+typedef struct {
+  String lat, lon, dt, city, country, temp, humidity, condition, wind, weatherId, description, icon;
+  boolean cached;
+  String error, pressure, direction, high, low, timeZone;
+} weather;
+
+static weather weathers[MAX_CITIES];
+static String units = IS_METRIC ? "metric" : "imperial";
+
+static String roundValue(String value) {
+  float f = value.toFloat();
+  int rounded = (int)(f + 0.5f);
+  return String(rounded);
+}
+
+static int getTimeZone(int index) {
+  int rtnValue = weathers[index].timeZone.toInt();
+  return rtnValue != 0 ? rtnValue / 3600 : 0;
+}
+
+static String getDirectionText(int index) {
+  int num = roundValue(weathers[index].direction).toInt();
+  int val = floor((num / 22.5) + 0.5);
+  String arr[] = {"N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW"};
+  return arr[(val % 16)];
+}
+
+static String getTempSymbol() {
+  String rtnValue = "F";
+  if (IS_METRIC) {
+    rtnValue = "C";
+  }
+  return char(247) + rtnValue;
+}
+
+static String getSpeedSymbol() {
+  String rtnValue = "mph";
+  if (IS_METRIC) {
+    rtnValue = "kph";
+  }
+  return rtnValue;
+}
+
+static String getPressureSymbol() {
+  String rtnValue = "";
+  if (IS_METRIC) {
+    rtnValue = "mb";
+  }
+  return rtnValue;
+}
+
+// OpenWeatherMapClient::updateWeather() after the parse
+static int readWeather(Field jdoc) {
+  int inx = 0;
+  for (Field city : jdoc["list"].items()) {
+    if (inx >= MAX_CITIES) {
+      break;
+    }
+    weathers[inx].lon       = city["coord"]["lon"].as<String>();
+    weathers[inx].lat       = city["coord"]["lat"].as<String>();
+    weathers[inx].dt        = city["dt"].as<String>();
+    weathers[inx].city      = city["name"].as<String>();
+    weathers[inx].country   = city["sys"]["country"].as<String>();
+    weathers[inx].temp      = city["main"]["temp"].as<String>();
+    weathers[inx].humidity  = city["main"]["humidity"].as<String>();
+    weathers[inx].condition = city["weather"][0]["main"].as<String>();
+    weathers[inx].wind      = city["wind"]["speed"].as<String>();
+    weathers[inx].weatherId = city["weather"][0]["id"].as<String>();
+    weathers[inx].description = city["weather"][0]["description"].as<String>();
+    weathers[inx].icon      = city["weather"][0]["icon"].as<String>();
+    weathers[inx].pressure  = city["main"]["pressure"].as<String>();
+    weathers[inx].direction = city["wind"]["deg"].as<String>();
+    weathers[inx].high      = city["main"]["temp_max"].as<String>();
+    weathers[inx].low       = city["main"]["temp_min"].as<String>();
+    weathers[inx].timeZone  = city["sys"]["timezone"].as<String>();
+
+    if (units == "metric") {
+      float f = (weathers[inx].wind.toFloat() * 3.6);
+      weathers[inx].wind = String(f);
+    }
+    if (units != "metric") {
+      float p = (weathers[inx].pressure.toFloat() * 0.0295301);
+      weathers[inx].pressure = String(p);
+    }
+
+    Serial.println("lat: " + weathers[inx].lat);
+    Serial.println("lon: " + weathers[inx].lon);
+    Serial.println("dt: " + weathers[inx].dt);
+    Serial.println("city: " + weathers[inx].city);
+    Serial.println("country: " + weathers[inx].country);
+    Serial.println("temp: " + weathers[inx].temp);
+    Serial.println("humidity: " + weathers[inx].humidity);
+    Serial.println("condition: " + weathers[inx].condition);
+    Serial.println("wind: " + weathers[inx].wind);
+    Serial.println("direction: " + weathers[inx].direction);
+    Serial.println("weatherId: " + weathers[inx].weatherId);
+    Serial.println("description: " + weathers[inx].description);
+    Serial.println("icon: " + weathers[inx].icon);
+    Serial.println("timezone: " + String(getTimeZone(inx)));
+    Serial.println();
+    inx++;
+  }
+  return inx;
+}
+
+// The weather part of the ticker, as loop() built it
+static String weatherLine(int index) {
+  String temperature = roundValue(weathers[index].temp);
+  String description = weathers[index].description;
+  description.toUpperCase();
+  String msg;
+  msg += weathers[index].city + "  ";
+  msg += temperature + getTempSymbol() + "  ";
+  msg += "High/Low:" + roundValue(weathers[index].high) + "/" + roundValue(weathers[index].low) + " " + getTempSymbol() + "  ";
+  msg += description + "  ";
+  msg += "Humidity:" + roundValue(weathers[index].humidity) + "%  ";
+  msg += "Wind: " + getDirectionText(index) + " @ " + roundValue(weathers[index].wind) + " " + getSpeedSymbol() + "  ";
+  msg += "Pressure:" + weathers[index].pressure + getPressureSymbol() + "  ";
+  return msg;
+}
+
+}
+
+namespace after {
+
+typedef struct {
+  float lat;
+  float lon;
+  uint32_t dt;
+  char city[40];
+  char country[4];
+  float temp;
+  uint8_t humidity;
+  char condition[16];
+  float wind;
+  uint16_t weatherId;
+  char description[40];
+  char icon[4];
+  float pressure;
+  uint16_t direction;
+  float high;
+  float low;
+  int32_t timeZone;
+} weather;
+
+static weather weathers[MAX_CITIES];
+
+static float toDisplayTemp(float celsius) {
+  return IS_METRIC ? celsius : celsius * 1.8f + 32.0f;
+}
+
+static const char* getDirectionAbbrev(int index) {
+  static const char* const names[] = {"N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW"};
+  return names[(int)floor(weathers[index].direction / 22.5 + 0.5) % 16];
+}
+
+static int readWeather(Field jdoc) {
+  int inx = 0;
+  for (Field city : jdoc["list"].items()) {
+    if (inx >= MAX_CITIES) {
+      break;
+    }
+    weather &w = weathers[inx];
+    w.lon       = city["coord"]["lon"];
+    w.lat       = city["coord"]["lat"];
+    w.dt        = city["dt"];
+    strlcpy(w.city, city["name"] | "", sizeof(w.city));
+    strlcpy(w.country, city["sys"]["country"] | "", sizeof(w.country));
+    w.temp      = city["main"]["temp"];
+    w.humidity  = city["main"]["humidity"];
+    strlcpy(w.condition, city["weather"][0]["main"] | "", sizeof(w.condition));
+    w.wind      = city["wind"]["speed"];
+    w.weatherId = city["weather"][0]["id"];
+    strlcpy(w.description, city["weather"][0]["description"] | "", sizeof(w.description));
+    strlcpy(w.icon, city["weather"][0]["icon"] | "", sizeof(w.icon));
+    w.pressure  = city["main"]["pressure"];
+    w.direction = city["wind"]["deg"];
+    w.high      = city["main"]["temp_max"];
+    w.low       = city["main"]["temp_min"];
+    w.timeZone  = city["sys"]["timezone"];
+
+    Serial.printf("city: %s, %s (%.4f, %.4f) dt: %lu timezone: %d\n", w.city, w.country, w.lat, w.lon, (unsigned long)w.dt, (int)(w.timeZone / 3600));
+    Serial.printf("temp: %.1f C humidity: %u%% pressure: %.0f hPa wind: %.1f m/s @ %u\n", w.temp, w.humidity, w.pressure, w.wind, w.direction);
+    Serial.printf("condition: %s (%s) weatherId: %u icon: %s\n", w.condition, w.description, w.weatherId, w.icon);
+    Serial.println();
+    inx++;
+  }
+  return inx;
+}
+
+// formatWeatherLine() in marquee.ino, every part switched on
+static void weatherLine(int index, char *buf, size_t size) {
+  const weather &w = weathers[index];
+  const char tempSymbol[] = { (char)247, IS_METRIC ? 'C' : 'F', '\0' };
+  size_t len = 0;
+  len += snprintf(buf + len, size - len, "%s  ", w.city);
+  len += snprintf(buf + len, size - len, "%ld%s  ", lroundf(toDisplayTemp(w.temp)), tempSymbol);
+  len += snprintf(buf + len, size - len, "High/Low:%ld/%ld %s  ", lroundf(toDisplayTemp(w.high)), lroundf(toDisplayTemp(w.low)), tempSymbol);
+  size_t start = len;
+  len += snprintf(buf + len, size - len, "%s  ", w.description);
+  for (size_t inx = start; inx < len && inx < size; inx++) {
+    buf[inx] = toupper(buf[inx]);
+  }
+  len += snprintf(buf + len, size - len, "Humidity:%d%%  ", w.humidity);
+  len += snprintf(buf + len, size - len, "Wind: %s @ %ld %s  ", getDirectionAbbrev(index), lroundf(IS_METRIC ? w.wind * 3.6f : w.wind * 2.23694f), IS_METRIC ? "kph" : "mph");
+  if (len < size) {
+    snprintf(buf + len, size - len, IS_METRIC ? "Pressure:%.0fmb  " : "Pressure:%.2f  ", IS_METRIC ? w.pressure : w.pressure * 0.0295301f);
+  }
+}
+
+}
+
+// ---- Pi-hole summary
+
+namespace before {
+
+typedef struct {
+  String domains_being_blocked, dns_queries_today, ads_blocked_today, ads_percentage_today, unique_domains,
+         queries_forwarded, queries_cached, clients_ever_seen, unique_clients, dns_queries_all_types,
+         reply_NODATA, reply_NXDOMAIN, reply_CNAME, reply_IP, privacy_level, piHoleStatus;
+} phd;
+
+static phd piHoleData;
+
+static String getStatus() {
+  return "Blocking";
+}
+
+// PiHoleClient::getPiHoleData() after the parse
+static void readSummary(Field jdoc) {
+  Field queries = jdoc["queries"];
+  Field gravity = jdoc["gravity"];
+  Field query_types = jdoc["types"];
+  Field clients = jdoc["clients"];
+  Field replies = jdoc["replies"];
+
+  piHoleData.domains_being_blocked = gravity["domains_being_blocked"].as<String>();
+  piHoleData.dns_queries_today     = queries["total"].as<String>();
+  piHoleData.ads_blocked_today     = queries["blocked"].as<String>();
+  float pct_blocked = queries["percent_blocked"];
+  pct_blocked = std::round(pct_blocked*10)/10;
+  piHoleData.ads_percentage_today  = String(pct_blocked);
+  piHoleData.unique_domains        = queries["unique_domains"].as<String>();
+  piHoleData.queries_forwarded     = queries["forwarded"].as<String>();
+  piHoleData.queries_cached        = queries["cached"].as<String>();
+  piHoleData.clients_ever_seen     = clients["total"].as<String>();
+  piHoleData.unique_clients        = clients["active"].as<String>();
+  unsigned int dnsTotalQueries = 0;
+  for (Field value : query_types.values()) {
+    dnsTotalQueries += value.as<int>();
+  }
+  piHoleData.dns_queries_all_types = String(dnsTotalQueries);
+  piHoleData.reply_NODATA = replies["NODATA"].as<String>();
+  piHoleData.reply_NXDOMAIN = replies["NXDOMAIN"].as<String>();
+  piHoleData.reply_CNAME = replies["CNAME"].as<String>();
+  piHoleData.reply_IP = replies["IP"].as<String>();
+  piHoleData.privacy_level = jdoc["privacy_level"].as<String>();
+  piHoleData.piHoleStatus = getStatus();
+
+  Serial.println("Pi-Hole Status: " + piHoleData.piHoleStatus);
+  Serial.println("Todays Percentage Blocked: " + piHoleData.ads_percentage_today);
+  Serial.println();
+}
+
+}
+
+namespace after {
+
+enum { STATUS_UNKNOWN, STATUS_DISABLED, STATUS_BLOCKING, STATUS_PARTIAL };
+
+typedef struct {
+  uint32_t domains_being_blocked;
+  uint32_t dns_queries_today;
+  uint32_t ads_blocked_today;
+  float ads_percentage_today;
+  uint32_t unique_domains;
+  uint32_t queries_forwarded;
+  uint32_t queries_cached;
+  uint16_t clients_ever_seen;
+  uint16_t unique_clients;
+  uint32_t dns_queries_all_types;
+  uint32_t reply_NODATA;
+  uint32_t reply_NXDOMAIN;
+  uint32_t reply_CNAME;
+  uint32_t reply_IP;
+  int8_t privacy_level;
+  uint8_t piHoleStatus;
+} phd;
+
+static phd summary;
+
+// PiHoleClient::fetchSummary() after the parse
+static void readSummary(Field jdoc) {
+  Field queries = jdoc["queries"];
+  Field gravity = jdoc["gravity"];
+  Field query_types = jdoc["types"];
+  Field clients = jdoc["clients"];
+  Field replies = jdoc["replies"];
+
+  summary.domains_being_blocked = gravity["domains_being_blocked"];
+  summary.dns_queries_today     = queries["total"];
+  summary.ads_blocked_today     = queries["blocked"];
+  summary.ads_percentage_today  = queries["percent_blocked"];
+  summary.unique_domains        = queries["unique_domains"];
+  summary.queries_forwarded     = queries["forwarded"];
+  summary.queries_cached        = queries["cached"];
+  summary.clients_ever_seen     = clients["total"];
+  summary.unique_clients        = clients["active"];
+  uint32_t dnsTotalQueries = 0;
+  for (Field value : query_types.values()) {
+    dnsTotalQueries += value.as<uint32_t>();
+  }
+  summary.dns_queries_all_types = dnsTotalQueries;
+  summary.reply_NODATA = replies["NODATA"];
+  summary.reply_NXDOMAIN = replies["NXDOMAIN"];
+  summary.reply_CNAME = replies["CNAME"];
+  summary.reply_IP = replies["IP"];
+  summary.privacy_level = jdoc["privacy_level"] | -1;
+  summary.piHoleStatus = STATUS_BLOCKING;
+}
+
+}
+
+// ---- OctoPrint job
+
+namespace before {
+
+typedef struct {
+  String averagePrintTime, estimatedPrintTime, fileName, fileSize, lastPrintTime, progressCompletion,
+         progressFilepos, progressPrintTime, progressPrintTimeLeft, state, error;
+} PrinterStruct;
+
+static PrinterStruct printerData;
+static unsigned long lastProgressChange = 0;
+
+// OctoPrintClient::getPrinterJobResults() after the parse
+static void readJob(Field jdoc) {
+  printerData.error = "";
+  printerData.averagePrintTime = jdoc["job"]["averagePrintTime"].as<String>();
+  printerData.estimatedPrintTime = jdoc["job"]["estimatedPrintTime"].as<String>();
+  printerData.fileName = jdoc["job"]["file"]["name"].as<String>();
+  printerData.fileSize = jdoc["job"]["file"]["size"].as<String>();
+  printerData.lastPrintTime = jdoc["job"]["lastPrintTime"].as<String>();
+  String completion = jdoc["progress"]["completion"].as<String>();
+  if (completion != printerData.progressCompletion) {
+    lastProgressChange = millis();
+  }
+  printerData.progressCompletion = completion;
+  printerData.progressFilepos = jdoc["progress"]["filepos"].as<String>();
+  printerData.progressPrintTime = jdoc["progress"]["printTime"].as<String>();
+  printerData.progressPrintTimeLeft = jdoc["progress"]["printTimeLeft"].as<String>();
+  printerData.state = jdoc["state"].as<String>();
+  Serial.println("Status: " + printerData.state + " " + printerData.fileName + "(" + printerData.progressCompletion + "%)");
+}
+
+}
+
+namespace after {
+
+typedef struct {
+  float averagePrintTime;
+  float estimatedPrintTime;
+  char fileName[64];
+  uint32_t fileSize;
+  float lastPrintTime;
+  float progressCompletion;
+  uint32_t progressFilepos;
+  uint32_t progressPrintTime;
+  uint32_t progressPrintTimeLeft;
+  char state[24];
+} PrinterStruct;
+
+static PrinterStruct printer;
+static unsigned long lastProgressChange = 0;
+
+// OctoPrintClient::readJob() and readProgress()
+static void readJob(Field jdoc) {
+  Field job = jdoc["job"];
+  strlcpy(printer.fileName, job["file"]["name"] | "", sizeof(printer.fileName));
+  printer.fileSize = job["file"]["size"] | 0;
+  printer.estimatedPrintTime = job["estimatedPrintTime"] | 0.0f;
+  printer.averagePrintTime = job["averagePrintTime"] | 0.0f;
+  printer.lastPrintTime = job["lastPrintTime"] | 0.0f;
+  Field progress = jdoc["progress"];
+  float completion = progress["completion"] | 0.0f;
+  if (completion != printer.progressCompletion) {
+    lastProgressChange = millis();
+  }
+  printer.progressCompletion = completion;
+  printer.progressFilepos = progress["filepos"] | 0;
+  printer.progressPrintTime = progress["printTime"] | 0;
+  printer.progressPrintTimeLeft = progress["printTimeLeft"] | 0;
+  strlcpy(printer.state, jdoc["state"] | "", sizeof(printer.state));
+  Serial.printf("Status: %s %s(%.1f%%)\n", printer.state, printer.fileName, printer.progressCompletion);
+}
+
+}
+
+// Heap blocks String took while fn ran
+template <typename Fn> unsigned long allocationsOf(Fn fn) {
+  unsigned long before = String::heapAllocations;
+  fn();
+  return String::heapAllocations - before;
+}
+
+int main() {
+  Node weatherReply = readReply("weather.json");
+  Node piholeReply = readReply("pihole_summary.json");
+  Node printerReply = readReply("octoprint_job.json");
+
+  int cities = 0;
+  unsigned long oldWeather = allocationsOf([&]() { cities = before::readWeather(Field(&weatherReply)); });
+  unsigned long newWeather = allocationsOf([&]() { CHECK(after::readWeather(Field(&weatherReply)) == cities); });
+  CHECK(cities == 5);
+  CHECK_TEXT(before::weathers[3].city.c_str(), after::weathers[3].city);
+  CHECK(before::weathers[0].temp.toFloat() == after::weathers[0].temp);
+
+  String oldText;
+  char newText[200];
+  unsigned long oldLine = allocationsOf([&]() { oldText = before::weatherLine(0); });
+  unsigned long newLine = allocationsOf([&]() { after::weatherLine(0, newText, sizeof(newText)); });
+  printf("ticker old: [%s]\n       new: [%s]\n", oldText.c_str(), newText);
+
+  unsigned long oldPihole = allocationsOf([&]() { before::readSummary(Field(&piholeReply)); });
+  unsigned long newPihole = allocationsOf([&]() { after::readSummary(Field(&piholeReply)); });
+  CHECK(before::piHoleData.dns_queries_today.toInt() == (long) after::summary.dns_queries_today);
+  CHECK(before::piHoleData.dns_queries_all_types.toInt() == (long) after::summary.dns_queries_all_types);
+
+  unsigned long oldPrinter = allocationsOf([&]() { before::readJob(Field(&printerReply)); });
+  unsigned long newPrinter = allocationsOf([&]() { after::readJob(Field(&printerReply)); });
+  CHECK_TEXT(before::printerData.fileName.c_str(), after::printer.fileName);
+  CHECK(before::printerData.progressPrintTimeLeft.toInt() == (long) after::printer.progressPrintTimeLeft);
+
+  printf("String heap allocations    old    new\n");
+  printf("weather, %d cities      %5lu  %5lu\n", cities, oldWeather, newWeather);
+  printf("weather ticker line     %5lu  %5lu\n", oldLine, newLine);
+  printf("Pi-hole summary         %5lu  %5lu\n", oldPihole, newPihole);
+  printf("OctoPrint job           %5lu  %5lu\n", oldPrinter, newPrinter);
+  unsigned long oldTotal = oldWeather + oldLine + oldPihole + oldPrinter;
+  unsigned long newTotal = newWeather + newLine + newPihole + newPrinter;
+  printf("one refresh             %5lu  %5lu\n", oldTotal, newTotal);
+  CHECK(newTotal * 10 <= oldTotal);
+  return testResult("bench_data_model");
+}
@@ -0,0 +1,122 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+
+// Peak memory of every client's parse, with the filters from JsonFilters.h and
+// replies recorded in data/, against the ceilings in JsonLimits.h. Each parse
+// runs the way the clients do it: the filter on the arena, the document on a
+// JsonBudget. Built 32-bit so ArduinoJson's slots are the ESP8266's size.
+
+#include "HostTest.h"
+#include "JsonLimits.h"
+#include "JsonFilters.h"
+#include <fstream>
+#include <sstream>
+
+static_assert(sizeof(void*) == 4, "build with -m32 so the slots are the size they are on the ESP8266");
+
+static const int RUNS = 2000;
+
+static std::string readReply(const char* name) {
+  std::ifstream file(std::string("data/") + name);
+  std::stringstream text;
+  text << file.rdbuf();
+  return text.str();
+}
+
+// Parses the recorded reply once to measure, then RUNS times to time it;
+// returns the document of the measured parse for the caller to look at
+static void measure(const char* name, const char* filterSpec, size_t ceiling, JsonDocument& result) {
+  std::string reply = readReply(name);
+  CHECK(reply.length() > 0);
+  unsigned long arenaFailures = jsonArena.getFailures();
+
+  JsonBudget budget(name, ceiling);
+  {
+    JsonDocument filter(&jsonArena);
+    CHECK(!deserializeJson(filter, filterSpec));
+    JsonDocument doc(&budget);
+    DeserializationError error = deserializeJson(doc, reply, DeserializationOption::Filter(filter));
+    CHECK(!error);
+    if (error) {
+      printf("  %s: %s\n", name, error.c_str());
+    }
+    result.set(doc);
+  }
+  CHECK(budget.getOverruns() == 0);
+  CHECK(budget.getPeak() <= ceiling);
+  CHECK(budget.getUsed() == 0);
+  CHECK(jsonArena.getFailures() == arenaFailures);
+
+  double perParse = timePerCall(RUNS, [&](int) {
+    JsonDocument filter(&jsonArena);
+    deserializeJson(filter, filterSpec);
+    JsonDocument doc(&budget);
+    deserializeJson(doc, reply, DeserializationOption::Filter(filter));
+  });
+  printf("%-24s %6zu bytes in, peak %5zu/%5zu bytes (%.1f pools), %6.1f us a parse\n", name, reply.length(),
+         budget.getPeak(), ceiling, (double) budget.getPeak() / JSON_POOL_SIZE, perParse);
+}
+
+int main() {
+  JsonDocument result;   // on the heap -- only looked at, not measured
+
+  measure("weather.json", WEATHER_FILTER, JSON_BUDGET_WEATHER, result);
+  CHECK(result["list"].size() == 5);
+  CHECK_TEXT(std::string(result["list"][3]["name"] | ""), "São Paulo");
+  CHECK(result["list"][0]["visibility"].isNull());   // not in the filter
+
+  measure("octoprint_job.json", JOB_FILTER, JSON_BUDGET_OCTOPRINT, result);
+  CHECK_TEXT(std::string(result["state"] | ""), "Printing");
+  CHECK(result["progress"]["printTimeLeft"] == 3011);
+  CHECK(result["job"]["filament"].isNull());
+
+  measure("octoprint_push.json", PUSH_FILTER, JSON_BUDGET_OCTOPRINT, result);
+  CHECK_TEXT(std::string(result["current"]["state"]["text"] | ""), "Printing");
+  CHECK(result["current"]["progress"]["printTimeLeft"] == 3001);
+  CHECK(result["current"]["temps"].isNull());
+  CHECK(result["current"]["logs"].isNull());
+
+  measure("pihole_summary.json", SUMMARY_FILTER, JSON_BUDGET_PIHOLE, result);
+  CHECK(result["queries"]["total"] == 48211);
+  CHECK(result["types"]["HTTPS"] == 5363);
+  CHECK(result["queries"]["status"].isNull());
+
+  measure("pihole_top_clients.json", TOP_CLIENTS_FILTER, JSON_BUDGET_PIHOLE, result);
+  CHECK(result["top_sources_blocked"].size() == 3);
+
+  measure("pihole_history.json", HISTORY_FILTER, JSON_BUDGET_PIHOLE, result);
+  CHECK(result["history"].size() == 145);
+  CHECK(result["history"][0]["total"].isNull());
+
+  measure("timedb.json", TIME_FILTER, JSON_BUDGET_TIMEDB, result);
+  CHECK(result["timestamp"] == 1792398123);
+  CHECK(result["gmtOffset"] == -25200);
+  CHECK(result["zoneName"].isNull());
+
+  printf("arena high water %zu/%d bytes\n", jsonArena.getHighWater(), JSON_ARENA_SIZE);
+  CHECK(jsonArena.getHighWater() <= JSON_ARENA_SIZE);
+  return testResult("bench_json_budget");
+}
@@ -0,0 +1,242 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+
+// What TimeDB::updateTime() costs against a recorded TimeZoneDB reply: the
+// old way (the body built up a byte at a time in a String, then copied to the
+// stack and parsed) against the streaming parse it does now (64 byte reads
+// straight into the filtered document). Without ArduinoJson only the reading
+// half runs -- the socket reads, the heap allocations and the body held --
+// which is where the old way spent most of its time.
+
+#include "HostTest.h"
+#include "JsonLimits.h"
+#include "JsonFilters.h"
+#include <fstream>
+#include <sstream>
+#include <new>
+#include <cstdlib>
+
+static const int RUNS = 5000;
+static const size_t READ_BUFFER = 64;   // as TimeDB's ReadBufferingStream
+
+// Heap allocations made while a reply is read and parsed
+static unsigned long allocations = 0;
+
+void* operator new(size_t size) {
+  allocations++;
+  void* data = malloc(size);
+  if (data == nullptr) {
+    throw std::bad_alloc();
+  }
+  return data;
+}
+
+void operator delete(void* data) noexcept {
+  free(data);
+}
+
+void operator delete(void* data, size_t) noexcept {
+  free(data);
+}
+
+// The socket: hands out the recorded reply, counting the reads
+class RecordedReply {
+
+public:
+  RecordedReply(const std::string& data) : data(data) {}
+
+  int available() { return data.length() - position; }
+  int read() { reads++; return position < data.length() ? (unsigned char) data[position++] : -1; }
+
+  size_t readBytes(char* buffer, size_t length) {
+    reads++;
+    length = std::min(length, data.length() - position);
+    memcpy(buffer, data.data() + position, length);
+    position += length;
+    return length;
+  }
+
+  size_t readBytesUntil(char end, char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length && available() > 0) {
+      int c = read();
+      if (c == end) {
+        break;
+      }
+      buffer[count++] = (char) c;
+    }
+    return count;
+  }
+
+  bool find(const char* target) {
+    size_t found = data.find(target, position);
+    if (found == std::string::npos) {
+      position = data.length();
+      return false;
+    }
+    reads += found + strlen(target) - position;   // Stream::find() reads a byte at a time
+    position = found + strlen(target);
+    return true;
+  }
+
+  unsigned long reads = 0;
+
+private:
+  const std::string& data;
+  size_t position = 0;
+};
+
+// ArduinoJson reader over the reply, READ_BUFFER bytes at a time
+class BufferedReply {
+
+public:
+  BufferedReply(RecordedReply& reply) : reply(reply) {}
+
+  int read() {
+    if (next == end && !fill()) {
+      return -1;
+    }
+    return (unsigned char) buffer[next++];
+  }
+
+  size_t readBytes(char* out, size_t length) {
+    size_t count = 0;
+    while (count < length && (next < end || fill())) {
+      out[count++] = buffer[next++];
+    }
+    return count;
+  }
+
+private:
+  RecordedReply& reply;
+  char buffer[READ_BUFFER];
+  size_t next = 0;
+  size_t end = 0;
+
+  bool fill() {
+    end = reply.readBytes(buffer, READ_BUFFER);
+    next = 0;
+    return end > 0;
+  }
+};
+
+typedef struct {
+  time_t timestamp;
+  size_t bodyHeld;        // bytes of the body held in memory at once
+  unsigned long reads;
+  unsigned long allocations;
+} Result;
+
+// TimeDB::getTime() before the streaming parse (with the byte written past the
+// stack copy left out)
+static Result parseOld(const std::string& http, JsonBudget& budget) {
+  unsigned long allocationsBefore = allocations;
+  RecordedReply client(http);
+  String result = "";
+  boolean record = false;
+  while (client.available()) {
+    char c = client.read();
+    if (String(c) == "{") {
+      record = true;
+    }
+    if (record) {
+      result = result + c;
+    }
+    if (String(c) == "}") {
+      record = false;
+    }
+  }
+  int timeStart = result.lastIndexOf('{');
+  result = result.substring(timeStart);
+  char jsonArray[result.length() + 1];
+  result.toCharArray(jsonArray, sizeof(jsonArray));
+  time_t timestamp = 0;
+#ifdef ARDUINOJSON_VERSION
+  JsonDocument filter(&jsonArena);
+  deserializeJson(filter, TIME_FILTER);
+  JsonDocument jdoc(&budget);
+  deserializeJson(jdoc, jsonArray, DeserializationOption::Filter(filter));
+  timestamp = jdoc["timestamp"] | 0;
+#endif
+  return { timestamp, 2 * result.length() + 1, client.reads, allocations - allocationsBefore };
+}
+
+// TimeDB::updateTime() now
+static Result parseStreaming(const std::string& http, JsonBudget& budget) {
+  unsigned long allocationsBefore = allocations;
+  RecordedReply client(http);
+  char status[32] = {0};
+  client.readBytesUntil('\r', status, sizeof(status));
+  if (strstr(status, " 200 ") == nullptr || !client.find("\r\n\r\n")) {
+    return { 0, 0, client.reads, allocations - allocationsBefore };
+  }
+  BufferedReply bufferedClient(client);
+  time_t timestamp = 0;
+#ifdef ARDUINOJSON_VERSION
+  JsonDocument filter(&jsonArena);
+  deserializeJson(filter, TIME_FILTER);
+  JsonDocument jdoc(&budget);
+  DeserializationError error = deserializeJson(jdoc, bufferedClient, DeserializationOption::Filter(filter));
+  timestamp = error ? 0 : jdoc["timestamp"] | 0;
+#else
+  // what the parser would pull: the body up to its end
+  while (bufferedClient.read() >= 0) {
+  }
+#endif
+  return { timestamp, READ_BUFFER, client.reads, allocations - allocationsBefore };
+}
+
+int main() {
+  std::ifstream file("data/timedb.http", std::ios::binary);
+  std::stringstream text;
+  text << file.rdbuf();
+  std::string http = text.str();
+  CHECK(http.length() > 0);
+
+  JsonBudget oldBudget("old", JSON_BUDGET_TIMEDB);
+  JsonBudget newBudget("streaming", JSON_BUDGET_TIMEDB);
+  Result oldResult = parseOld(http, oldBudget);
+  Result newResult = parseStreaming(http, newBudget);
+#ifdef ARDUINOJSON_VERSION
+  CHECK(oldResult.timestamp == 1792398123);
+  CHECK(newResult.timestamp == 1792398123);
+  CHECK(newBudget.getOverruns() == 0);
+#else
+  printf("no ArduinoJson: reading only, the parse is left out of both\n");
+#endif
+  CHECK(newResult.bodyHeld < oldResult.bodyHeld);
+  CHECK(newResult.reads < oldResult.reads);
+  CHECK(newResult.allocations < oldResult.allocations);
+
+  double oldTime = timePerCall(RUNS, [&](int) { parseOld(http, oldBudget); });
+  double newTime = timePerCall(RUNS, [&](int) { parseStreaming(http, newBudget); });
+  printf("%zu byte reply, %lu byte body\n", http.length(), (unsigned long) (http.length() - http.find("\r\n\r\n") - 4));
+  printf("old:       %6.2f us, %5lu reads, %4lu allocations, %4zu body bytes held, %zu bytes document peak\n",
+         oldTime, oldResult.reads, oldResult.allocations, oldResult.bodyHeld, oldBudget.getPeak());
+  printf("streaming: %6.2f us, %5lu reads, %4lu allocations, %4zu body bytes held, %zu bytes document peak (%.1fx faster)\n",
+         newTime, newResult.reads, newResult.allocations, newResult.bodyHeld, newBudget.getPeak(), oldTime / newTime);
+  return testResult("bench_timedb_parse");
+}
@@ -0,0 +1,139 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+// Headline transliteration: the range table in DisplayText against the
+// String::replace() chain Headlines::cleanText() used before, over the
+// headlines in data/headlines.txt (one per line, UTF-8)
+
+#include "HostTest.h"
+#include "DisplayText.h"
+#include <fstream>
+#include <vector>
+
+// Headlines::cleanText() as it was before the range table
+static String oldCleanText(String text) {
+  text.replace("’", "'");
+  text.replace("“", "\"");
+  text.replace("”", "\"");
+  text.replace("`", "'");
+  text.replace("‘", "'");
+  text.replace("„", "'");
+  text.replace("\\\"", "'");
+  text.replace("•", "-");
+  text.replace("é", "e");
+  text.replace("è", "e");
+  text.replace("ë", "e");
+  text.replace("ê", "e");
+  text.replace("à", "a");
+  text.replace("â", "a");
+  text.replace("ù", "u");
+  text.replace("ç", "c");
+  text.replace("î", "i");
+  text.replace("ï", "i");
+  text.replace("ô", "o");
+  text.replace("…", "...");
+  text.replace("–", "-");
+  text.replace("Â", "A");
+  text.replace("À", "A");
+  text.replace("æ", "ae");
+  text.replace("Æ", "AE");
+  text.replace("É", "E");
+  text.replace("È", "E");
+  text.replace("Ë", "E");
+  text.replace("Ô", "O");
+  text.replace("Ö", "Oe");
+  text.replace("ö", "oe");
+  text.replace("œ", "oe");
+  text.replace("Œ", "OE");
+  text.replace("Ù", "U");
+  text.replace("Û", "U");
+  text.replace("Ü", "Ue");
+  text.replace("ü", "ue");
+  text.replace("Ä", "Ae");
+  text.replace("ä", "ae");
+  text.replace("ß", "ss");
+  text.replace("»", "'");
+  text.replace("«", "'");
+  return text;
+}
+
+// Headlines::cleanText() now
+static String newCleanText(String text) {
+  text.remove(DisplayText::clean(text.begin()));
+  return text;
+}
+
+// Bytes the display font can't show
+static int nonAscii(const String& text) {
+  int count = 0;
+  for (unsigned int inx = 0; inx < text.length(); inx++) {
+    if ((uint8_t) text[inx] >= 0x80) {
+      count++;
+    }
+  }
+  return count;
+}
+
+int main(int argc, char** argv) {
+  const char* path = argc > 1 ? argv[1] : "data/headlines.txt";
+  std::ifstream file(path);
+  std::vector<String> corpus;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!line.empty()) {
+      corpus.push_back(String(line));
+    }
+  }
+  CHECK(!corpus.empty());
+  if (corpus.empty()) {
+    printf("no headlines in %s\n", path);
+    return testResult("bench_transliterate");
+  }
+
+  int oldLeft = 0;
+  int newLeft = 0;
+  int oldUntouched = 0;
+  for (const String& headline : corpus) {
+    String before = oldCleanText(headline);
+    String after = newCleanText(headline);
+    oldLeft += nonAscii(before);
+    newLeft += nonAscii(after);
+    if (nonAscii(before) > 0) {
+      oldUntouched++;
+    }
+    CHECK(nonAscii(after) == 0);
+  }
+  printf("%zu headlines: old left %d non-ASCII bytes in %d of them, new left %d\n",
+         corpus.size(), oldLeft, oldUntouched, newLeft);
+
+  const int rounds = 500;
+  const int runs = rounds * corpus.size();
+  size_t oldChars = 0;
+  size_t newChars = 0;
+  double oldMicros = timePerCall(runs, [&](int inx) { oldChars += oldCleanText(corpus[inx % corpus.size()]).length(); });
+  double newMicros = timePerCall(runs, [&](int inx) { newChars += newCleanText(corpus[inx % corpus.size()]).length(); });
+  printf("per headline: old %.3f us, new %.3f us (%.1fx)\n", oldMicros, newMicros, oldMicros / newMicros);
+  return testResult("bench_transliterate");
+}
@@ -0,0 +1,4 @@
+#include "Arduino.h"
+
+HostSerial Serial;
+unsigned long delayedMillis = 0;
@@ -0,0 +1,146 @@
+// Just enough of the Arduino core to build the device-independent modules on a PC
+#pragma once
+#include <cstdint>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <algorithm>
+#include <chrono>
+
+typedef bool boolean;
+typedef uint8_t byte;
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define PGM_P const char*
+#define F(text) (text)
+#define FPSTR(text) (text)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define memcpy_P memcpy
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+inline bool isUpperCase(char c) { return c >= 'A' && c <= 'Z'; }
+
+// delay() doesn't sleep, it moves the clock on -- a loop that waits out a
+// deadline a millisecond at a time runs through it at once
+extern unsigned long delayedMillis;
+
+inline unsigned long millis() {
+  using namespace std::chrono;
+  return (unsigned long) duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count() + delayedMillis;
+}
+
+inline unsigned long micros() {
+  using namespace std::chrono;
+  return (unsigned long) duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count() + delayedMillis * 1000;
+}
+
+inline void delay(unsigned long ms) { delayedMillis += ms; }
+inline void yield() {}
+
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t length = strlen(src);
+  if (size > 0) {
+    size_t n = std::min(length, size - 1);
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return length;
+}
+
+// Counts the heap blocks the ESP8266 core's String would take: it keeps up to
+// STRING_SSO_LENGTH characters inside the object and allocates beyond that,
+// again each time the text outgrows its block. a + b is a copy of a with b
+// appended, as the core's StringSumHelper does it.
+#define STRING_SSO_LENGTH 10
+
+class String {
+public:
+  static inline unsigned long heapAllocations = 0;
+
+  String() {}
+  String(const char* text) : s(text ? text : "") { track(); }
+  String(const std::string& text) : s(text) { track(); }
+  String(const String& other) : s(other.s) { track(); }
+  String(String&& other) noexcept : s(std::move(other.s)), capacity(other.capacity) { other.capacity = STRING_SSO_LENGTH; }
+  String(char c) : s(1, c) {}
+  String(int value) : s(std::to_string(value)) { track(); }
+  String(unsigned int value) : s(std::to_string(value)) { track(); }
+  String(long value) : s(std::to_string(value)) { track(); }
+  String(unsigned long value) : s(std::to_string(value)) { track(); }
+  String(double value, int decimals = 2) { char b[32]; snprintf(b, sizeof(b), "%.*f", decimals, value); s = b; track(); }
+
+  String& operator=(const String& other) { s = other.s; track(); return *this; }
+  String& operator=(String&& other) noexcept { std::swap(s, other.s); std::swap(capacity, other.capacity); return *this; }
+
+  const char* c_str() const { return s.c_str(); }
+  char* begin() { return &s[0]; }
+  unsigned int length() const { return s.size(); }
+  char operator[](unsigned int index) const { return index < s.size() ? s[index] : 0; }
+  char charAt(unsigned int index) const { return (*this)[index]; }
+  bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+  bool isEmpty() const { return s.empty(); }
+  bool operator==(const String& other) const { return s == other.s; }
+  bool operator!=(const String& other) const { return s != other.s; }
+  String& operator+=(const String& other) { s += other.s; track(); return *this; }
+  String& operator+=(const char* other) { s += other; track(); return *this; }
+  String& operator+=(char c) { s += c; track(); return *this; }
+  String& operator+=(int value) { s += std::to_string(value); track(); return *this; }
+  friend String operator+(const String& a, const String& b) { String sum(a); sum += b; return sum; }
+  friend String operator+(const String& a, const char* b) { String sum(a); sum += b; return sum; }
+  friend String operator+(const char* a, const String& b) { String sum(a); sum += b; return sum; }
+  friend String operator+(const String& a, char b) { String sum(a); sum += b; return sum; }
+  friend String operator+(char a, const String& b) { String sum(a); sum += b; return sum; }
+  friend String operator+(const String& a, int b) { String sum(a); sum += b; return sum; }
+
+  void reserve(unsigned int size) { if (size > capacity) { heapAllocations++; capacity = size; } }
+  void remove(unsigned int index) { if (index < s.size()) s.resize(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < s.size()) s.erase(index, count); }
+  int indexOf(const String& text, unsigned int from = 0) const { size_t p = s.find(text.s, from); return p == std::string::npos ? -1 : (int) p; }
+  int lastIndexOf(char c) const { size_t p = s.rfind(c); return p == std::string::npos ? -1 : (int) p; }
+  void toCharArray(char* buffer, unsigned int size) const { if (size > 0) { size_t n = std::min((size_t) size - 1, s.size()); memcpy(buffer, s.data(), n); buffer[n] = 0; } }
+  String substring(unsigned int from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const { return from < s.size() && to > from ? String(s.substr(from, to - from)) : String(); }
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  void toUpperCase() { for (auto& c : s) c = toupper((unsigned char) c); }
+  void trim() {
+    size_t first = s.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) { s.clear(); return; }
+    s = s.substr(first, s.find_last_not_of(" \t\r\n") - first + 1);
+  }
+  void replace(const String& from, const String& to) {
+    if (from.s.empty()) return;
+    size_t p = 0;
+    while ((p = s.find(from.s, p)) != std::string::npos) { s.replace(p, from.s.size(), to.s); p += to.s.size(); }
+    track();
+  }
+
+private:
+  std::string s;
+  unsigned int capacity = STRING_SSO_LENGTH;
+
+  void track() { if (s.size() > capacity) { heapAllocations++; capacity = s.size(); } }
+};
+
+class HostSerial {
+public:
+  bool quiet = true;   // the tests print their own results
+  void print(const String& text) { if (!quiet) fputs(text.c_str(), stdout); }
+  void println(const String& text = String()) { if (!quiet) puts(text.c_str()); }
+  template <typename... Args> void printf(const char* format, Args... args) { if (!quiet) ::printf(format, args...); }
+};
+
+extern HostSerial Serial;
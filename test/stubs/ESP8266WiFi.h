@@ -0,0 +1,113 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <memory>
+
+// Host stand-in for the ESP8266 WiFi library: the network is whatever
+// HostServer the test puts in hostServer, and every name resolves locally
+
+class IPAddress {
+public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+  bool fromString(const char* text) {
+    unsigned int a, b, c, d;
+    char end;
+    if (sscanf(text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &end) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+      return false;
+    }
+    *this = IPAddress(a, b, c, d);
+    return true;
+  }
+  bool isSet() const { return bytes[0] || bytes[1] || bytes[2] || bytes[3]; }
+  uint8_t operator[](int index) const { return bytes[index]; }
+  bool operator==(const IPAddress& other) const { return memcmp(bytes, other.bytes, 4) == 0; }
+  String toString() const { char text[16]; snprintf(text, sizeof(text), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]); return String(text); }
+
+private:
+  uint8_t bytes[4] = {0, 0, 0, 0};
+};
+
+#define WL_CONNECTED 3
+
+class HostWiFi {
+public:
+  int status() { return WL_CONNECTED; }
+  int hostByName(const char* host, IPAddress& ip) { ip = IPAddress(127, 0, 0, 1); return 1; }
+};
+
+extern HostWiFi WiFi;
+
+class HostEsp {
+public:
+  uint32_t getFreeHeap() { return 40000; }
+};
+
+extern HostEsp ESP;
+
+// The other end of every connection; the test decides what it sends and when
+class HostServer {
+public:
+  virtual ~HostServer() {}
+  virtual int available() = 0;                         // bytes ready now
+  virtual size_t read(char* buffer, size_t size) = 0;
+  virtual bool connected() = 0;                        // false once it has sent everything and closed
+};
+
+extern HostServer* hostServer;
+
+class WiFiClient {
+public:
+  bool connect(const IPAddress&, uint16_t) { open = hostServer != nullptr; return open; }
+  bool connect(const char*, uint16_t) { open = hostServer != nullptr; return open; }
+  bool connected() { return open && hostServer->connected(); }
+  int available() { return open ? hostServer->available() : 0; }
+  int read() { char c; return available() > 0 && hostServer->read(&c, 1) == 1 ? (unsigned char) c : -1; }
+  size_t readBytes(char* buffer, size_t length) { return available() > 0 ? hostServer->read(buffer, length) : 0; }
+  size_t readBytesUntil(char end, char* buffer, size_t length) {
+    size_t count = 0;
+    int c;
+    while (count < length && (c = read()) >= 0 && c != end) {
+      buffer[count++] = (char) c;
+    }
+    return count;
+  }
+  bool find(const char* target) {
+    size_t matched = 0;
+    size_t length = strlen(target);
+    int c;
+    while (matched < length && (c = read()) >= 0) {
+      matched = c == target[matched] ? matched + 1 : (c == target[0] ? 1 : 0);
+    }
+    return matched == length;
+  }
+  size_t print(const String& text) { return text.length(); }
+  size_t println(const String& text = String()) { return text.length() + 2; }
+  void setTimeout(unsigned long) {}
+  void stop() { open = false; }
+
+private:
+  bool open = false;
+};
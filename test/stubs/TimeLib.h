@@ -0,0 +1,47 @@
+// The part of PaulStoffregen/Time the modules under test use
+#pragma once
+#include "Arduino.h"
+
+#define SECS_PER_MIN  (60UL)
+#define SECS_PER_HOUR (3600UL)
+#define SECS_PER_DAY  (86400UL)
+
+typedef struct {
+  uint8_t Second;
+  uint8_t Minute;
+  uint8_t Hour;
+  uint8_t Wday;   // day of week, sunday is day 1
+  uint8_t Day;
+  uint8_t Month;
+  uint8_t Year;   // offset from 1970
+} tmElements_t;
+
+#define CalendarYrToTm(Y) ((Y) - 1970)
+
+inline time_t makeTime(const tmElements_t& elements) {
+  struct tm t = {};
+  t.tm_year = elements.Year + 70;
+  t.tm_mon = elements.Month - 1;
+  t.tm_mday = elements.Day;
+  t.tm_hour = elements.Hour;
+  t.tm_min = elements.Minute;
+  t.tm_sec = elements.Second;
+  return timegm(&t);
+}
+
+inline void breakTime(time_t time, tmElements_t& elements) {
+  struct tm t;
+  gmtime_r(&time, &t);
+  elements.Second = t.tm_sec;
+  elements.Minute = t.tm_min;
+  elements.Hour = t.tm_hour;
+  elements.Wday = t.tm_wday + 1;
+  elements.Day = t.tm_mday;
+  elements.Month = t.tm_mon + 1;
+  elements.Year = t.tm_year - 70;
+}
+
+inline int year(time_t time) { struct tm t; gmtime_r(&time, &t); return t.tm_year + 1900; }
+inline int month(time_t time) { struct tm t; gmtime_r(&time, &t); return t.tm_mon + 1; }
+inline int day(time_t time) { struct tm t; gmtime_r(&time, &t); return t.tm_mday; }
+inline int weekday(time_t time) { struct tm t; gmtime_r(&time, &t); return t.tm_wday + 1; }
@@ -0,0 +1,61 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <ESP8266WiFi.h>
+
+// Host stand-in for BearSSL: a secure client is a plain one that accepts
+// whatever verification it is given
+
+namespace BearSSL {
+
+class Session {
+  uint8_t data[32] = {0};
+};
+
+class X509List {
+public:
+  X509List(const char* pem) {
+    for (const char* found = strstr(pem, "-----BEGIN CERTIFICATE-----"); found != nullptr; found = strstr(found + 1, "-----BEGIN CERTIFICATE-----")) {
+      count++;
+    }
+  }
+  int getCount() { return count; }
+
+private:
+  int count = 0;
+};
+
+class WiFiClientSecure : public WiFiClient {
+public:
+  static bool probeMaxFragmentLength(const char*, uint16_t, uint16_t) { return false; }
+  void setBufferSizes(int, int) {}
+  void setFingerprint(const char*) {}
+  void setTrustAnchors(const X509List*) {}
+  void setX509Time(time_t) {}
+  void setInsecure() {}
+  void setSession(Session*) {}
+  int getLastSSLError(char* buffer, size_t size) { if (size > 0) buffer[0] = 0; return 0; }
+};
+
+}
@@ -0,0 +1,148 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+// Form and UTF-8 decoding of DisplayText, and how fast it is against the
+// String::replace() chain marquee.ino used before
+
+#include "HostTest.h"
+#include "DisplayText.h"
+
+static std::string decodeForm(const char* form) {
+  std::string text(form);
+  text.resize(DisplayText::decodeForm(&text[0]));
+  return text;
+}
+
+static std::string clean(const char* raw) {
+  std::string text(raw);
+  text.resize(DisplayText::clean(&text[0]));
+  return text;
+}
+
+// decodeHtmlString() as it was before DisplayText
+static String oldDecodeHtmlString(String msg) {
+  String decoded = msg;
+  decoded.replace("+", " ");
+  decoded.replace("%21", "!");
+  decoded.replace("%22", "");
+  decoded.replace("%23", "#");
+  decoded.replace("%24", "$");
+  decoded.replace("%25", "%");
+  decoded.replace("%26", "&");
+  decoded.replace("%27", "'");
+  decoded.replace("%28", "(");
+  decoded.replace("%29", ")");
+  decoded.replace("%2A", "*");
+  decoded.replace("%2B", "+");
+  decoded.replace("%2C", ",");
+  decoded.replace("%2F", "/");
+  decoded.replace("%3A", ":");
+  decoded.replace("%3B", ";");
+  decoded.replace("%3C", "<");
+  decoded.replace("%3D", "=");
+  decoded.replace("%3E", ">");
+  decoded.replace("%3F", "?");
+  decoded.replace("%40", "@");
+  decoded.toUpperCase();
+  decoded.trim();
+  return decoded;
+}
+
+// decodeHtmlString() as marquee.ino has it now -- msg is a server.arg() value, already URL-decoded
+static String newDecodeHtmlString(String msg) {
+  msg.remove(DisplayText::clean(msg.begin()));
+  msg.toUpperCase();
+  msg.trim();
+  return msg;
+}
+
+static void testDecodeForm() {
+  CHECK_TEXT(decodeForm("Hello+World"), "Hello World");
+  CHECK_TEXT(decodeForm("%22quoted%22"), "\"quoted\"");
+  CHECK_TEXT(decodeForm("100%25"), "100%");
+  CHECK_TEXT(decodeForm("100%"), "100%");
+  CHECK_TEXT(decodeForm("%zz%4"), "%zz%4");
+  CHECK_TEXT(decodeForm("%4a%4A"), "JJ");
+  CHECK_TEXT(decodeForm("caf%C3%A9"), "cafe");
+  CHECK_TEXT(decodeForm("caf%c3%a9"), "cafe");
+  CHECK_TEXT(decodeForm("Stra%C3%9Fe"), "Strasse");
+  CHECK_TEXT(decodeForm("%E2%82%AC5"), "EUR5");
+  CHECK_TEXT(decodeForm("%E2%80%9Chi%E2%80%9D"), "\"hi\"");
+  CHECK_TEXT(decodeForm("%F0%9F%9A%80go"), "go");        // emoji dropped
+  CHECK_TEXT(decodeForm("caf%E9"), "cafe");              // Windows-1252
+  CHECK_TEXT(decodeForm("%C3"), "A");                    // cut short -- read as Windows-1252
+  CHECK_TEXT(decodeForm("%C3x"), "Ax");
+  CHECK_TEXT(decodeForm("a%00b"), "a b");
+  CHECK_TEXT(decodeForm("caf\xc3\xa9+%2B"), "cafe +");   // raw UTF-8 mixed with escapes
+  CHECK_TEXT(decodeForm("%2B%26%3D"), "+&=");
+  CHECK_TEXT(decodeForm(""), "");
+  CHECK_TEXT(decodeForm("%E6%9D%B1"), "?");              // not in the table
+}
+
+static void testClean() {
+  CHECK_TEXT(clean("Zürich’s Frau Müller – “an honour”"), "Zuerich's Frau Mueller - \"an honour\"");
+  CHECK_TEXT(clean("Łódź and Gdańsk"), "Lodz and Gdansk");
+  CHECK_TEXT(clean("a+b%20c"), "a+b%20c");               // only forms are unescaped
+  CHECK_TEXT(clean("Caf\xe9 \x93quoted\x94"), "Cafe \"quoted\"");
+}
+
+// What the web server hands over is decoded once already; it must not be decoded again
+static void testDecodeHtmlString() {
+  CHECK_TEXT(newDecodeHtmlString("C++").c_str(), "C++");
+  CHECK_TEXT(newDecodeHtmlString("100%41").c_str(), "100%41");
+  CHECK_TEXT(newDecodeHtmlString("50% off").c_str(), "50% OFF");
+  CHECK_TEXT(newDecodeHtmlString(" Caf\xc3\xa9 \xe2\x80\x93 7:30 ").c_str(), "CAFE - 7:30");
+}
+
+static void testGetFormArg() {
+  char value[32];
+  CHECK(DisplayText::getFormArg("text=Hi+there&priority=2", "text", value, sizeof(value)) && strcmp(value, "Hi there") == 0);
+  CHECK(DisplayText::getFormArg("text=Hi+there&priority=2", "priority", value, sizeof(value)) && strcmp(value, "2") == 0);
+  CHECK(!DisplayText::getFormArg("text=Hi&priority=2", "prio", value, sizeof(value)));
+  CHECK(!DisplayText::getFormArg("xtext=Hi", "text", value, sizeof(value)));
+  CHECK(DisplayText::getFormArg("a=1&&text=", "text", value, sizeof(value)) && value[0] == '\0');
+  CHECK(DisplayText::getFormArg("text=0123456789abcdefghij", "text", value, 8) && strcmp(value, "0123456") == 0);
+  CHECK(!DisplayText::getFormArg("Dinner is ready", "text", value, sizeof(value)));
+}
+
+static void benchmark() {
+  const String form = "Happy Birthday \xe2\x80\x93 Caf\xc3\xa9 at 7:30! (bring \"cake\")"; // as server.arg() returns it
+  const int runs = 20000;
+  size_t oldChars = 0;
+  size_t newChars = 0;
+  double oldMicros = timePerCall(runs, [&](int) { oldChars += oldDecodeHtmlString(form).length(); });
+  double newMicros = timePerCall(runs, [&](int) { newChars += newDecodeHtmlString(form).length(); });
+  printf("form decode: old %.3f us, new %.3f us per message (%.1fx)\n", oldMicros, newMicros, oldMicros / newMicros);
+  printf("  old: [%s]\n  new: [%s]\n", oldDecodeHtmlString(form).c_str(), newDecodeHtmlString(form).c_str());
+}
+
+int main() {
+  testDecodeForm();
+  testClean();
+  testDecodeHtmlString();
+  testGetFormArg();
+  benchmark();
+  return testResult("test_display_text");
+}
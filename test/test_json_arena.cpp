@@ -0,0 +1,254 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+
+// Soak test of the JSON arena: weeks of the parses the marquee does, one
+// simulated minute at a time, checking the arena comes back empty after every
+// parse and never creeps -- each simulated day replays the same replies, so
+// any fragmentation carried over from an earlier day shows up as a change in
+// that day's peak
+
+#include "HostTest.h"
+#include "JsonLimits.h"
+#include <vector>
+
+static const int WEEKS = 4;
+static const int MINUTES_PER_DAY = 24 * 60;
+
+// ArduinoJson 7 hands out its slots in pools of 128 (JSON_POOL_SIZE bytes with
+// 7.2's 16 byte slots); strings start at 31 bytes, double while they are read
+// and shrink to fit
+static const int POOL_SLOTS = 128;
+static const size_t STRING_START = 31;
+
+typedef struct {
+  const char* name;
+  int values;        // slots kept by the filter
+  int strings;       // how many of them are strings
+  int maxString;     // longest string value
+} Reply;
+
+static const Reply FILTER      = { "filter",     40,  40,  24 };
+static const Reply WEATHER     = { "weather",   120,  40,  48 };
+static const Reply TIMEDB      = { "timedb",      8,   7,  32 };
+static const Reply OCTOPRINT   = { "octoprint",  20,  16, 120 };
+static const Reply PIHOLE      = { "pihole",    290,   2,  16 };   // the history
+static const Reply WEATHER_BIG = { "weather",   900, 300, 300 };   // something odd upstream, once a day
+
+static uint32_t seed;
+
+static uint32_t nextRandom() {
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static uint8_t* arenaBase;
+static size_t dayPeak;
+static unsigned long corrupted;
+
+// One JsonDocument's worth of blocks, filled with a pattern so an overlap shows up
+class Document {
+
+public:
+  Document(ArduinoJson::Allocator& allocator) : allocator(allocator) {}
+  ~Document() { clear(); }
+
+  // Builds the document the way deserializeJson() allocates; false on NoMemory
+  bool parse(const Reply& reply) {
+    int slots = POOL_SLOTS;
+    for (int inx = 0; inx < reply.values; inx++) {
+      if (slots == POOL_SLOTS) {
+        if (!take(pools, JSON_POOL_SIZE)) {
+          return false;
+        }
+        slots = 0;
+      }
+      slots++;
+      if ((int) (nextRandom() % reply.values) < reply.strings && !addString(1 + nextRandom() % reply.maxString)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void clear() {
+    for (Block& block : strings) {
+      release(block);
+    }
+    for (Block& block : pools) {
+      release(block);
+    }
+    strings.clear();
+    pools.clear();
+  }
+
+private:
+  typedef struct {
+    uint8_t* ptr;
+    size_t size;
+    uint8_t mark;
+  } Block;
+
+  ArduinoJson::Allocator& allocator;
+  std::vector<Block> pools;
+  std::vector<Block> strings;
+
+  void track(Block& block) {
+    memset(block.ptr, block.mark, block.size);
+    size_t end = block.ptr + block.size - arenaBase;
+    if (end > dayPeak) {
+      dayPeak = end;
+    }
+  }
+
+  void verify(const Block& block, size_t size) {
+    for (size_t inx = 0; inx < size; inx++) {
+      if (block.ptr[inx] != block.mark) {
+        corrupted++;
+        return;
+      }
+    }
+  }
+
+  bool take(std::vector<Block>& list, size_t size) {
+    Block block = { (uint8_t*) allocator.allocate(size), size, (uint8_t) nextRandom() };
+    if (block.ptr == nullptr) {
+      return false;
+    }
+    track(block);
+    list.push_back(block);
+    return true;
+  }
+
+  // A string grows by doubling while it is read, then shrinks to fit
+  bool addString(size_t length) {
+    if (!take(strings, STRING_START)) {
+      return false;
+    }
+    Block& block = strings.back();
+    while (block.size < length + 1) {
+      if (!resize(block, block.size * 2)) {
+        return false;
+      }
+    }
+    return resize(block, length + 1);
+  }
+
+  bool resize(Block& block, size_t size) {
+    verify(block, std::min(block.size, size));
+    uint8_t* resized = (uint8_t*) allocator.reallocate(block.ptr, size);
+    if (resized == nullptr) {
+      return false;
+    }
+    block.ptr = resized;
+    block.size = size;
+    track(block);
+    return true;
+  }
+
+  void release(Block& block) {
+    verify(block, block.size);
+    allocator.deallocate(block.ptr);
+  }
+};
+
+JsonBudget weatherBudget("OpenWeatherMap", JSON_BUDGET_WEATHER);
+JsonBudget timeDbBudget("TimeZoneDB", JSON_BUDGET_TIMEDB);
+JsonBudget printerBudget("OctoPrint", JSON_BUDGET_OCTOPRINT);
+JsonBudget piholeBudget("Pi-hole", JSON_BUDGET_PIHOLE);
+
+static unsigned long parses;
+static unsigned long rejected;
+static unsigned long notEmpty;
+
+// The filter and the document are alive together, as in the clients
+static void parseReply(JsonBudget& budget, const Reply& reply) {
+  {
+    Document filter(jsonArena);
+    Document doc(budget);
+    if (!filter.parse(FILTER) || !doc.parse(reply)) {
+      rejected++;
+    }
+  }
+  parses++;
+  if (budget.getUsed() != 0) {
+    notEmpty++;
+  }
+  // with nothing alive the next block must come from the bottom again
+  void* probe = jsonArena.allocate(1);
+  if ((uint8_t*) probe != arenaBase) {
+    notEmpty++;
+  }
+  jsonArena.deallocate(probe);
+}
+
+int main() {
+  void* first = jsonArena.allocate(1);
+  arenaBase = (uint8_t*) first;
+  jsonArena.deallocate(first);
+
+  size_t firstDayPeak = 0;
+  int changedDays = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int day = 0; day < WEEKS * 7; day++) {
+    seed = 20260101;   // the same replies every day
+    dayPeak = 0;
+    for (int minute = 0; minute < MINUTES_PER_DAY; minute++) {
+      parseReply(printerBudget, OCTOPRINT);
+      parseReply(piholeBudget, PIHOLE);
+      if (minute % 15 == 0) {
+        parseReply(weatherBudget, WEATHER);
+        parseReply(timeDbBudget, TIMEDB);
+      }
+      if (minute == 720) {
+        parseReply(weatherBudget, WEATHER_BIG);
+      }
+    }
+    if (day == 0) {
+      firstDayPeak = dayPeak;
+    } else if (dayPeak != firstDayPeak) {
+      changedDays++;
+    }
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  CHECK(parses == (unsigned long) WEEKS * 7 * (2 * MINUTES_PER_DAY + 2 * MINUTES_PER_DAY / 15 + 1));
+  CHECK(corrupted == 0);
+  CHECK(notEmpty == 0);
+  CHECK(changedDays == 0);
+  CHECK(jsonArena.getFailures() == 0);
+  CHECK(jsonArena.getHighWater() <= JSON_ARENA_SIZE);
+  // only the odd reply is turned away, once a day, by its budget
+  CHECK(rejected == (unsigned long) WEEKS * 7);
+  CHECK(weatherBudget.getOverruns() == (unsigned long) WEEKS * 7);
+  CHECK(timeDbBudget.getOverruns() + printerBudget.getOverruns() + piholeBudget.getOverruns() == 0);
+
+  printf("%d weeks, %lu parses in %.2f s: arena high water %zu/%d bytes, daily peak %zu, %lu resets\n",
+         WEEKS, parses, seconds, jsonArena.getHighWater(), JSON_ARENA_SIZE, firstDayPeak, jsonArena.getResets());
+  printf("peaks: weather %zu/%zu, timedb %zu/%zu, octoprint %zu/%zu, pihole %zu/%zu bytes\n",
+         weatherBudget.getPeak(), weatherBudget.getCeiling(), timeDbBudget.getPeak(), timeDbBudget.getCeiling(),
+         printerBudget.getPeak(), printerBudget.getCeiling(), piholeBudget.getPeak(), piholeBudget.getCeiling());
+  return testResult("test_json_arena");
+}
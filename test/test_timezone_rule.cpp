@@ -0,0 +1,123 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+// TimeZoneRule against the system's zoneinfo: the offset every 15 minutes and
+// every DST transition from 2015 to 2050, for zones whose rules haven't
+// changed in that time (the POSIX rule only describes the current ones)
+
+#include "HostTest.h"
+#include "TimeZoneRule.h"
+#include <unistd.h>
+
+typedef struct {
+  const char* posix;
+  const char* zone;
+  int fromYear;   // first year the current rule applies
+} Zone;
+
+static const Zone ZONES[] = {
+  { "PST8PDT,M3.2.0,M11.1.0", "America/Los_Angeles", 2015 },
+  { "EST5EDT,M3.2.0,M11.1.0", "America/New_York", 2015 },
+  { "MST7", "America/Phoenix", 2015 },
+  { "NST3:30NDT,M3.2.0,M11.1.0", "America/St_Johns", 2015 },
+  { "HST10", "Pacific/Honolulu", 2015 },
+  { "GMT0BST,M3.5.0/1,M10.5.0", "Europe/London", 2015 },
+  { "CET-1CEST,M3.5.0,M10.5.0/3", "Europe/Berlin", 2015 },
+  { "EET-2EEST,M3.5.0/3,M10.5.0/4", "Europe/Helsinki", 2015 },
+  { "AEST-10AEDT,M10.1.0,M4.1.0/3", "Australia/Sydney", 2015 },
+  { "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0", "Australia/Lord_Howe", 2015 },
+  { "NZST-12NZDT,M9.5.0,M4.1.0/3", "Pacific/Auckland", 2015 },
+  { "IST-5:30", "Asia/Kolkata", 2015 },
+  { "<+0545>-5:45", "Asia/Kathmandu", 2015 },
+  { "SAST-2", "Africa/Johannesburg", 2015 },
+  { "<-03>3", "America/Sao_Paulo", 2020 },   // no DST since 2019
+};
+
+static const int LAST_YEAR = 2050;
+static const time_t STEP = 15 * 60;
+
+static time_t yearStart(int year) {
+  struct tm t = {};
+  t.tm_year = year - 1900;
+  t.tm_mday = 1;
+  return timegm(&t);
+}
+
+static long zoneinfoOffset(time_t utc) {
+  struct tm local;
+  localtime_r(&utc, &local);
+  return local.tm_gmtoff;
+}
+
+static void compareZone(const Zone& zone) {
+  TimeZoneRule rule;
+  CHECK(rule.parse(zone.posix));
+  setenv("TZ", zone.zone, 1);
+  tzset();
+
+  int offsetMismatches = 0;
+  int changes = 0;
+  int changeMismatches = 0;
+  time_t end = yearStart(LAST_YEAR + 1);
+  long previous = zoneinfoOffset(yearStart(zone.fromYear));
+  for (time_t utc = yearStart(zone.fromYear); utc < end; utc += STEP) {
+    long expected = zoneinfoOffset(utc);
+    if (rule.getOffset(utc) != expected) {
+      if (offsetMismatches < 3) {
+        printf("  %s at %ld: %ld, zoneinfo says %ld\n", zone.zone, (long) utc, rule.getOffset(utc), expected);
+      }
+      offsetMismatches++;
+    }
+    if (expected != previous) {
+      // every transition is on a quarter hour -- it must be the next change seen from just before it
+      changes++;
+      if (rule.getNextChange(utc - STEP) != utc) {
+        if (changeMismatches < 3) {
+          printf("  %s: next change after %ld is %ld, zoneinfo says %ld\n", zone.zone, (long) (utc - STEP),
+                 (long) rule.getNextChange(utc - STEP), (long) utc);
+        }
+        changeMismatches++;
+      }
+      previous = expected;
+    }
+  }
+  checks++;
+  if (offsetMismatches > 0 || changeMismatches > 0) {
+    failures++;
+  }
+  printf("%-22s %d-%d: %d transitions, %d offset and %d transition mismatches\n", zone.zone, zone.fromYear,
+         LAST_YEAR, changes, offsetMismatches, changeMismatches);
+}
+
+int main() {
+  if (access("/usr/share/zoneinfo/Europe/Berlin", R_OK) != 0) {
+    printf("test_timezone_rule: no zoneinfo in /usr/share/zoneinfo, skipped\n");
+    return 0;
+  }
+  for (const Zone& zone : ZONES) {
+    compareZone(zone);
+  }
+  return testResult("test_timezone_rule");
+}
@@ -0,0 +1,264 @@
+/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "HostTest.h"
+#include "RssClient.h"
+#include <new>
+#include <cstdlib>
+
+// Multi-megabyte RSS 2.0 and Atom feeds streamed through the tokenizer into
+// RssClient: the headlines that come out, heap use that doesn't grow with
+// the feed, and throughput. Then the same feeds over the stub network, where
+// reading stops once the store is full and a stalled server hits the deadline.
+
+HostWiFi WiFi;
+HostEsp ESP;
+HostServer* hostServer = nullptr;
+
+// Every allocation carries its size, so the live total is known at any time
+static size_t liveBytes = 0;
+static size_t peakBytes = 0;
+
+void* operator new(size_t size) {
+  size_t* block = (size_t*) malloc(size + sizeof(size_t));
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  block[0] = size;
+  liveBytes += size;
+  if (liveBytes > peakBytes) {
+    peakBytes = liveBytes;
+  }
+  return block + 1;
+}
+
+void operator delete(void* data) noexcept {
+  if (data != nullptr) {
+    size_t* block = (size_t*) data - 1;
+    liveBytes -= block[0];
+    free(block);
+  }
+}
+
+void operator delete(void* data, size_t) noexcept {
+  operator delete(data);
+}
+
+static const char* DAYS[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static const char* MONTHS[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+static const time_t NEWEST = 1790000000; // 2026-09-21, the first item; each later one is a minute older
+
+// Item n of either flavour: entities in the title, markup and CDATA in the
+// description, a link the reader must pick out
+static std::string rssItem(int n) {
+  time_t published = NEWEST - n * 60L;
+  struct tm t;
+  gmtime_r(&published, &t);
+  char date[40];
+  snprintf(date, sizeof(date), "%s, %02d %s %04d %02d:%02d:%02d GMT", DAYS[t.tm_wday], t.tm_mday, MONTHS[t.tm_mon], t.tm_year + 1900, t.tm_hour, t.tm_min, t.tm_sec);
+  char item[1024];
+  snprintf(item, sizeof(item),
+           "<item>\n"
+           "  <title>Story %06d: rates &amp; markets</title>\n"
+           "  <link>https://news.example.com/world/story-%06d.html</link>\n"
+           "  <guid isPermaLink=\"false\">story-%06d</guid>\n"
+           "  <description><![CDATA[<p>Report <b>%06d</b> from the desk.</p><img src=\"x.jpg\"/>]]></description>\n"
+           "  <pubDate>%s</pubDate>\n"
+           "  <media:content url=\"https://img.example.com/%06d.jpg\" medium=\"image\"/>\n"
+           "</item>\n", n, n, n, n, date, n);
+  return item;
+}
+
+static std::string atomEntry(int n) {
+  time_t published = NEWEST - n * 60L;
+  struct tm t;
+  gmtime_r(&published, &t);
+  char date[40];
+  snprintf(date, sizeof(date), "%04d-%02d-%02dT%02d:%02d:%02dZ", t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec);
+  char entry[1024];
+  snprintf(entry, sizeof(entry),
+           "<entry>\n"
+           "  <title type=\"html\">Entry %06d &#8211; rates &lt;up&gt;</title>\n"
+           "  <link rel=\"enclosure\" href=\"https://img.example.com/%06d.jpg\"/>\n"
+           "  <link rel=\"alternate\" href=\"https://blog.example.org/posts/%06d\"/>\n"
+           "  <id>urn:entry:%06d</id>\n"
+           "  <updated>%s</updated>\n"
+           "  <summary type=\"html\">&lt;p&gt;Summary &lt;i&gt;%06d&lt;/i&gt;&lt;/p&gt;</summary>\n"
+           "</entry>\n", n, n, n, n, date, n);
+  return entry;
+}
+
+static std::string makeFeed(boolean atom, size_t minimumBytes) {
+  std::string feed = atom ? "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<feed xmlns=\"http://www.w3.org/2005/Atom\">\n<title>Example Blog</title>\n"
+                          : "<?xml version=\"1.0\"?>\n<rss version=\"2.0\" xmlns:media=\"http://search.yahoo.com/mrss/\">\n<channel>\n<title>Example News</title>\n";
+  for (int n = 0; feed.size() < minimumBytes; n++) {
+    feed += atom ? atomEntry(n) : rssItem(n);
+  }
+  feed += atom ? "</feed>\n" : "</channel>\n</rss>\n";
+  return feed;
+}
+
+// static, so their buffers start out empty the way they do on the device
+static RssClient rssReader;
+static RssClient atomReader;
+
+// The whole feed, straight into the tokenizer. Peak heap above what was live before.
+static size_t streamFeed(RssClient &reader, const std::string &feed, double &bytesPerSecond) {
+  headlines.clear();
+  XmlTokenizer tokenizer;
+  tokenizer.setListener(&reader);
+  tokenizer.reset();
+  size_t before = liveBytes;
+  peakBytes = liveBytes;
+  double micros = timePerCall(1, [&](int) {
+    for (char c : feed) {
+      tokenizer.parse(c);
+    }
+  });
+  CHECK(liveBytes == before);
+  bytesPerSecond = feed.size() / micros * 1e6;
+  return peakBytes - before;
+}
+
+static void testRss() {
+  double small, large;
+  size_t smallPeak = streamFeed(rssReader, makeFeed(false, 1000000), small);
+  size_t largePeak = streamFeed(rssReader, makeFeed(false, 8000000), large);
+  printf("RSS 8 MB: %.1f MB/s, peak heap %u bytes (1 MB feed: %u)\n", large / 1e6, (unsigned) largePeak, (unsigned) smallPeak);
+  CHECK(largePeak == smallPeak);
+
+  // the newest items, as many as the arena holds, in order
+  CHECK(headlines.getCount() > HEADLINE_COUNT / 2);
+  CHECK_TEXT(headlines.getTitle(0).c_str(), "Story 000000: rates & markets");
+  CHECK_TEXT(headlines.getUrl(0).c_str(), "https://news.example.com/world/story-000000.html");
+  CHECK_TEXT(headlines.getDescription(0).c_str(), "Report 000000 from the desk.");
+  CHECK(headlines.getPublished(0) == NEWEST);
+  int last = headlines.getCount() - 1;
+  char title[40];
+  snprintf(title, sizeof(title), "Story %06d: rates & markets", last);
+  CHECK_TEXT(headlines.getTitle(last).c_str(), title);
+  CHECK(headlines.getPublished(last) == NEWEST - last * 60L);
+  CHECK_TEXT(rssReader.getFeedTitle().c_str(), "Example News");
+}
+
+static void testAtom() {
+  double small, large;
+  size_t smallPeak = streamFeed(atomReader, makeFeed(true, 1000000), small);
+  size_t largePeak = streamFeed(atomReader, makeFeed(true, 8000000), large);
+  printf("Atom 8 MB: %.1f MB/s, peak heap %u bytes (1 MB feed: %u)\n", large / 1e6, (unsigned) largePeak, (unsigned) smallPeak);
+  CHECK(largePeak == smallPeak);
+
+  CHECK(headlines.getCount() > HEADLINE_COUNT / 2);
+  CHECK_TEXT(headlines.getTitle(0).c_str(), "Entry 000000 - rates <up>");
+  CHECK_TEXT(headlines.getUrl(0).c_str(), "https://blog.example.org/posts/000000");
+  CHECK_TEXT(headlines.getDescription(0).c_str(), "Summary 000000");
+  CHECK(headlines.getPublished(0) == NEWEST);
+  CHECK_TEXT(atomReader.getFeedTitle().c_str(), "Example Blog");
+}
+
+// Sends the reply in chunks; stalls for good after stallAfter bytes
+class FeedServer : public HostServer {
+public:
+  FeedServer(const std::string &body, size_t stallAfter = (size_t) -1)
+    : reply("HTTP/1.0 200 OK\r\nContent-Type: application/rss+xml\r\n\r\n" + body), stallAfter(stallAfter) {}
+  int available() override {
+    size_t end = std::min(reply.size(), stallAfter);
+    return position < end ? (int) std::min((size_t) 1460, end - position) : 0;
+  }
+  size_t read(char* buffer, size_t size) override {
+    size_t count = std::min(size, (size_t) available());
+    memcpy(buffer, reply.data() + position, count);
+    position += count;
+    return count;
+  }
+  bool connected() override { return position < reply.size(); }
+
+private:
+  std::string reply;
+  size_t stallAfter;
+  size_t position = 0;
+};
+
+static void testUpdateNews() {
+  std::string feed = makeFeed(false, 4000000);
+  RssClient client;
+  client.setUrls("http://news.example.com/rss.xml");
+
+  FeedServer server(feed);
+  hostServer = &server;
+  headlines.clear();
+  CHECK(client.updateNews());
+  CHECK_TEXT(client.getError().c_str(), "");
+  CHECK(headlines.getCount() > HEADLINE_COUNT / 2);
+  CHECK_TEXT(headlines.getTitle(0).c_str(), "Story 000000: rates & markets");
+  CHECK(client.wasStoppedEarly());
+  CHECK(client.getLastBytes() < 64 * 1024); // 64 items, not 4 MB
+  printf("updateNews: %lu of %u bytes read before the store was full\n", client.getLastBytes(), (unsigned) feed.size());
+
+  // a server that goes quiet mid-feed: the items before the stall are kept
+  FeedServer stalled(feed, 5000);
+  hostServer = &stalled;
+  headlines.clear();
+  unsigned long start = millis();
+  CHECK(client.updateNews());
+  CHECK(millis() - start >= RSS_TIMEOUT_MS);
+  CHECK(client.getError().startsWith("Feed timed out"));
+  CHECK(headlines.getCount() > 0);
+
+  // and one that never answers
+  FeedServer silent(feed, 0);
+  hostServer = &silent;
+  headlines.clear();
+  CHECK(!client.updateNews());
+  CHECK(client.getError().startsWith("No reply from"));
+  hostServer = nullptr;
+}
+
+// https feeds on two sites: one checked against the root CAs, one pinned
+static void testTlsPerFeed() {
+  static const char SECOND_FINGERPRINT[] PROGMEM = "AA BB CC DD EE FF 00 11 22 33 44 55 66 77 88 99 AA BB CC DD";
+  RssClient client;
+  client.setUrls("https://news.example.com/rss.xml\nhttps://blog.example.org/feed");
+  client.setFingerprint(1, SECOND_FINGERPRINT);
+  CHECK(client.getFeedCount() == 2);
+  CHECK(!client.getTls(0).isPinned());
+  CHECK(client.getTls(1).isPinned());
+
+  FeedServer server(makeFeed(false, 100000));
+  hostServer = &server;
+  headlines.clear();
+  CHECK(client.updateNews());
+  CHECK(client.getTls(0).getHandshakes() == 1);
+  CHECK(client.getTls(1).getHandshakes() == 1);
+  CHECK(client.getTls(0).getRefused() == 0);
+  CHECK(headlines.getCount() > 0);
+  hostServer = nullptr;
+}
+
+int main() {
+  testRss();
+  testAtom();
+  testUpdateNews();
+  testTlsPerFeed();
+  return testResult("test_xml_feed");
+}
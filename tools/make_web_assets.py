@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Builds marquee/WebAssets.h -- the stylesheet, script and news source list
+the web pages use, gzipped into PROGMEM so nothing has to come from the
+internet. Run it after editing anything in tools/web or sources.json:
+
+    python3 tools/make_web_assets.py
+
+Each asset gets a tag from its contents. It is the ETag, and pages link the
+asset with ?v=<tag>, so browsers can keep a copy until the firmware changes it.
+"""
+
+import gzip
+import hashlib
+import json
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB = os.path.join(ROOT, 'tools', 'web')
+OUTPUT = os.path.join(ROOT, 'marquee', 'WebAssets.h')
+
+
+def read(path):
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def compact_css(data):
+    text = data.decode('utf-8')
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'\s*\n\s*', '', text)
+    return text.encode('utf-8')
+
+
+def news_sources(data):
+    # the page only needs the ids for its drop down
+    sources = json.loads(data)['sources']
+    ids = [{'id': source['id']} for source in sources]
+    return json.dumps({'sources': ids}, separators=(',', ':')).encode('utf-8')
+
+
+ASSETS = [
+    # path, macro name, content type, contents
+    ('/app.css', 'APP_CSS', 'text/css', compact_css(read(os.path.join(WEB, 'app.css')))),
+    ('/app.js', 'APP_JS', 'application/javascript', read(os.path.join(WEB, 'app.js')).strip()),
+    ('/sources.json', 'SOURCES_JSON', 'application/json', news_sources(read(os.path.join(ROOT, 'sources.json')))),
+]
+
+LICENSE = '''/** The MIT License (MIT)
+
+Copyright (c) 2026 bit4man@github
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+'''
+
+
+def main():
+    lines = [LICENSE, '',
+             '// Generated by tools/make_web_assets.py -- edit tools/web or sources.json and run it again',
+             '', '#pragma once', '#include <Arduino.h>', '']
+    entries = []
+    lines.append('#define WEB_ASSET_COUNT %d' % len(ASSETS))
+    for path, name, content_type, data in ASSETS:
+        tag = hashlib.sha1(data).hexdigest()[:12]
+        lines.append('#define WEB_%s_TAG "%s"' % (name, tag))
+    lines.append('')
+    for path, name, content_type, data in ASSETS:
+        packed = gzip.compress(data, compresslevel=9, mtime=0)
+        tag = hashlib.sha1(data).hexdigest()[:12]
+        lines.append('// %s -- %d bytes, %d gzipped' % (path, len(data), len(packed)))
+        lines.append('static const uint8_t WEB_%s[] PROGMEM = {' % name)
+        for offset in range(0, len(packed), 16):
+            row = ', '.join('0x%02x' % b for b in packed[offset:offset + 16])
+            lines.append('  %s%s' % (row, ',' if offset + 16 < len(packed) else ''))
+        lines.append('};')
+        lines.append('')
+        entries.append('  { "%s", "%s", WEB_%s_TAG, WEB_%s, %d }' % (path, content_type, name, name, len(packed)))
+        print('%-14s %6d bytes, %6d gzipped, tag %s' % (path, len(data), len(packed), tag))
+    lines.append('typedef struct {')
+    lines.append('  char path[16];')
+    lines.append('  char type[24];')
+    lines.append('  char tag[16];')
+    lines.append('  const uint8_t *data;')
+    lines.append('  uint32_t length;      // gzipped')
+    lines.append('} WebAsset;')
+    lines.append('')
+    lines.append('static const WebAsset WEB_ASSETS[WEB_ASSET_COUNT] PROGMEM = {')
+    lines.append(',\n'.join(entries))
+    lines.append('};')
+    with open(OUTPUT, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,3 @@
+function openSidebar(){document.getElementById('mySidebar').style.display='block'}
+function closeSidebar(){document.getElementById('mySidebar').style.display='none'}
+function isNumberKey(e){var h=e.which?e.which:event.keyCode;return!(h>31&&(h<48||h>57))}